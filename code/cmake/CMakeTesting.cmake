@@ -7,3 +7,6 @@ ENDIF(BUILD_TESTING)
 ADD_TEST(NAME ${PROJECT_NAME}_TEST_001
          WORKING_DIRECTORY ${PROJECT_BINARY_DIR}
          COMMAND ${TEST_EXE} --gtest_output=xml:test_output.xml)
+ADD_TEST(NAME ${PROJECT_NAME}_TEST_002
+         WORKING_DIRECTORY ${PROJECT_BINARY_DIR}
+         COMMAND ${ALLOCATION_TEST_EXE} --gtest_output=xml:allocation_test_output.xml)
@@ -10,6 +10,7 @@
 
 #include "BlockedDOF.hpp"
 #include "BodyStates.hpp"
+#include "Observer.hpp"
 #include "StateMacros.hpp"
 
 #include <ssc/kinematics.hpp>
@@ -19,8 +20,6 @@
 struct YamlBody;
 struct YamlRotation;
 
-class Observer;
-
 class Body
 {
     public:
@@ -28,7 +27,11 @@ class Body
         Body(const size_t idx, const BlockedDOF& blocked_states);
         Body(const BodyStates& states, const size_t idx, const BlockedDOF& blocked_states);
 
-        BodyStates get_states() const;
+        /** \brief Read-only view of the body's states (histories, mesh, inertia...)
+         *  \details No copy is made: the reference stays valid as long as the Body
+         *            does & reflects subsequent calls to update_body_states.
+         */
+        const BodyStates& get_states() const;
 
         /** \brief Use SurfaceElevation to compute wave height & update accordingly
          */
@@ -62,7 +65,7 @@ class Body
 
         Eigen::Vector3d get_uvw(const StateType& x) const;
         Eigen::Vector3d get_pqr(const StateType& x) const;
-        std::string get_name() const;
+        const std::string& get_name() const;
         ssc::kinematics::RotationMatrix get_rot_from_ned_to(const StateType& x) const;
         ssc::kinematics::EulerAngles get_angles(const StateType& all_states, const YamlRotation& c) const;
         std::tuple<double,double,double,double> get_quaternions(const ssc::kinematics::EulerAngles& angle, const YamlRotation& c) const;
@@ -71,6 +74,12 @@ class Body
         BlockedDOF::Vector get_delta_F(const StateType& dx_dt, const ssc::kinematics::Wrench& sum_of_other_forces) const;
 
         void set_states_history(const AbstractStates<History>& states);
+
+        /**  \brief Records the values of 'states' after those already in the body's history
+          *  \details Unlike set_states_history, the existing history is kept (it is only
+          *            truncated to Tmax). Throws if 'states' starts before the last recorded instant.
+          */
+        void append_states_history(const AbstractStates<History>& states);
         void reset_history();
     protected:
         BodyStates states;
@@ -80,6 +89,9 @@ class Body
 
         size_t idx; //!< Index of the first state
         BlockedDOF blocked_states;
+        mutable std::vector<DataAddressing> states_addressing; //!< Built on the first call to 'feed' (once the body's name is known)
+        std::string mesh_frame;                                //!< "mesh(body)": built once so the kinematics lookups don't concatenate strings at each time step
+        std::string local_ned_frame;                           //!< "NED(body)"
 };
 
 typedef TR1(shared_ptr)<Body> BodyPtr;
@@ -16,6 +16,7 @@
 
 #include "yaml-cpp/exceptions.h"
 #include "InvalidInputException.hpp"
+#include "Observer.hpp"
 #include "YamlBody.hpp"
 
 #include "EnvironmentAndFrames.hpp"
@@ -30,7 +31,6 @@ typedef TR1(shared_ptr)<ControllableForceModel> ControllableForcePtr;
 typedef std::vector<ControllableForcePtr> ListOfControlledForces;
 typedef std::function<boost::optional<ControllableForcePtr>(const YamlModel&, const std::string&, const EnvironmentAndFrames&)> ControllableForceParser;
 
-class Observer;
 
 /** \brief These force models read commands from a DataSource.
  *  \details Provides facilities to the derived classes to retrieve the commands
@@ -99,6 +99,9 @@ class ControllableForceModel
         YamlPosition position_of_frame;
         ssc::kinematics::Wrench latest_force_in_body_frame;
         ssc::kinematics::Transform from_internal_frame_to_a_known_frame;
+        std::vector<DataAddressing> addressing_in_body_frame;
+        std::vector<DataAddressing> addressing_in_internal_frame;
+        std::vector<DataAddressing> addressing_in_ned_frame;
 };
 
 #endif /* CONTROLLABLEFORCEMODEL_HPP_ */
@@ -65,7 +65,7 @@ class DefaultSurfaceElevation : public SurfaceElevationInterface
                                              const double t                  //!< Current time instant (in seconds)
                                              ) const;
 
-        std::vector<FlatDiscreteDirectionalWaveSpectrum> get_flat_directional_spectra(const double x, const double y, const double t) const;
+        FlatDiscreteDirectionalWaveSpectraPtr get_flat_directional_spectra(const double x, const double y, const double t) const;
         std::vector<DiscreteDirectionalWaveSpectrum> get_directional_spectra(const double x, const double y, const double t) const;
         double zwave;
 };
@@ -15,6 +15,7 @@
 #include <ssc/kinematics.hpp>
 
 class Observer;
+class ThreadPool;
 
 struct EnvironmentAndFrames
 {
@@ -26,6 +27,7 @@ struct EnvironmentAndFrames
     double nu;
     double g;
     YamlRotation rot;
+    TR1(shared_ptr)<ThreadPool> thread_pool; //!< Splits the loop on the facets in the surface force models (sequential if null)
 };
 
 #endif /* ENVIRONMENTANDFRAMES_HPP_ */
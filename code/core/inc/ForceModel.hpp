@@ -20,13 +20,13 @@
 #include TR1INC(memory)
 
 #include "InvalidInputException.hpp"
+#include "Observer.hpp"
 #include "YamlBody.hpp"
 
 struct BodyStates;
 struct EnvironmentAndFrames;
 class ForceModel;
 
-class Observer;
 
 typedef TR1(shared_ptr)<ForceModel> ForcePtr;
 typedef std::function<boost::optional<ForcePtr>(const YamlModel&, const std::string&, const EnvironmentAndFrames&)> ForceParser;
@@ -115,6 +115,8 @@ class ForceModel
         std::string body_name;
         ssc::kinematics::Wrench force_in_body_frame;
         ssc::kinematics::Wrench force_in_ned_frame;
+        std::vector<DataAddressing> addressing_in_body_frame;
+        std::vector<DataAddressing> addressing_in_ned_frame;
 };
 
 typedef std::vector<ForcePtr> ListOfForces;
@@ -8,6 +8,7 @@
 #ifndef OBSERVER_HPP_
 #define OBSERVER_HPP_
 
+#include <deque>
 #include <functional>
 #include <map>
 #include <string>
@@ -20,17 +21,34 @@
 class Sim;
 class SurfaceElevationGrid;
 
+/** \brief Name & location of a serialized variable
+ *  \details Each distinct name is associated (once and for all, when the DataAddressing is built)
+ *           with an integer id, shared by all observers: writing a value to an observer then only
+ *           costs an array access. Callers writing at each time step should therefore build
+ *           their DataAddressing once (eg. in their constructor) & reuse them.
+ */
 struct DataAddressing
 {
     std::string name;
     std::vector<std::string> address;
-    DataAddressing():name(),address(){};
+    size_t id; //!< Integer handle associated with 'name'
+    DataAddressing():name(),address(),id(get_id(name)){};
     DataAddressing(
             const std::vector<std::string>& address_,
             const std::string& name_):
-        name(name_),address(address_){};
+        name(name_),address(address_),id(get_id(name)){};
+
+    /**  \brief Returns the integer handle associated with a variable name (creating it if necessary)
+      */
+    static size_t get_id(const std::string& name);
 };
 
+/**  \brief Addresses of the six components of a wrench
+  *  \details Names are Fx(force_name,body_name,frame), Fy(...), Fz(...), Mx(...), My(...) & Mz(...)
+  *           stored in efforts/body_name/force_name/frame/Fx, etc.
+  */
+std::vector<DataAddressing> wrench_addressing(const std::string& force_name, const std::string& body_name, const std::string& frame);
+
 class Observer
 {
     public:
@@ -39,20 +57,27 @@ class Observer
         void observe_everything(const Sim& sys, const double t); // Everything (not just what the user asked). Used for co-simulation
         virtual ~Observer();
 
-        template <typename T> void write(
-                const T& val,
-                const DataAddressing& address)
-        {
-            initialize[address.name] = get_initializer(val, address);
-            serialize[address.name] = get_serializer(val, address);
-        }
+        /**  \brief Stores a scalar value
+          *  \details The first time a variable is written, a slot is created for it (along with its initializer
+          *           & serializer). Subsequent writes only update the value in the slot.
+          */
+        void write(const double val, const DataAddressing& address);
+
+        /**  \brief Stores the wave elevations on a grid
+          *  \details The grid's initializer & serializer are rebuilt at each call: they keep a copy of the grid.
+          */
+        void write(const SurfaceElevationGrid& val, const DataAddressing& address);
 
         virtual void write_before_simulation(const std::vector<FlatDiscreteDirectionalWaveSpectrum>& val, const DataAddressing& address);
 
     protected:
 
-        virtual std::function<void()> get_serializer(const double val, const DataAddressing& address) = 0;
-        virtual std::function<void()> get_initializer(const double val, const DataAddressing& address) = 0;
+        /**  \brief Builds the function serializing a scalar variable
+          *  \details Only called once per variable: 'val' is the variable's slot, which is updated at each time step
+          *           & remains valid as long as the observer does, so it should be captured by reference.
+          */
+        virtual std::function<void()> get_serializer(const double& val, const DataAddressing& address) = 0;
+        virtual std::function<void()> get_initializer(const double& val, const DataAddressing& address) = 0;
 
         virtual std::function<void()> get_serializer(const SurfaceElevationGrid& val, const DataAddressing& address);
         virtual std::function<void()> get_initializer(const SurfaceElevationGrid& val, const DataAddressing& address);
@@ -66,13 +91,18 @@ class Observer
     private:
         Observer(); // Disabled
 
+        typedef std::vector<std::function<void()>* > Serializers;
+        Serializers get_serializers(const std::vector<std::string>& variables_to_serialize);
         void initialize_serialization_of_requested_variables(const std::vector<std::string>& variables_to_serialize);
-        void serialize_requested_variables(const std::vector<std::string>& variables_to_serialize);
+        void serialize_variables(const Serializers& serializers);
 
         bool initialized;
         std::vector<std::string> requested_serializations;
+        Serializers requested_serializers; //!< Resolved once (at the first time step)
         std::map<std::string, std::function<void()> > serialize;
         std::map<std::string, std::function<void()> > initialize;
+        std::vector<size_t> id2slot;   //!< Indexed by DataAddressing::id
+        std::deque<double> slots;      //!< Values of the scalar variables (a deque so references to its elements stay valid)
 };
 
 typedef TR1(shared_ptr)<Observer> ObserverPtr;
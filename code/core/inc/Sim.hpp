@@ -57,6 +57,12 @@ class Sim
 
         void set_bodystates(const std::vector<State>& states);
 
+        /**  \brief Appends 'states' to the bodies' histories (instead of replacing them, like set_bodystates)
+          *  \details Used by the co-simulation sessions, which only send the newest state samples.
+          *            The current state becomes the last element of 'states'.
+          */
+        void append_to_bodystates(const std::vector<State>& states);
+
         std::map<std::string,std::vector<ForcePtr> > get_forces() const;
         std::vector<BodyPtr> get_bodies() const;
         EnvironmentAndFrames get_env() const;
@@ -65,7 +71,7 @@ class Sim
 
         void reset_history();
     private:
-        ssc::kinematics::UnsafeWrench sum_of_forces(const StateType& x, const BodyPtr& body, const double t);
+        ssc::kinematics::UnsafeWrench sum_of_forces(const StateType& x, const size_t body_idx, const double t);
 
         /**  \brief Make sure quaternions can be converted to Euler angles
           *  \details Normalization takes place at each time step, which is not
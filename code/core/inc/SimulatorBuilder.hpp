@@ -62,6 +62,14 @@ class SimulatorBuilder
           */
         Sim build() const;
 
+        /**  \brief Number of threads used by the surface force models (eg. Froude-Krylov) to loop on the facets
+          *  \details The default (1) is the sequential loop. Zero means one thread per core.
+          *           The results are reproducible for a given number of threads but may differ slightly
+          *           (because of rounding errors) from one number of threads to another.
+          *  \returns *this (so we can chain calls)
+          */
+        SimulatorBuilder& set_nb_of_threads(const size_t nb_of_threads);
+
         /**  \brief Add the capacity to parse the default wave model
           *  \details This method must not be called with any parameters: the
           *  default parameter is only there so we can use boost::enable_if. This
@@ -193,6 +201,7 @@ class SimulatorBuilder
         TR1(shared_ptr)<std::vector<SpectrumBuilderPtr> > spectrum_parsers;
         ssc::data_source::DataSource command_listener;
         double t0; //!< First time step (to initialize state history)
+        size_t nb_of_threads; //!< Used by the surface force models
 };
 
 
@@ -45,7 +45,7 @@ class SurfaceElevationFromWaves: public SurfaceElevationInterface
     private:
         SurfaceElevationFromWaves(); // Disabled
 
-        std::vector<FlatDiscreteDirectionalWaveSpectrum> get_flat_directional_spectra(const double x, const double y, const double t) const;
+        FlatDiscreteDirectionalWaveSpectraPtr get_flat_directional_spectra(const double x, const double y, const double t) const;
         std::vector<DiscreteDirectionalWaveSpectrum> get_directional_spectra(const double x, const double y, const double t) const;
 
         /**
@@ -59,6 +59,13 @@ class SurfaceElevationFromWaves: public SurfaceElevationInterface
                                         const double t                //!< Current instant (in seconds)
                                         ) const;
 
+        /**  \brief Sum of the elevations of each wave model at the nodes of a regular grid
+          *  \snippet core/unit_tests/src/SurfaceElevationFromWavesTest.cpp SurfaceElevationFromWavesTest regular grid example
+          */
+        std::vector<double> wave_height_on_grid(const RegularGrid& grid, //!< Nodes at which to compute the elevations (in the NED frame)
+                                                const double t           //!< Current instant (in seconds)
+                                                ) const;
+
         /**  \author cec
           *  \date Feb 3, 2015, 10:06:45 AM
           *  \brief Orbital velocity
@@ -97,6 +104,20 @@ class SurfaceElevationFromWaves: public SurfaceElevationInterface
                                              const double t                  //!< Current time instant (in seconds)
                                              ) const;
 
+        /**  \brief Sums the dynamic pressures of all wave models directly in pdyn
+          */
+        void fill_dynamic_pressure(const double rho,                   //!< water density (in kg/m^3)
+                                   const double g,                     //!< gravity (in m/s^2)
+                                   const std::vector<double> &x,       //!< x-positions in the NED frame (in meters)
+                                   const std::vector<double> &y,       //!< y-positions in the NED frame (in meters)
+                                   const std::vector<double> &z,       //!< z-positions in the NED frame (in meters)
+                                   const std::vector<double> &eta,     //!< Wave elevations at (x,y) in the NED frame (in meters)
+                                   const double t,                     //!< Current time instant (in seconds)
+                                   std::vector<double>& pdyn,          //!< Output: dynamic pressures (in Pascal)
+                                   DynamicPressureWorkspace& workspace //!< Scratch vectors of the wave models
+                                   ) const;
+
         std::vector<WaveModelPtr> directional_spectra;
+        FlatDiscreteDirectionalWaveSpectraPtr flat_directional_spectra; //!< Built once & for all (the spectra do not change during the simulation)
 };
 #endif /* SURFACEELEVATIONFROMWAVES_HPP_ */
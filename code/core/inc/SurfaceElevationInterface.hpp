@@ -11,10 +11,30 @@
 #include "GeometricTypes3d.hpp"
 #include "SurfaceElevationGrid.hpp"
 #include "Observer.hpp"
+#include "WaveModel.hpp" // For DynamicPressureWorkspace
 #include <ssc/kinematics.hpp>
 #include <ssc/macros/tr1_macros.hpp>
 #include TR1INC(memory)
 
+typedef TR1(shared_ptr)<const std::vector<FlatDiscreteDirectionalWaveSpectrum> > FlatDiscreteDirectionalWaveSpectraPtr;
+
+class WaveFieldLattice;
+struct RegularGrid;
+struct YamlWaveLattice;
+
+/** \brief Caller-owned storage for SurfaceElevationInterface::get_dynamic_pressure
+ *  \details Kept from one time step to the next (eg. by FroudeKrylovForceModel) so the vectors keep their capacity
+ */
+struct DynamicPressureBuffers
+{
+    DynamicPressureBuffers();
+    std::vector<double> x;    //!< x-positions of the points in the NED frame (in meters)
+    std::vector<double> y;    //!< y-positions of the points in the NED frame (in meters)
+    std::vector<double> z;    //!< z-positions of the points in the NED frame (in meters)
+    std::vector<double> pdyn; //!< Dynamic pressure at each point (in Pascal)
+    DynamicPressureWorkspace workspace; //!< Scratch vectors of the wave models
+};
+
 /** \author cec
  *  \date 24 avr. 2014, 10:28:25
  *  \brief Interface to wave models
@@ -35,6 +55,18 @@ class SurfaceElevationInterface
 
         virtual ~SurfaceElevationInterface();
 
+        /**  \brief Evaluates the waves once per instant on a lattice & interpolates them at all points
+          *  \details Useful when several bodies (or a body & the output mesh) are in the same waves: the Airy sums
+          *           are computed at the nodes of the lattice, instead of at the points of each body. Points outside
+          *           the lattice are evaluated directly. The dynamic pressure is only interpolated if the lattice has
+          *           a z axis: it is assumed to be proportional to rho*g, which is the case for all wave models in xdyn.
+          *           Throws if the interpolation error cannot be guaranteed to be lower than input.tolerance.
+          *           The spectra are assumed not to depend on the position nor on the instant.
+          *  \snippet core/unit_tests/src/SurfaceElevationFromWavesTest.cpp SurfaceElevationFromWavesTest lattice example
+          */
+        void use_lattice(const YamlWaveLattice& input //!< Lattice bounds (in the NED frame), number of nodes & tolerance
+                        );
+
         /**  \brief Computes surface elevation for each point on mesh.
           *  \details Updates the absolute surface elevation & the relative wave height.
           */
@@ -100,6 +132,20 @@ class SurfaceElevationInterface
                                                  const std::vector<double>& eta,          //!< Wave elevation at P in the NED frame (in meters)
                                                  const double t                           //!< Current instant (in seconds)
                                                  ) const;
+
+        /**  \brief Computes the dynamic pressure at given points, in caller-owned storage
+          *  \details Same as the previous method, but the results are written in buffers.pdyn & the vectors
+          *           in 'buffers' are resized instead of being created, so no vector is allocated if 'buffers'
+          *           is reused & the number of points does not increase.
+          */
+        void get_dynamic_pressure(const double rho,                        //!< Water density (in kg/m^3)
+                                  const double g,                          //!< Gravity (in m/s^2)
+                                  const ssc::kinematics::PointMatrix& P,   //!< Positions of points P, relative to the centre of the NED frame, but projected in any frame
+                                  const ssc::kinematics::KinematicsPtr& k, //!< Object used to compute the transforms to the NED frame
+                                  const std::vector<double>& eta,          //!< Wave elevation at P in the NED frame (in meters)
+                                  const double t,                          //!< Current instant (in seconds)
+                                  DynamicPressureBuffers& buffers          //!< Input/output: coordinates of P in the NED frame & dynamic pressures
+                                  ) const;
         std::vector<double> get_and_check_dynamic_pressure(const double rho,               //!< water density (in kg/m^3)
                                                            const double g,                 //!< gravity (in m/s^2)
                                                            const std::vector<double> &x,   //!< x-positions in the NED frame (in meters)
@@ -121,12 +167,17 @@ class SurfaceElevationInterface
                 ) const;
 
         /**  \brief Computes the wave heights at the points given in the 'output' section of the YAML file.
+          *  \details If the output mesh is a regular grid in the NED frame (which is the case if it was built
+          *           by SurfaceElevationBuilderInterface::make_wave_mesh, even in a body's frame), the wave
+          *           heights are computed by wave_height_on_grid (eg. by an inverse FFT for Airy waves).
+          *           Otherwise (or if a lattice is used), they are computed at each point by get_and_check_wave_height.
           *  \returns a structure containing vector \a x, vector \a y and
           *           matrix \a z where
           *           \li \a x gives the X-variation of the mesh
           *           \li \a y gives the Y-variation of the mesh
           *           \li \a z gives the associated free surface elevation in
           *           the NED frame.
+          *  \snippet core/unit_tests/src/SurfaceElevationFromWavesTest.cpp SurfaceElevationFromWavesTest regular grid example
           */
         SurfaceElevationGrid get_waves_on_mesh_as_a_grid(
                 const ssc::kinematics::KinematicsPtr& k,    //!< Object used to compute the transforms to the NED frame
@@ -155,7 +206,11 @@ class SurfaceElevationInterface
 
         virtual void serialize_wave_spectra_before_simulation(ObserverPtr& observer) const;
 
-        virtual std::vector<FlatDiscreteDirectionalWaveSpectrum> get_flat_directional_spectra(const double x, const double y, const double t) const = 0;
+        /**  \brief Flat spectra of each wave model, at a given point & instant
+          *  \details The spectra are shared & immutable: models whose spectra do not depend on (x,y,t)
+          *           return the same object at each call (evaluate_rao calls this method at each time step).
+          */
+        virtual FlatDiscreteDirectionalWaveSpectraPtr get_flat_directional_spectra(const double x, const double y, const double t) const = 0;
         virtual std::vector<DiscreteDirectionalWaveSpectrum> get_directional_spectra(const double x, const double y, const double t) const = 0;
         /**  \brief If the wave output mesh is not defined in NED, use Kinematics to update its x-y coordinates
           */
@@ -174,6 +229,13 @@ class SurfaceElevationInterface
                                                 const double t                //!< Current instant (in seconds)
                                                 ) const = 0;
 
+        /**  \brief Surface elevations at the nodes of a regular grid (i varying fastest), in meters
+          *  \details Used by get_waves_on_mesh_as_a_grid. The default implementation calls wave_height at each node.
+          */
+        virtual std::vector<double> wave_height_on_grid(const RegularGrid& grid, //!< Nodes at which to compute the elevations (in the NED frame)
+                                                        const double t           //!< Current instant (in seconds)
+                                                        ) const;
+
         /**  \author cec
           *  \date Feb 3, 2015, 10:06:45 AM
           *  \brief Orbital velocity
@@ -207,13 +269,38 @@ class SurfaceElevationInterface
                                                      const std::vector<double> &eta, //!< Wave elevations at (x,y) in the NED frame (in meters)
                                                      const double t                  //!< Current time instant (in seconds)
                                                      ) const = 0;
+
+        /**  \brief Same as dynamic_pressure, but writing in pdyn (which has the same size as x)
+          *  \details The default implementation calls dynamic_pressure.
+          */
+        virtual void fill_dynamic_pressure(const double rho,                   //!< water density (in kg/m^3)
+                                           const double g,                     //!< gravity (in m/s^2)
+                                           const std::vector<double> &x,       //!< x-positions in the NED frame (in meters)
+                                           const std::vector<double> &y,       //!< y-positions in the NED frame (in meters)
+                                           const std::vector<double> &z,       //!< z-positions in the NED frame (in meters)
+                                           const std::vector<double> &eta,     //!< Wave elevations at (x,y) in the NED frame (in meters)
+                                           const double t,                     //!< Current time instant (in seconds)
+                                           std::vector<double>& pdyn,          //!< Output: dynamic pressures (in Pascal)
+                                           DynamicPressureWorkspace& workspace //!< Scratch vectors of the wave models
+                                           ) const;
         ssc::kinematics::PointMatrixPtr get_output_mesh_in_NED_frame(const ssc::kinematics::KinematicsPtr& k //!< Object used to compute the transforms to the NED frame
                                                                     ) const;
 
+        /**  \brief Wave elevations interpolated on the lattice (or evaluated directly for points outside the lattice)
+          */
+        std::vector<double> interpolated_wave_height(const std::vector<double> &x, const std::vector<double> &y, const double t) const;
+
+        /**  \brief Dynamic pressures interpolated on the lattice (or evaluated directly for points outside the lattice)
+          */
+        void interpolated_dynamic_pressure(const double rho, const double g, const std::vector<double> &x, const std::vector<double> &y, const std::vector<double> &z,
+                                           const std::vector<double> &eta, const double t, std::vector<double>& pdyn) const;
+        bool interpolates_dynamic_pressure() const;
+
         ssc::kinematics::PointMatrixPtr output_mesh;            //!< Mesh defined in the 'output' section of the YAML file. Points at which we want to know the wave height at each instant
         std::pair<std::size_t,std::size_t> output_mesh_size;    //!< Mesh size defined as a pair containing nx and ny
         std::vector<double> relative_wave_height_for_each_point_in_mesh;
         std::vector<double> surface_elevation_for_each_point_in_mesh;
+        TR1(shared_ptr)<WaveFieldLattice> lattice;              //!< Null unless 'use_lattice' was called
 };
 
 typedef TR1(shared_ptr)<SurfaceElevationInterface> SurfaceElevationPtr;
@@ -0,0 +1,76 @@
+/*
+ * ThreadPool.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: cady
+ */
+
+#ifndef THREADPOOL_HPP_
+#define THREADPOOL_HPP_
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/** \brief Fixed-size pool of threads used to split a loop into a few tasks (fork-join)
+ *  \details The threads are started once & for all (in the constructor) so run() can be
+ *           called at each time step without paying for the creation of threads.
+ *           Used by SurfaceForceModel to split the loop on the facets.
+ *  \addtogroup simulator
+ *  \ingroup simulator
+ *  \section ex1 Example
+ *  \snippet core/unit_tests/src/ThreadPoolTest.cpp ThreadPoolTest example
+ */
+class ThreadPool
+{
+    public:
+        typedef std::function<void(const size_t)> Task;
+
+        ThreadPool(const size_t nb_of_threads //!< Including the thread calling 'run'. If zero, use the number of cores
+                  );
+
+        /**  \brief Stops the threads
+          */
+        ~ThreadPool();
+
+        /**  \brief Calls f(0), f(1), ..., f(nb_of_tasks-1) concurrently & returns when all calls have completed
+          *  \details The calling thread also runs tasks. Tasks are not bound to a given thread so f should
+          *           only write to data indexed by its argument. If tasks throw, the first exception
+          *           is rethrown (once all tasks have completed). Concurrent calls to run are serialized.
+          */
+        void run(const size_t nb_of_tasks, const Task& f);
+
+        size_t get_nb_of_threads() const;
+
+    private:
+        ThreadPool(); // Disabled
+        ThreadPool(const ThreadPool&); // Disabled
+        ThreadPool& operator=(const ThreadPool&); // Disabled
+
+        void work();
+        void run_tasks(std::unique_lock<std::mutex>& lock);
+
+        size_t nb_of_threads;
+        std::mutex run_mutex;                 //!< Serializes calls to 'run'
+        std::mutex mutex;                     //!< Protects all members below
+        std::condition_variable job_available;
+        std::condition_variable job_done;
+        const Task* job;
+        size_t nb_of_tasks;
+        size_t next_task;
+        size_t nb_of_completed_tasks;
+        size_t generation;                    //!< Incremented by each call to 'run', so the threads know there is a new job
+        std::exception_ptr exception;
+        bool stopping;
+        std::vector<std::thread> workers;
+};
+
+/**  \brief Number of threads to use when the user asks for nb_of_threads
+  *  \returns nb_of_threads if it is not zero, the number of cores otherwise (at least one)
+  */
+size_t get_nb_of_threads_to_use(const size_t nb_of_threads);
+
+#endif /* THREADPOOL_HPP_ */
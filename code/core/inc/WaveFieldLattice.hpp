@@ -0,0 +1,104 @@
+/*
+ * WaveFieldLattice.hpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: cady
+ */
+
+#ifndef WAVEFIELDLATTICE_HPP_
+#define WAVEFIELDLATTICE_HPP_
+
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include "DiscreteDirectionalWaveSpectrum.hpp"
+
+struct YamlWaveLattice;
+
+/** \brief Wave elevation & dynamic pressure tabulated on a fixed lattice (in the NED frame)
+ *  \details Used by SurfaceElevationInterface: the waves are evaluated at the nodes of the lattice
+ *           once per instant (the first time they are requested at that instant) & all points
+ *           (of all bodies & of the output mesh) are then interpolated (bilinear interpolation
+ *           for the elevation, trilinear for the dynamic pressure). The interpolation error is
+ *           bounded using the second derivatives of the Airy sums, \f$\sum_i a_i k_i^2\f$, and
+ *           the constructor throws if this bound exceeds the tolerance.
+ *  \addtogroup hydro_models
+ *  \ingroup hydro_models
+ *  \section ex1 Example
+ *  \snippet core/unit_tests/src/SurfaceElevationFromWavesTest.cpp SurfaceElevationFromWavesTest lattice example
+ */
+class WaveFieldLattice
+{
+    public:
+        /**  \brief Evaluates the wave elevations directly, at (x[i],y[i],t)
+          */
+        typedef std::function<std::vector<double>(const std::vector<double>& x, const std::vector<double>& y, const double t)> ElevationModel;
+
+        /**  \brief Evaluates the dynamic pressures divided by rho*g directly, at (x[i],y[i],z[i],t), for a wave elevation eta[i]
+          */
+        typedef std::function<std::vector<double>(const std::vector<double>& x, const std::vector<double>& y, const std::vector<double>& z, const std::vector<double>& eta, const double t)> PressureModel;
+
+        WaveFieldLattice(const YamlWaveLattice& input,                                   //!< Lattice bounds, number of nodes & tolerance
+                         const std::vector<FlatDiscreteDirectionalWaveSpectrum>& spectra //!< Spectra of the wave models (used to bound the interpolation error)
+                        );
+
+        /**  \brief Interpolates the wave elevation at each point inside the lattice
+          *  \returns Indices of the points outside the lattice (eta is not computed for those points)
+          */
+        std::vector<size_t> interpolate_elevation(const std::vector<double>& x, //!< x-coordinates of the points in the NED frame (in meters)
+                                                  const std::vector<double>& y, //!< y-coordinates of the points in the NED frame (in meters)
+                                                  const double t,               //!< Current instant (in seconds)
+                                                  const ElevationModel& model,  //!< Used to update the lattice if t has changed
+                                                  std::vector<double>& eta      //!< Output: wave elevations (same size as x)
+                                                  );
+
+        /**  \brief Interpolates the dynamic pressure divided by rho*g at each point inside the lattice
+          *  \details As in the wave models, the dynamic pressure is zero for points above the free surface (z < eta).
+          *  \returns Indices of the points outside the lattice (p is not computed for those points)
+          */
+        std::vector<size_t> interpolate_pressure_head(const std::vector<double>& x,   //!< x-coordinates of the points in the NED frame (in meters)
+                                                      const std::vector<double>& y,   //!< y-coordinates of the points in the NED frame (in meters)
+                                                      const std::vector<double>& z,   //!< z-coordinates of the points in the NED frame (in meters)
+                                                      const std::vector<double>& eta, //!< Wave elevations at (x,y) in the NED frame (in meters)
+                                                      const double t,                 //!< Current instant (in seconds)
+                                                      const PressureModel& model,     //!< Used to update the lattice if t has changed
+                                                      std::vector<double>& p          //!< Output: dynamic pressures divided by rho*g, in meters (same size as x)
+                                                      );
+
+        /**  \brief False if the lattice has no z axis: the dynamic pressure should then be evaluated directly
+          */
+        bool interpolates_pressure() const;
+
+    private:
+        WaveFieldLattice(); // Disabled
+        WaveFieldLattice(const WaveFieldLattice&); // Disabled
+        WaveFieldLattice& operator=(const WaveFieldLattice&); // Disabled
+
+        struct Axis
+        {
+            Axis(const double min, const double max, const size_t n);
+            bool contains(const double x) const;
+            double locate(const double x, size_t& i) const; //!< Index of the cell containing x & position of x in that cell (between 0 & 1)
+            double min;
+            double max;
+            size_t n;
+            double delta;
+        };
+
+        Axis x_axis;
+        Axis y_axis;
+        Axis z_axis;
+        std::vector<double> surface_nodes_x; //!< x-coordinates of the nodes of the (x,y) lattice (x varying fastest)
+        std::vector<double> surface_nodes_y; //!< y-coordinates of the nodes of the (x,y) lattice
+        std::vector<double> volume_nodes_x;  //!< x-coordinates of the nodes of the (x,y,z) lattice (x varying fastest, then y)
+        std::vector<double> volume_nodes_y;  //!< y-coordinates of the nodes of the (x,y,z) lattice
+        std::vector<double> volume_nodes_z;  //!< z-coordinates of the nodes of the (x,y,z) lattice
+        std::vector<double> elevations;      //!< Wave elevation at each node of the (x,y) lattice
+        std::vector<double> pressures;       //!< Dynamic pressure divided by rho*g at each node of the (x,y,z) lattice
+        double elevation_time;               //!< Instant at which 'elevations' was computed (NaN if never)
+        double pressure_time;                //!< Instant at which 'pressures' was computed (NaN if never)
+        std::mutex mutex;                    //!< The lattice is shared by all bodies, whose force models may run on several threads
+};
+
+#endif /* WAVEFIELDLATTICE_HPP_ */
@@ -11,12 +11,29 @@
 #include "SurfaceElevationInterface.hpp"
 #include "YamlBody.hpp"
 #include "NumericalErrorException.hpp"
+#include "InvalidInputException.hpp"
 
-Body::Body(const size_t i, const BlockedDOF& blocked_states_) : states(), idx(i), blocked_states(blocked_states_)
+#include <ssc/numeric.hpp>
+
+std::string mesh_frame_name(const std::string& body_name);
+std::string mesh_frame_name(const std::string& body_name)
+{
+    return std::string("mesh(") + body_name + ")";
+}
+
+std::string local_ned_frame_name(const std::string& body_name);
+std::string local_ned_frame_name(const std::string& body_name)
 {
+    return std::string("NED(") + body_name + ")";
 }
 
-Body::Body(const BodyStates& s, const size_t i, const BlockedDOF& blocked_states_) : states(s), idx(i), blocked_states(blocked_states_)
+Body::Body(const size_t i, const BlockedDOF& blocked_states_) : states(), idx(i), blocked_states(blocked_states_), states_addressing(),
+        mesh_frame(mesh_frame_name(states.name)), local_ned_frame(local_ned_frame_name(states.name))
+{
+}
+
+Body::Body(const BodyStates& s, const size_t i, const BlockedDOF& blocked_states_) : states(s), idx(i), blocked_states(blocked_states_), states_addressing(),
+        mesh_frame(mesh_frame_name(s.name)), local_ned_frame(local_ned_frame_name(s.name))
 {
 }
 
@@ -24,7 +41,7 @@ Body::~Body()
 {
 }
 
-BodyStates Body::get_states() const
+const BodyStates& Body::get_states() const
 {
     return states;
 }
@@ -40,7 +57,7 @@ ssc::kinematics::Point Body::get_origin(const StateType& x) const
 
 ssc::kinematics::Point Body::get_position_of_body_relative_to_mesh() const
 {
-    return ssc::kinematics::Point(std::string("mesh(")+states.name+")",
+    return ssc::kinematics::Point(mesh_frame,
                                   states.x_relative_to_mesh,
                                   states.y_relative_to_mesh,
                                   states.z_relative_to_mesh);
@@ -58,7 +75,7 @@ ssc::kinematics::Transform Body::get_transform_from_ned_to_body(const StateType&
 
 ssc::kinematics::Transform Body::get_transform_from_ned_to_local_ned(const StateType& x) const
 {
-    return ssc::kinematics::Transform(get_origin(x), std::string("NED(") + states.name + ")");
+    return ssc::kinematics::Transform(get_origin(x), local_ned_frame);
 }
 
 void Body::update_kinematics(StateType x, const ssc::kinematics::KinematicsPtr& k) const
@@ -95,7 +112,7 @@ void Body::update_projection_of_z_in_mesh_frame(const double g,
                                                 const ssc::kinematics::KinematicsPtr& k)
 {
     const ssc::kinematics::Point g_in_NED("NED", 0, 0, g);
-    const ssc::kinematics::RotationMatrix ned2mesh = k->get("NED", std::string("mesh(") + states.name + ")").get_rot();
+    const ssc::kinematics::RotationMatrix ned2mesh = k->get("NED", mesh_frame).get_rot();
     states.g_in_mesh_frame = ned2mesh*g_in_NED.v;
 }
 
@@ -125,7 +142,7 @@ void Body::calculate_state_derivatives(const ssc::kinematics::Wrench& sum_of_for
                                          const StateType& x,
                                          StateType& dx_dt,
                                          const double t,
-                                         const EnvironmentAndFrames& env) const
+                                         const EnvironmentAndFrames& ) const
 {
     // du/dt, dv/dt, dw/dt, dp/dt, dq/dt, dr/dt
     Eigen::Map<Eigen::Matrix<double,6,1> > dXdt(_U(dx_dt,idx));
@@ -133,7 +150,8 @@ void Body::calculate_state_derivatives(const ssc::kinematics::Wrench& sum_of_for
     dXdt = states.inverse_of_the_total_inertia->operator*(sum_of_forces.to_vector());
 
     // dx/dt, dy/dt, dz/dt
-    const ssc::kinematics::RotationMatrix& R = env.k->get("NED", states.name).get_rot();
+    // Same rotation as the NED -> body transform added to env.k by update_kinematics, without the lookup in the kinematics graph
+    const ssc::kinematics::RotationMatrix R = states.get_rot_from_ned_to(x, idx);
     const Eigen::Map<const Eigen::Vector3d> uvw(_U(x,idx));
     const Eigen::Vector3d XpYpZp(R*uvw);
     *_X(dx_dt,idx) = XpYpZp(0);
@@ -170,28 +188,52 @@ BlockedDOF::Vector Body::get_delta_F(const StateType& dx_dt, const ssc::kinemati
     return blocked_states.get_delta_F(dx_dt,*states.total_inertia,sum_of_other_forces);
 }
 
+std::vector<DataAddressing> get_states_addressing(const std::string& body_name);
+std::vector<DataAddressing> get_states_addressing(const std::string& body_name)
+{
+    std::vector<DataAddressing> ret;
+    ret.push_back(DataAddressing(std::vector<std::string>{"states",body_name,"X"},std::string("x(")+body_name+")"));
+    ret.push_back(DataAddressing(std::vector<std::string>{"states",body_name,"Y"},std::string("y(")+body_name+")"));
+    ret.push_back(DataAddressing(std::vector<std::string>{"states",body_name,"Z"},std::string("z(")+body_name+")"));
+    ret.push_back(DataAddressing(std::vector<std::string>{"states",body_name,"U"},std::string("u(")+body_name+")"));
+    ret.push_back(DataAddressing(std::vector<std::string>{"states",body_name,"V"},std::string("v(")+body_name+")"));
+    ret.push_back(DataAddressing(std::vector<std::string>{"states",body_name,"W"},std::string("w(")+body_name+")"));
+    ret.push_back(DataAddressing(std::vector<std::string>{"states",body_name,"P"},std::string("p(")+body_name+")"));
+    ret.push_back(DataAddressing(std::vector<std::string>{"states",body_name,"Q"},std::string("q(")+body_name+")"));
+    ret.push_back(DataAddressing(std::vector<std::string>{"states",body_name,"R"},std::string("r(")+body_name+")"));
+    ret.push_back(DataAddressing(std::vector<std::string>{"states",body_name,"Quat","Qr"},std::string("qr(")+body_name+")"));
+    ret.push_back(DataAddressing(std::vector<std::string>{"states",body_name,"Quat","Qi"},std::string("qi(")+body_name+")"));
+    ret.push_back(DataAddressing(std::vector<std::string>{"states",body_name,"Quat","Qj"},std::string("qj(")+body_name+")"));
+    ret.push_back(DataAddressing(std::vector<std::string>{"states",body_name,"Quat","Qk"},std::string("qk(")+body_name+")"));
+    ret.push_back(DataAddressing(std::vector<std::string>{"states",body_name,"PHI"},std::string("phi(")+body_name+")"));
+    ret.push_back(DataAddressing(std::vector<std::string>{"states",body_name,"THETA"},std::string("theta(")+body_name+")"));
+    ret.push_back(DataAddressing(std::vector<std::string>{"states",body_name,"PSI"},std::string("psi(")+body_name+")"));
+    return ret;
+}
+
 void Body::feed(const StateType& x, Observer& observer, const YamlRotation& c) const
 {
-    observer.write(*_X(x,idx), DataAddressing(std::vector<std::string>{"states",states.name,"X"},std::string("x(")+states.name+")"));
-    observer.write(*_Y(x,idx), DataAddressing(std::vector<std::string>{"states",states.name,"Y"},std::string("y(")+states.name+")"));
-    observer.write(*_Z(x,idx), DataAddressing(std::vector<std::string>{"states",states.name,"Z"},std::string("z(")+states.name+")"));
-    observer.write(*_U(x,idx), DataAddressing(std::vector<std::string>{"states",states.name,"U"},std::string("u(")+states.name+")"));
-    observer.write(*_V(x,idx), DataAddressing(std::vector<std::string>{"states",states.name,"V"},std::string("v(")+states.name+")"));
-    observer.write(*_W(x,idx), DataAddressing(std::vector<std::string>{"states",states.name,"W"},std::string("w(")+states.name+")"));
-    observer.write(*_P(x,idx), DataAddressing(std::vector<std::string>{"states",states.name,"P"},std::string("p(")+states.name+")"));
-    observer.write(*_Q(x,idx), DataAddressing(std::vector<std::string>{"states",states.name,"Q"},std::string("q(")+states.name+")"));
-    observer.write(*_R(x,idx), DataAddressing(std::vector<std::string>{"states",states.name,"R"},std::string("r(")+states.name+")"));
-    observer.write(*_QR(x,idx),DataAddressing(std::vector<std::string>{"states",states.name,"Quat","Qr"},std::string("qr(")+states.name+")"));
-    observer.write(*_QI(x,idx),DataAddressing(std::vector<std::string>{"states",states.name,"Quat","Qi"},std::string("qi(")+states.name+")"));
-    observer.write(*_QJ(x,idx),DataAddressing(std::vector<std::string>{"states",states.name,"Quat","Qj"},std::string("qj(")+states.name+")"));
-    observer.write(*_QK(x,idx),DataAddressing(std::vector<std::string>{"states",states.name,"Quat","Qk"},std::string("qk(")+states.name+")"));
+    if (states_addressing.empty()) states_addressing = get_states_addressing(states.name);
+    observer.write(*_X(x,idx), states_addressing[0]);
+    observer.write(*_Y(x,idx), states_addressing[1]);
+    observer.write(*_Z(x,idx), states_addressing[2]);
+    observer.write(*_U(x,idx), states_addressing[3]);
+    observer.write(*_V(x,idx), states_addressing[4]);
+    observer.write(*_W(x,idx), states_addressing[5]);
+    observer.write(*_P(x,idx), states_addressing[6]);
+    observer.write(*_Q(x,idx), states_addressing[7]);
+    observer.write(*_R(x,idx), states_addressing[8]);
+    observer.write(*_QR(x,idx),states_addressing[9]);
+    observer.write(*_QI(x,idx),states_addressing[10]);
+    observer.write(*_QJ(x,idx),states_addressing[11]);
+    observer.write(*_QK(x,idx),states_addressing[12]);
     const auto angles = get_angles(x, c);
-    observer.write(angles.phi, DataAddressing(std::vector<std::string>{"states",states.name,"PHI"},std::string("phi(")+states.name+")"));
-    observer.write(angles.theta, DataAddressing(std::vector<std::string>{"states",states.name,"THETA"},std::string("theta(")+states.name+")"));
-    observer.write(angles.psi, DataAddressing(std::vector<std::string>{"states",states.name,"PSI"},std::string("psi(")+states.name+")"));
+    observer.write(angles.phi, states_addressing[13]);
+    observer.write(angles.theta, states_addressing[14]);
+    observer.write(angles.psi, states_addressing[15]);
 }
 
-std::string Body::get_name() const
+const std::string& Body::get_name() const
 {
     return states.name;
 }
@@ -216,6 +258,39 @@ void Body::set_states_history(const AbstractStates<History>& s)
     states = s;
 }
 
+void append(History& history, const History& new_values, const std::string& state_name);
+void append(History& history, const History& new_values, const std::string& state_name)
+{
+    if (new_values.is_empty()) return;
+    const double t0 = new_values[0].first;
+    if (not(history.is_empty()) and (t0 < history.get_current_time()) and not(almost_equal(t0, history.get_current_time())))
+    {
+        THROW(__PRETTY_FUNCTION__, InvalidInputException, "Cannot append values to the history of state '" << state_name << "': the first new value is at t = " << t0
+              << " s, but the history already goes up to t = " << history.get_current_time() << " s");
+    }
+    for (size_t i = 0 ; i < new_values.size() ; ++i)
+    {
+        history.record(new_values[(int)i].first, new_values[(int)i].second);
+    }
+}
+
+void Body::append_states_history(const AbstractStates<History>& s)
+{
+    append(states.x, s.x, "x");
+    append(states.y, s.y, "y");
+    append(states.z, s.z, "z");
+    append(states.u, s.u, "u");
+    append(states.v, s.v, "v");
+    append(states.w, s.w, "w");
+    append(states.p, s.p, "p");
+    append(states.q, s.q, "q");
+    append(states.r, s.r, "r");
+    append(states.qr, s.qr, "qr");
+    append(states.qi, s.qi, "qi");
+    append(states.qj, s.qj, "qj");
+    append(states.qk, s.qk, "qk");
+}
+
 void Body::reset_history()
 {
     states.x.reset();
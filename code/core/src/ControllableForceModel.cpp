@@ -24,7 +24,10 @@ ControllableForceModel::ControllableForceModel(const std::string& name_, const s
     body_name(body_name_),
     position_of_frame(internal_frame),
     latest_force_in_body_frame(),
-    from_internal_frame_to_a_known_frame(make_transform(position_of_frame, name, env.rot))
+    from_internal_frame_to_a_known_frame(make_transform(position_of_frame, name, env.rot)),
+    addressing_in_body_frame(wrench_addressing(name, body_name, body_name)),
+    addressing_in_internal_frame(wrench_addressing(name, body_name, name)),
+    addressing_in_ned_frame(wrench_addressing(name, body_name, "NED"))
 {
     env.k->add(from_internal_frame_to_a_known_frame);
 }
@@ -121,26 +124,26 @@ void ControllableForceModel::feed(Observer& observer, ssc::kinematics::Kinematic
     const auto force_in_ned_frame_at_O = rot_from_body_frame_to_ned*tau_in_body_frame_at_G.force;
     const auto torque_in_ned_frame_at_O = rot_from_body_frame_to_ned*(tau_in_body_frame_at_G.torque+OG.cross(tau_in_body_frame_at_G.force));;
 
-    observer.write(tau_in_body_frame_at_G.X(),DataAddressing(std::vector<std::string>{"efforts",body_name,name,body_name,"Fx"},std::string("Fx(")+name+","+body_name+","+body_name+")"));
-    observer.write(tau_in_body_frame_at_G.Y(),DataAddressing(std::vector<std::string>{"efforts",body_name,name,body_name,"Fy"},std::string("Fy(")+name+","+body_name+","+body_name+")"));
-    observer.write(tau_in_body_frame_at_G.Z(),DataAddressing(std::vector<std::string>{"efforts",body_name,name,body_name,"Fz"},std::string("Fz(")+name+","+body_name+","+body_name+")"));
-    observer.write(tau_in_body_frame_at_G.K(),DataAddressing(std::vector<std::string>{"efforts",body_name,name,body_name,"Mx"},std::string("Mx(")+name+","+body_name+","+body_name+")"));
-    observer.write(tau_in_body_frame_at_G.M(),DataAddressing(std::vector<std::string>{"efforts",body_name,name,body_name,"My"},std::string("My(")+name+","+body_name+","+body_name+")"));
-    observer.write(tau_in_body_frame_at_G.N(),DataAddressing(std::vector<std::string>{"efforts",body_name,name,body_name,"Mz"},std::string("Mz(")+name+","+body_name+","+body_name+")"));
-
-    observer.write((double)force_in_internal_frame_at_P(0),DataAddressing(std::vector<std::string>{"efforts",body_name,name,name,"Fx"},std::string("Fx(")+name+","+body_name+","+name+")"));
-    observer.write((double)force_in_internal_frame_at_P(1),DataAddressing(std::vector<std::string>{"efforts",body_name,name,name,"Fy"},std::string("Fy(")+name+","+body_name+","+name+")"));
-    observer.write((double)force_in_internal_frame_at_P(2),DataAddressing(std::vector<std::string>{"efforts",body_name,name,name,"Fz"},std::string("Fz(")+name+","+body_name+","+name+")"));
-    observer.write((double)torque_in_internal_frame_at_P(0),DataAddressing(std::vector<std::string>{"efforts",body_name,name,name,"Mx"},std::string("Mx(")+name+","+body_name+","+name+")"));
-    observer.write((double)torque_in_internal_frame_at_P(1),DataAddressing(std::vector<std::string>{"efforts",body_name,name,name,"My"},std::string("My(")+name+","+body_name+","+name+")"));
-    observer.write((double)torque_in_internal_frame_at_P(2),DataAddressing(std::vector<std::string>{"efforts",body_name,name,name,"Mz"},std::string("Mz(")+name+","+body_name+","+name+")"));
-
-    observer.write((double)force_in_ned_frame_at_O(0),DataAddressing(std::vector<std::string>{"efforts",body_name,name,"NED","Fx"},std::string("Fx(")+name+","+body_name+",NED)"));
-    observer.write((double)force_in_ned_frame_at_O(1),DataAddressing(std::vector<std::string>{"efforts",body_name,name,"NED","Fy"},std::string("Fy(")+name+","+body_name+",NED)"));
-    observer.write((double)force_in_ned_frame_at_O(2),DataAddressing(std::vector<std::string>{"efforts",body_name,name,"NED","Fz"},std::string("Fz(")+name+","+body_name+",NED)"));
-    observer.write((double)torque_in_ned_frame_at_O(0),DataAddressing(std::vector<std::string>{"efforts",body_name,name,"NED","Mx"},std::string("Mx(")+name+","+body_name+",NED)"));
-    observer.write((double)torque_in_ned_frame_at_O(1),DataAddressing(std::vector<std::string>{"efforts",body_name,name,"NED","My"},std::string("My(")+name+","+body_name+",NED)"));
-    observer.write((double)torque_in_ned_frame_at_O(2),DataAddressing(std::vector<std::string>{"efforts",body_name,name,"NED","Mz"},std::string("Mz(")+name+","+body_name+",NED)"));
+    observer.write(tau_in_body_frame_at_G.X(),addressing_in_body_frame[0]);
+    observer.write(tau_in_body_frame_at_G.Y(),addressing_in_body_frame[1]);
+    observer.write(tau_in_body_frame_at_G.Z(),addressing_in_body_frame[2]);
+    observer.write(tau_in_body_frame_at_G.K(),addressing_in_body_frame[3]);
+    observer.write(tau_in_body_frame_at_G.M(),addressing_in_body_frame[4]);
+    observer.write(tau_in_body_frame_at_G.N(),addressing_in_body_frame[5]);
+
+    observer.write((double)force_in_internal_frame_at_P(0),addressing_in_internal_frame[0]);
+    observer.write((double)force_in_internal_frame_at_P(1),addressing_in_internal_frame[1]);
+    observer.write((double)force_in_internal_frame_at_P(2),addressing_in_internal_frame[2]);
+    observer.write((double)torque_in_internal_frame_at_P(0),addressing_in_internal_frame[3]);
+    observer.write((double)torque_in_internal_frame_at_P(1),addressing_in_internal_frame[4]);
+    observer.write((double)torque_in_internal_frame_at_P(2),addressing_in_internal_frame[5]);
+
+    observer.write((double)force_in_ned_frame_at_O(0),addressing_in_ned_frame[0]);
+    observer.write((double)force_in_ned_frame_at_O(1),addressing_in_ned_frame[1]);
+    observer.write((double)force_in_ned_frame_at_O(2),addressing_in_ned_frame[2]);
+    observer.write((double)torque_in_ned_frame_at_O(0),addressing_in_ned_frame[3]);
+    observer.write((double)torque_in_ned_frame_at_O(1),addressing_in_ned_frame[4]);
+    observer.write((double)torque_in_ned_frame_at_O(2),addressing_in_ned_frame[5]);
     extra_observations(observer);
 }
 
@@ -44,9 +44,10 @@ std::vector<double> DefaultSurfaceElevation::dynamic_pressure(const double,
     return std::vector<double>(x.size(), 0);
 }
 
-std::vector<FlatDiscreteDirectionalWaveSpectrum> DefaultSurfaceElevation::get_flat_directional_spectra(const double, const double, const double) const
+FlatDiscreteDirectionalWaveSpectraPtr DefaultSurfaceElevation::get_flat_directional_spectra(const double, const double, const double) const
 {
-    return std::vector<FlatDiscreteDirectionalWaveSpectrum>();
+    static const FlatDiscreteDirectionalWaveSpectraPtr no_spectra(new std::vector<FlatDiscreteDirectionalWaveSpectrum>());
+    return no_spectra;
 }
 
 std::vector<DiscreteDirectionalWaveSpectrum> DefaultSurfaceElevation::get_directional_spectra(const double, const double, const double) const
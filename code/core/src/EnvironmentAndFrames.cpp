@@ -19,7 +19,8 @@ EnvironmentAndFrames::EnvironmentAndFrames() : w(),
                                                rho(0),
                                                nu(0),
                                                g(0),
-                                               rot()
+                                               rot(),
+                                               thread_pool()
 {
     if (rho<0.0)
     {
@@ -13,7 +13,9 @@ ForceModel::ForceModel(const std::string& force_name_, const std::string& body_n
     force_name(force_name_),
     body_name(body_name_),
     force_in_body_frame(),
-    force_in_ned_frame()
+    force_in_ned_frame(),
+    addressing_in_body_frame(wrench_addressing(force_name, body_name, body_name)),
+    addressing_in_ned_frame(wrench_addressing(force_name, body_name, "NED"))
 {
 }
 
@@ -51,19 +53,19 @@ ssc::kinematics::Wrench ForceModel::get_force_in_ned_frame() const
 
 void ForceModel::feed(Observer& observer) const
 {
-    observer.write(force_in_body_frame.X(),DataAddressing(std::vector<std::string>{"efforts",body_name,force_name,body_name,"Fx"},std::string("Fx(")+force_name+","+body_name+","+body_name+")"));
-    observer.write(force_in_body_frame.Y(),DataAddressing(std::vector<std::string>{"efforts",body_name,force_name,body_name,"Fy"},std::string("Fy(")+force_name+","+body_name+","+body_name+")"));
-    observer.write(force_in_body_frame.Z(),DataAddressing(std::vector<std::string>{"efforts",body_name,force_name,body_name,"Fz"},std::string("Fz(")+force_name+","+body_name+","+body_name+")"));
-    observer.write(force_in_body_frame.K(),DataAddressing(std::vector<std::string>{"efforts",body_name,force_name,body_name,"Mx"},std::string("Mx(")+force_name+","+body_name+","+body_name+")"));
-    observer.write(force_in_body_frame.M(),DataAddressing(std::vector<std::string>{"efforts",body_name,force_name,body_name,"My"},std::string("My(")+force_name+","+body_name+","+body_name+")"));
-    observer.write(force_in_body_frame.N(),DataAddressing(std::vector<std::string>{"efforts",body_name,force_name,body_name,"Mz"},std::string("Mz(")+force_name+","+body_name+","+body_name+")"));
+    observer.write(force_in_body_frame.X(),addressing_in_body_frame[0]);
+    observer.write(force_in_body_frame.Y(),addressing_in_body_frame[1]);
+    observer.write(force_in_body_frame.Z(),addressing_in_body_frame[2]);
+    observer.write(force_in_body_frame.K(),addressing_in_body_frame[3]);
+    observer.write(force_in_body_frame.M(),addressing_in_body_frame[4]);
+    observer.write(force_in_body_frame.N(),addressing_in_body_frame[5]);
 
-    observer.write(force_in_ned_frame.X(),DataAddressing(std::vector<std::string>{"efforts",body_name,force_name,"NED","Fx"},std::string("Fx(")+force_name+","+body_name+",NED)"));
-    observer.write(force_in_ned_frame.Y(),DataAddressing(std::vector<std::string>{"efforts",body_name,force_name,"NED","Fy"},std::string("Fy(")+force_name+","+body_name+",NED)"));
-    observer.write(force_in_ned_frame.Z(),DataAddressing(std::vector<std::string>{"efforts",body_name,force_name,"NED","Fz"},std::string("Fz(")+force_name+","+body_name+",NED)"));
-    observer.write(force_in_ned_frame.K(),DataAddressing(std::vector<std::string>{"efforts",body_name,force_name,"NED","Mx"},std::string("Mx(")+force_name+","+body_name+",NED)"));
-    observer.write(force_in_ned_frame.M(),DataAddressing(std::vector<std::string>{"efforts",body_name,force_name,"NED","My"},std::string("My(")+force_name+","+body_name+",NED)"));
-    observer.write(force_in_ned_frame.N(),DataAddressing(std::vector<std::string>{"efforts",body_name,force_name,"NED","Mz"},std::string("Mz(")+force_name+","+body_name+",NED)"));
+    observer.write(force_in_ned_frame.X(),addressing_in_ned_frame[0]);
+    observer.write(force_in_ned_frame.Y(),addressing_in_ned_frame[1]);
+    observer.write(force_in_ned_frame.Z(),addressing_in_ned_frame[2]);
+    observer.write(force_in_ned_frame.K(),addressing_in_ned_frame[3]);
+    observer.write(force_in_ned_frame.M(),addressing_in_ned_frame[4]);
+    observer.write(force_in_ned_frame.N(),addressing_in_ned_frame[5]);
     extra_observations(observer);
 }
 
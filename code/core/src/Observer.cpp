@@ -5,13 +5,62 @@
  *      Author: cady
  */
 
+#include <limits>
+#include <mutex>
+
 #include "Observer.hpp"
 #include "InvalidInputException.hpp"
 #include "Sim.hpp"
 #include "SurfaceElevationGrid.hpp"
 
-Observer::Observer(const std::vector<std::string>& data_) : initialized(false), requested_serializations(data_), serialize(), initialize()
+#define NO_SLOT std::numeric_limits<size_t>::max()
+
+size_t DataAddressing::get_id(const std::string& name)
+{
+    // Shared by all observers (which may live in different threads, eg. for the co-simulation servers)
+    static std::mutex mutex;
+    static std::map<std::string, size_t> name2id;
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto it = name2id.find(name);
+    if (it != name2id.end()) return it->second;
+    const size_t id = name2id.size();
+    name2id[name] = id;
+    return id;
+}
+
+std::vector<DataAddressing> wrench_addressing(const std::string& force_name, const std::string& body_name, const std::string& frame)
+{
+    const std::string suffix = std::string("(") + force_name + "," + body_name + "," + frame + ")";
+    std::vector<DataAddressing> ret;
+    for (const std::string component:{"Fx", "Fy", "Fz", "Mx", "My", "Mz"})
+    {
+        ret.push_back(DataAddressing(std::vector<std::string>{"efforts",body_name,force_name,frame,component},component+suffix));
+    }
+    return ret;
+}
+
+Observer::Observer(const std::vector<std::string>& data_) : initialized(false), requested_serializations(data_), requested_serializers(), serialize(), initialize(), id2slot(), slots()
+{
+}
+
+void Observer::write(const double val, const DataAddressing& address)
 {
+    if (address.id >= id2slot.size()) id2slot.resize(address.id+1, NO_SLOT);
+    size_t& slot = id2slot[address.id];
+    if (slot == NO_SLOT)
+    {
+        slot = slots.size();
+        slots.push_back(val);
+        initialize[address.name] = get_initializer(slots.back(), address);
+        serialize[address.name] = get_serializer(slots.back(), address);
+    }
+    slots[slot] = val;
+}
+
+void Observer::write(const SurfaceElevationGrid& val, const DataAddressing& address)
+{
+    initialize[address.name] = get_initializer(val, address);
+    serialize[address.name] = get_serializer(val, address);
 }
 
 std::function<void()> Observer::get_serializer(const SurfaceElevationGrid& , const DataAddressing& )
@@ -28,12 +77,15 @@ void Observer::before_write()
 {
 }
 
+const DataAddressing time_addressing(std::vector<std::string>(1,"t"), "t");
+
 void Observer::observe(const Sim& sys, const double t)
 {
-    write(t, DataAddressing(std::vector<std::string>(1,"t"), "t"));
+    write(t, time_addressing);
     sys.output(sys.state,*this, t);
     initialize_serialization_of_requested_variables(requested_serializations);
-    serialize_requested_variables(requested_serializations);
+    if (requested_serializers.size() != requested_serializations.size()) requested_serializers = get_serializers(requested_serializations);
+    serialize_variables(requested_serializers);
 }
 
 std::vector<std::string> all_variables(std::map<std::string, std::function<void()> >& map);
@@ -46,11 +98,11 @@ std::vector<std::string> all_variables(std::map<std::string, std::function<void(
 
 void Observer::observe_everything(const Sim& sys, const double t)
 {
-    write(t, DataAddressing(std::vector<std::string>(1,"t"), "t"));
+    write(t, time_addressing);
     sys.output(sys.state,*this, t);
     const auto all_vars = all_variables(initialize);
     initialize_serialization_of_requested_variables(all_vars);
-    serialize_requested_variables(all_vars);
+    serialize_variables(get_serializers(all_vars));
 }
 
 void Observer::initialize_serialization_of_requested_variables(const std::vector<std::string>& variables_to_serialize)
@@ -75,11 +127,12 @@ void Observer::initialize_serialization_of_requested_variables(const std::vector
     initialized = true;
 }
 
-void Observer::serialize_requested_variables(const std::vector<std::string>& variables_to_serialize)
+Observer::Serializers Observer::get_serializers(const std::vector<std::string>& variables_to_serialize)
 {
-    const size_t n = variables_to_serialize.size();
-    size_t i = 0;
-    before_write();
+    // Elements of a std::map are never moved, so these pointers remain valid (even though
+    // non-scalar variables' serializers are replaced at each time step)
+    Serializers ret;
+    ret.reserve(variables_to_serialize.size());
     for (auto variable_name:variables_to_serialize)
     {
         auto serialization_functor = serialize.find(variable_name);
@@ -87,9 +140,19 @@ void Observer::serialize_requested_variables(const std::vector<std::string>& var
         {
             THROW(__PRETTY_FUNCTION__, InvalidInputException, "In the 'outputs' section of the YAML file, you asked for '" << variable_name << "', but it is not computed: maybe it is misspelt or the corresponding model is not in the YAML.");
         }
-        serialization_functor->second();
+        ret.push_back(&serialization_functor->second);
+    }
+    return ret;
+}
+
+void Observer::serialize_variables(const Serializers& serializers)
+{
+    const size_t n = serializers.size();
+    before_write();
+    for (size_t i = 0 ; i < n ; ++i)
+    {
+        (*serializers[i])();
         if (i<(n-1)) flush_value_during_write();
-        ++i;
     }
     flush_after_write();
 }
@@ -27,49 +27,65 @@ class Sim::Impl
              const EnvironmentAndFrames& env_,
              const StateType& x,
              const ssc::data_source::DataSource& command_listener_) :
-                 bodies(bodies_), name2bodyptr(), forces(), controlled_forces(), env(env_),
-                 _dx_dt(StateType(x.size(),0)), command_listener(command_listener_), sum_of_forces_in_body_frame(),
-                 sum_of_forces_in_NED_frame()
+                 bodies(bodies_), name2idx(), forces(forces_), controlled_forces(controlled_forces_), env(env_),
+                 _dx_dt(StateType(x.size(),0)), command_listener(command_listener_), sum_of_forces_in_body_frame(bodies_.size()),
+                 sum_of_forces_in_NED_frame(bodies_.size()), sum_of_forces_addressing_in_body_frame(),
+                 sum_of_forces_addressing_in_NED_frame(), blocked_states_addressing()
         {
-            size_t i = 0;
-            for (auto body:bodies)
+            if ((forces.size() != bodies.size()) or (controlled_forces.size() != bodies.size()))
             {
-                forces[body->get_name()] = forces_.at(i);
-                controlled_forces[body->get_name()] = controlled_forces_.at(i++);
-                name2bodyptr[body->get_name()] = body;
+                THROW(__PRETTY_FUNCTION__, InternalErrorException, "Got " << bodies.size() << " bodies but " << forces.size() << " lists of forces & " << controlled_forces.size() << " lists of controlled forces");
+            }
+            for (size_t i = 0 ; i < bodies.size() ; ++i)
+            {
+                const std::string& body_name = bodies[i]->get_name();
+                name2idx[body_name] = i;
+                sum_of_forces_addressing_in_body_frame.push_back(wrench_addressing("sum of forces", body_name, body_name));
+                sum_of_forces_addressing_in_NED_frame.push_back(wrench_addressing("sum of forces", body_name, "NED"));
+                blocked_states_addressing.push_back(wrench_addressing("blocked states", body_name, body_name));
             }
         }
 
-        void feed_sum_of_forces(Observer& observer, const std::string& body_name)
+        void feed_sum_of_forces(Observer& observer, const size_t body_idx)
         {
-            feed_sum_of_forces(observer, sum_of_forces_in_body_frame[body_name], body_name, body_name);
-            feed_sum_of_forces(observer, sum_of_forces_in_NED_frame[body_name], body_name, "NED");
+            feed(observer, sum_of_forces_in_body_frame[body_idx], sum_of_forces_addressing_in_body_frame.at(body_idx));
+            feed(observer, sum_of_forces_in_NED_frame[body_idx], sum_of_forces_addressing_in_NED_frame.at(body_idx));
         }
 
-        void feed_sum_of_forces(Observer& observer, ssc::kinematics::UnsafeWrench& W, const std::string& body_name, const std::string& frame)
+        void feed(Observer& observer, ssc::kinematics::UnsafeWrench& W, const std::vector<DataAddressing>& addressing)
         {
-            observer.write(W.X(),DataAddressing(std::vector<std::string>{"efforts",body_name,"sum of forces",frame,"Fx"},std::string("Fx(sum of forces,")+body_name+","+frame+")"));
-            observer.write(W.Y(),DataAddressing(std::vector<std::string>{"efforts",body_name,"sum of forces",frame,"Fy"},std::string("Fy(sum of forces,")+body_name+","+frame+")"));
-            observer.write(W.Z(),DataAddressing(std::vector<std::string>{"efforts",body_name,"sum of forces",frame,"Fz"},std::string("Fz(sum of forces,")+body_name+","+frame+")"));
-            observer.write(W.K(),DataAddressing(std::vector<std::string>{"efforts",body_name,"sum of forces",frame,"Mx"},std::string("Mx(sum of forces,")+body_name+","+frame+")"));
-            observer.write(W.M(),DataAddressing(std::vector<std::string>{"efforts",body_name,"sum of forces",frame,"My"},std::string("My(sum of forces,")+body_name+","+frame+")"));
-            observer.write(W.N(),DataAddressing(std::vector<std::string>{"efforts",body_name,"sum of forces",frame,"Mz"},std::string("Mz(sum of forces,")+body_name+","+frame+")"));
+            observer.write(W.X(),addressing[0]);
+            observer.write(W.Y(),addressing[1]);
+            observer.write(W.Z(),addressing[2]);
+            observer.write(W.K(),addressing[3]);
+            observer.write(W.M(),addressing[4]);
+            observer.write(W.N(),addressing[5]);
         }
 
+        // All the following vectors have one element per body (in the same order as 'bodies'): the
+        // body names are only used to build the outputs
         std::vector<BodyPtr> bodies;
-        std::map<std::string,BodyPtr> name2bodyptr;
-        std::map<std::string,std::vector<ForcePtr> > forces;
-        std::map<std::string,std::vector<ControllableForcePtr> > controlled_forces;
+        std::map<std::string,size_t> name2idx; //!< Index of each body in 'bodies' (iterated in alphabetical order for the outputs)
+        std::vector<ListOfForces> forces;
+        std::vector<ListOfControlledForces> controlled_forces;
         EnvironmentAndFrames env;
         StateType _dx_dt;
         ssc::data_source::DataSource command_listener;
-        std::map<std::string,ssc::kinematics::UnsafeWrench> sum_of_forces_in_body_frame;
-        std::map<std::string,ssc::kinematics::UnsafeWrench> sum_of_forces_in_NED_frame;
+        std::vector<ssc::kinematics::UnsafeWrench> sum_of_forces_in_body_frame;
+        std::vector<ssc::kinematics::UnsafeWrench> sum_of_forces_in_NED_frame;
+        std::vector<std::vector<DataAddressing> > sum_of_forces_addressing_in_body_frame;
+        std::vector<std::vector<DataAddressing> > sum_of_forces_addressing_in_NED_frame;
+        std::vector<std::vector<DataAddressing> > blocked_states_addressing;
 };
 
 std::map<std::string,std::vector<ForcePtr> > Sim::get_forces() const
 {
-    return pimpl->forces;
+    std::map<std::string,std::vector<ForcePtr> > ret;
+    for (size_t i = 0 ; i < pimpl->bodies.size() ; ++i)
+    {
+        ret[pimpl->bodies[i]->get_name()] = pimpl->forces[i];
+    }
+    return ret;
 }
 
 std::vector<BodyPtr> Sim::get_bodies() const
@@ -118,10 +134,11 @@ void Sim::operator()(const StateType& x, StateType& dxdt, double t)
 
 void Sim::dx_dt(const StateType& x, StateType& dxdt, const double t)
 {
-    for (auto body: pimpl->bodies)
+    for (size_t i = 0 ; i < pimpl->bodies.size() ; ++i)
     {
+        const BodyPtr& body = pimpl->bodies[i];
         body->update(pimpl->env,x,t);
-        const auto Fext = sum_of_forces(x, body, t);
+        const auto Fext = sum_of_forces(x, i, t);
         body->calculate_state_derivatives(Fext, x, dxdt, t, pimpl->env);
     }
 }
@@ -134,37 +151,40 @@ void Sim::update_continuous_states()
 {
 }
 
-ssc::kinematics::UnsafeWrench Sim::sum_of_forces(const StateType& x, const BodyPtr& body, const double t)
+ssc::kinematics::UnsafeWrench Sim::sum_of_forces(const StateType& x, const size_t body_idx, const double t)
 {
+    const BodyPtr& body = pimpl->bodies[body_idx];
     const Eigen::Vector3d uvw = body->get_uvw(x);
     const Eigen::Vector3d pqr = body->get_pqr(x);
-    const auto states = body->get_states();
-    pimpl->sum_of_forces_in_body_frame[body->get_name()] = ssc::kinematics::UnsafeWrench(coriolis_and_centripetal(states.G,states.solid_body_inertia.get(),uvw, pqr));
-    const auto forces = pimpl->forces[body->get_name()];
-    for (auto force:forces)
+    const auto& states = body->get_states();
+    const std::string& body_name = body->get_name();
+    ssc::kinematics::UnsafeWrench& sum = pimpl->sum_of_forces_in_body_frame[body_idx];
+    sum = ssc::kinematics::UnsafeWrench(coriolis_and_centripetal(states.G,states.solid_body_inertia.get(),uvw, pqr));
+    const auto& forces = pimpl->forces[body_idx];
+    for (const auto& force:forces)
     {
         force->update(states, t);
         const ssc::kinematics::Wrench tau = force->get_force_in_body_frame();
-        if (tau.get_frame() != body->get_name())
+        if (tau.get_frame() != body_name)
         {
-            const ssc::kinematics::Transform T = pimpl->env.k->get(tau.get_frame(), body->get_name());
+            const ssc::kinematics::Transform T = pimpl->env.k->get(tau.get_frame(), body_name);
             const auto t = tau.change_frame_but_keep_ref_point(T);
             const ssc::kinematics::UnsafeWrench tau_body(states.G, t.force, t.torque + (t.get_point()-states.G).cross(t.force));
-            pimpl->sum_of_forces_in_body_frame[body->get_name()] += tau_body;
+            sum += tau_body;
         }
         else
         {
-            pimpl->sum_of_forces_in_body_frame[body->get_name()] += tau;
+            sum += tau;
         }
     }
-    const auto controlled_forces = pimpl->controlled_forces[body->get_name()];
-    for (auto force:controlled_forces)
+    const auto& controlled_forces = pimpl->controlled_forces[body_idx];
+    for (const auto& force:controlled_forces)
     {
         const ssc::kinematics::Wrench tau = force->operator()(states, t, pimpl->command_listener, pimpl->env.k, states.G);
-        pimpl->sum_of_forces_in_body_frame[body->get_name()] += tau;
+        sum += tau;
     }
-    pimpl->sum_of_forces_in_NED_frame[body->get_name()] = ForceModel::project_into_NED_frame(pimpl->sum_of_forces_in_body_frame[body->get_name()],states.get_rot_from_ned_to_body());
-    return pimpl->sum_of_forces_in_body_frame[body->get_name()];
+    pimpl->sum_of_forces_in_NED_frame[body_idx] = ForceModel::project_into_NED_frame(sum,states.get_rot_from_ned_to_body());
+    return sum;
 }
 
 ssc::kinematics::PointMatrix Sim::get_waves(const double t//!< Current instant
@@ -196,35 +216,31 @@ void Sim::output(const StateType& x, Observer& obs, const double t) const
         x_with_forced_states = body->block_states_if_necessary(x,t);
     }
     const auto normalized_x = normalize_quaternions(x_with_forced_states);
-    for (auto forces:pimpl->forces)
+    for (const auto& name_and_idx:pimpl->name2idx)
     {
-        for (auto force:forces.second) force->feed(obs);
+        for (auto force:pimpl->forces[name_and_idx.second]) force->feed(obs);
     }
-    for (auto controlled_forces:pimpl->controlled_forces)
+    for (const auto& name_and_idx:pimpl->name2idx)
     {
-        for (auto force:controlled_forces.second)
+        const auto body = pimpl->bodies[name_and_idx.second];
+        for (auto force:pimpl->controlled_forces[name_and_idx.second])
         {
-            const auto body_name = controlled_forces.first;
-            const auto body = pimpl->name2bodyptr[body_name];
             const auto G = body->get_origin(x);
             force->feed(obs,pimpl->env.k,G);
         }
     }
-    for (auto body:pimpl->bodies)
+    for (size_t i = 0 ; i < pimpl->bodies.size() ; ++i)
     {
+        const auto body = pimpl->bodies[i];
         body->feed(normalized_x, obs, pimpl->env.rot);
-        auto dF = body->get_delta_F(pimpl->_dx_dt,pimpl->sum_of_forces_in_body_frame[body->get_name()]);
-        obs.write((double)dF(0),DataAddressing(std::vector<std::string>{"efforts",body->get_name(),"blocked states",body->get_name(),"Fx"},std::string("Fx(blocked states,")+body->get_name()+","+body->get_name()+")"));
-        obs.write((double)dF(1),DataAddressing(std::vector<std::string>{"efforts",body->get_name(),"blocked states",body->get_name(),"Fy"},std::string("Fy(blocked states,")+body->get_name()+","+body->get_name()+")"));
-        obs.write((double)dF(2),DataAddressing(std::vector<std::string>{"efforts",body->get_name(),"blocked states",body->get_name(),"Fz"},std::string("Fz(blocked states,")+body->get_name()+","+body->get_name()+")"));
-        obs.write((double)dF(3),DataAddressing(std::vector<std::string>{"efforts",body->get_name(),"blocked states",body->get_name(),"Mx"},std::string("Mx(blocked states,")+body->get_name()+","+body->get_name()+")"));
-        obs.write((double)dF(4),DataAddressing(std::vector<std::string>{"efforts",body->get_name(),"blocked states",body->get_name(),"My"},std::string("My(blocked states,")+body->get_name()+","+body->get_name()+")"));
-        obs.write((double)dF(5),DataAddressing(std::vector<std::string>{"efforts",body->get_name(),"blocked states",body->get_name(),"Mz"},std::string("Mz(blocked states,")+body->get_name()+","+body->get_name()+")"));
+        auto dF = body->get_delta_F(pimpl->_dx_dt,pimpl->sum_of_forces_in_body_frame[i]);
+        const auto& addressing = pimpl->blocked_states_addressing.at(i);
+        for (size_t j = 0 ; j < 6 ; ++j) obs.write((double)dF(j),addressing[j]);
     }
     pimpl->env.feed(obs, t, pimpl->bodies, normalized_x);
-    for (auto body:pimpl->bodies)
+    for (size_t i = 0 ; i < pimpl->bodies.size() ; ++i)
     {
-        pimpl->feed_sum_of_forces(obs, body->get_name());
+        pimpl->feed_sum_of_forces(obs, i);
     }
 }
 
@@ -241,6 +257,19 @@ void Sim::set_bodystates(const std::vector<State>& states)
     }
 }
 
+void Sim::append_to_bodystates(const std::vector<State>& states)
+{
+    if(states.size()!=1 or pimpl->bodies.size()!=1)
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "'states' size must be 1");
+    }
+    pimpl->bodies.at(0)->append_states_history(states.at(0));
+    if (not(states.at(0).x.is_empty()))
+    {
+        state = states.at(0).get_StateType(states.at(0).x.size()-1);
+    }
+}
+
 void Sim::set_command_listener(const std::map<std::string, double>& new_commands)
 {
     for(const auto c : new_commands)
@@ -11,6 +11,7 @@
 #include "update_kinematics.hpp"
 #include "stl_reader.hpp"
 #include "BodyBuilder.hpp"
+#include "ThreadPool.hpp"
 
 #include <ssc/text_file_reader.hpp>
 
@@ -24,10 +25,17 @@ SimulatorBuilder::SimulatorBuilder(const YamlSimulatorInput& input_, const doubl
                                         directional_spreading_parsers(TR1(shared_ptr)<std::vector<DirectionalSpreadingBuilderPtr> >(new std::vector<DirectionalSpreadingBuilderPtr>())),
                                         spectrum_parsers(TR1(shared_ptr)<std::vector<SpectrumBuilderPtr> >(new std::vector<SpectrumBuilderPtr>())),
                                         command_listener(command_listener_),
-                                        t0(t0_)
+                                        t0(t0_),
+                                        nb_of_threads(1)
 {
 }
 
+SimulatorBuilder& SimulatorBuilder::set_nb_of_threads(const size_t nb_of_threads_)
+{
+    nb_of_threads = nb_of_threads_;
+    return *this;
+}
+
 std::vector<BodyPtr> SimulatorBuilder::get_bodies(const MeshMap& meshes, const std::vector<bool>& bodies_contain_surface_forces, std::map<std::string,double> history_length) const
 {
     std::vector<BodyPtr> ret;
@@ -67,6 +75,7 @@ EnvironmentAndFrames SimulatorBuilder::get_environment() const
     env.rot = input.rotations;
     env.w = get_wave();
     env.k = ssc::kinematics::KinematicsPtr(new ssc::kinematics::Kinematics());
+    if (nb_of_threads != 1) env.thread_pool.reset(new ThreadPool(nb_of_threads));
     return env;
 }
 
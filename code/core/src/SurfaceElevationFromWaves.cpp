@@ -6,16 +6,29 @@
  */
 
 #include "SurfaceElevationFromWaves.hpp"
+#include "InternalErrorException.hpp"
 
 #include <ssc/exception_handling.hpp>
 
+FlatDiscreteDirectionalWaveSpectraPtr get_flat_spectra(const std::vector<WaveModelPtr>& models);
+FlatDiscreteDirectionalWaveSpectraPtr get_flat_spectra(const std::vector<WaveModelPtr>& models)
+{
+    TR1(shared_ptr)<std::vector<FlatDiscreteDirectionalWaveSpectrum> > ret(new std::vector<FlatDiscreteDirectionalWaveSpectrum>());
+    ret->reserve(models.size());
+    for (const auto& model:models)
+    {
+        ret->push_back(model->get_flat_spectrum());
+    }
+    return ret;
+}
 
 SurfaceElevationFromWaves::SurfaceElevationFromWaves(
         const std::vector<WaveModelPtr>& models_,
         const std::pair<std::size_t,std::size_t> output_mesh_size_,
         const ssc::kinematics::PointMatrixPtr& output_mesh_) :
                 SurfaceElevationInterface(output_mesh_, output_mesh_size_),
-                directional_spectra(models_)
+                directional_spectra(models_),
+                flat_directional_spectra(get_flat_spectra(directional_spectra))
 {
     if(output_mesh_size_.first*output_mesh_size_.second != (std::size_t)output_mesh_->m.cols())
     {
@@ -28,7 +41,8 @@ SurfaceElevationFromWaves::SurfaceElevationFromWaves(
         const std::pair<std::size_t,std::size_t> output_mesh_size_,
         const ssc::kinematics::PointMatrixPtr& output_mesh_) :
                 SurfaceElevationInterface(output_mesh_, output_mesh_size_),
-                directional_spectra(std::vector<WaveModelPtr>(1,model))
+                directional_spectra(std::vector<WaveModelPtr>(1,model)),
+                flat_directional_spectra(get_flat_spectra(directional_spectra))
 {
     if(output_mesh_size_.first*output_mesh_size_.second != (std::size_t)output_mesh_->m.cols())
     {
@@ -55,15 +69,25 @@ std::vector<double> SurfaceElevationFromWaves::wave_height(const std::vector<dou
     return zwave;
 }
 
-std::vector<FlatDiscreteDirectionalWaveSpectrum> SurfaceElevationFromWaves::get_flat_directional_spectra(const double, const double, const double) const
+std::vector<double> SurfaceElevationFromWaves::wave_height_on_grid(const RegularGrid& grid, //!< Nodes at which to compute the elevations (in the NED frame)
+                                                                   const double t           //!< Current instant (in seconds)
+                                                                   ) const
 {
-    std::vector<FlatDiscreteDirectionalWaveSpectrum> ret;
-    ret.reserve(directional_spectra.size());
-    for (const auto& spectrum:directional_spectra)
+    std::vector<double> zwave(grid.nx*grid.ny, 0);
+    for (const auto& directional_spectrum:directional_spectra)
     {
-        ret.push_back(spectrum->get_flat_spectrum());
+        const std::vector<double> wave_heights = directional_spectrum->get_elevation_on_grid(grid, t);
+        for (size_t i = 0; i < zwave.size(); ++i)
+        {
+            zwave[i] += wave_heights.at(i);
+        }
     }
-    return ret;
+    return zwave;
+}
+
+FlatDiscreteDirectionalWaveSpectraPtr SurfaceElevationFromWaves::get_flat_directional_spectra(const double, const double, const double) const
+{
+    return flat_directional_spectra;
 }
 
 std::vector<DiscreteDirectionalWaveSpectrum> SurfaceElevationFromWaves::get_directional_spectra(const double, const double, const double) const
@@ -110,16 +134,34 @@ std::vector<double> SurfaceElevationFromWaves::dynamic_pressure(const double rho
                                                                 const double t                  //!< Current time instant (in seconds)
                                                                 ) const
 {
-    std::vector<double> pdyn(x.size(), 0);
-    for (const auto spectrum : directional_spectra)
+    std::vector<double> pdyn;
+    DynamicPressureWorkspace workspace;
+    fill_dynamic_pressure(rho, g, x, y, z, eta, t, pdyn, workspace);
+    return pdyn;
+}
+
+void SurfaceElevationFromWaves::fill_dynamic_pressure(const double rho,                   //!< water density (in kg/m^3)
+                                                      const double g,                     //!< gravity (in m/s^2)
+                                                      const std::vector<double> &x,       //!< x-positions in the NED frame (in meters)
+                                                      const std::vector<double> &y,       //!< y-positions in the NED frame (in meters)
+                                                      const std::vector<double> &z,       //!< z-positions in the NED frame (in meters)
+                                                      const std::vector<double> &eta,     //!< Wave elevations at (x,y) in the NED frame (in meters)
+                                                      const double t,                     //!< Current time instant (in seconds)
+                                                      std::vector<double>& pdyn,          //!< Output: dynamic pressures (in Pascal)
+                                                      DynamicPressureWorkspace& workspace //!< Scratch vectors of the wave models
+                                                      ) const
+{
+    if (x.size() != y.size() || x.size() != z.size() || x.size() != eta.size())
     {
-        std::vector<double> dynamic_pressure_for_spectrum = spectrum->get_dynamic_pressure(rho, g, x, y, z, eta, t);
-        for (size_t i = 0; i < pdyn.size(); ++i)
-        {
-            pdyn[i] += dynamic_pressure_for_spectrum.at(i);
-        }
+        THROW(__PRETTY_FUNCTION__, InternalErrorException,
+              "Error when calculating dynamic pressure: the x, y, z and eta vectors don't have the same size (size of x: " << x.size()
+                << ", size of y: " << y.size() << ", size of z: " << z.size() << ", size of eta: " << eta.size() << ")");
+    }
+    pdyn.assign(x.size(), 0);
+    for (const auto& spectrum : directional_spectra)
+    {
+        spectrum->add_dynamic_pressure(rho, g, x, y, z, eta, t, pdyn, workspace);
     }
-    return pdyn;
 }
 
 ssc::kinematics::PointMatrix SurfaceElevationFromWaves::orbital_velocity(const double g,                //!< gravity (in m/s^2)
@@ -145,9 +187,6 @@ ssc::kinematics::PointMatrix SurfaceElevationFromWaves::orbital_velocity(const d
 
 void SurfaceElevationFromWaves::serialize_wave_spectra_before_simulation(ObserverPtr& observer) const
 {
-    std::vector<FlatDiscreteDirectionalWaveSpectrum> spectra;
-    spectra.reserve(directional_spectra.size());
-    for (const auto spectrum:directional_spectra) spectra.push_back(spectrum->get_flat_spectrum());
     const DataAddressing address;
-    observer->write_before_simulation(spectra, address);
+    observer->write_before_simulation(*flat_directional_spectra, address);
 }
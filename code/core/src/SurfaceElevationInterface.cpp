@@ -6,8 +6,11 @@
  */
 
 #include "SurfaceElevationInterface.hpp"
+#include "WaveFieldLattice.hpp"
+#include "WaveModel.hpp"
 #include "InternalErrorException.hpp"
 #include <ssc/exception_handling.hpp>
+#include <cmath> // std::abs
 #include <string>
 
 /**
@@ -38,14 +41,66 @@ PointType compute_position_in_NED_frame(
     return P;
 }
 
+DynamicPressureBuffers::DynamicPressureBuffers() : x(), y(), z(), pdyn(), workspace()
+{
+}
+
 SurfaceElevationInterface::SurfaceElevationInterface(
         const ssc::kinematics::PointMatrixPtr& output_mesh_,
         const std::pair<std::size_t,std::size_t>& output_mesh_size_) :
                 output_mesh(output_mesh_),
                 output_mesh_size(output_mesh_size_),
                 relative_wave_height_for_each_point_in_mesh(),
-                surface_elevation_for_each_point_in_mesh()
+                surface_elevation_for_each_point_in_mesh(),
+                lattice()
+{
+}
+
+void SurfaceElevationInterface::use_lattice(const YamlWaveLattice& input)
+{
+    lattice.reset(new WaveFieldLattice(input, *get_flat_directional_spectra(0, 0, 0)));
+}
+
+bool SurfaceElevationInterface::interpolates_dynamic_pressure() const
+{
+    return lattice and lattice->interpolates_pressure();
+}
+
+std::vector<double> subset(const std::vector<double>& v, const std::vector<size_t>& indices);
+std::vector<double> subset(const std::vector<double>& v, const std::vector<size_t>& indices)
+{
+    std::vector<double> ret;
+    ret.reserve(indices.size());
+    for (const auto idx:indices) ret.push_back(v[idx]);
+    return ret;
+}
+
+std::vector<double> SurfaceElevationInterface::interpolated_wave_height(const std::vector<double> &x, const std::vector<double> &y, const double t) const
+{
+    std::vector<double> ret(x.size());
+    const auto model = [this](const std::vector<double>& x_, const std::vector<double>& y_, const double t_){return wave_height(x_, y_, t_);};
+    const std::vector<size_t> outside = lattice->interpolate_elevation(x, y, t, model, ret);
+    if (not(outside.empty()))
+    {
+        const std::vector<double> eta = wave_height(subset(x, outside), subset(y, outside), t);
+        for (size_t i = 0 ; i < outside.size() ; ++i) ret[outside[i]] = eta.at(i);
+    }
+    return ret;
+}
+
+void SurfaceElevationInterface::interpolated_dynamic_pressure(const double rho, const double g, const std::vector<double> &x, const std::vector<double> &y, const std::vector<double> &z,
+                                                              const std::vector<double> &eta, const double t, std::vector<double>& pdyn) const
 {
+    pdyn.resize(x.size());
+    const auto model = [this](const std::vector<double>& x_, const std::vector<double>& y_, const std::vector<double>& z_, const std::vector<double>& eta_, const double t_)
+                             {return dynamic_pressure(1, 1, x_, y_, z_, eta_, t_);};
+    const std::vector<size_t> outside = lattice->interpolate_pressure_head(x, y, z, eta, t, model, pdyn);
+    for (auto& p:pdyn) p *= rho*g;
+    if (not(outside.empty()))
+    {
+        const std::vector<double> p = dynamic_pressure(rho, g, subset(x, outside), subset(y, outside), subset(z, outside), subset(eta, outside), t);
+        for (size_t i = 0 ; i < outside.size() ; ++i) pdyn[outside[i]] = p.at(i);
+    }
 }
 
 SurfaceElevationInterface::~SurfaceElevationInterface()
@@ -126,14 +181,14 @@ double SurfaceElevationInterface::evaluate_rao(
     // dimension of rao_phase & rao_module is the index of the directional spectrum and the
     // second index is the position in the "flattened" (omega,psi) matrix. The RAO's are interpolated
     // at the periods and incidences specified by each wave directional spectrum.
-    const auto directional_spectra = get_flat_directional_spectra(x, y, t);
+    const FlatDiscreteDirectionalWaveSpectraPtr directional_spectra = get_flat_directional_spectra(x, y, t);
     double F = 0;
-    for (size_t spectrum_idx = 0 ; spectrum_idx < directional_spectra.size() ; ++spectrum_idx)
+    for (size_t spectrum_idx = 0 ; spectrum_idx < directional_spectra->size() ; ++spectrum_idx)
     {
-        const std::vector<double> rao_module_for_each_frequency_and_incidence = rao_modules.at(spectrum_idx);
-        const std::vector<double> rao_phase_for_each_frequency_and_incidence = rao_phases.at(spectrum_idx);
+        const std::vector<double>& rao_module_for_each_frequency_and_incidence = rao_modules.at(spectrum_idx);
+        const std::vector<double>& rao_phase_for_each_frequency_and_incidence = rao_phases.at(spectrum_idx);
         const size_t nb_of_omegas_x_nb_of_directions = rao_module_for_each_frequency_and_incidence.size();
-        const auto spectrum = directional_spectra.at(spectrum_idx);
+        const FlatDiscreteDirectionalWaveSpectrum& spectrum = directional_spectra->at(spectrum_idx);
         if (nb_of_omegas_x_nb_of_directions != spectrum.k.size())
         {
             THROW(__PRETTY_FUNCTION__, InternalErrorException, "Number of angular frequencies times number of incidences in HDB RAO is " << nb_of_omegas_x_nb_of_directions << ", which does not match spectrum size (" << spectrum.k.size() << " (omega,psi) pairs)");
@@ -160,6 +215,7 @@ std::vector<double> SurfaceElevationInterface::get_and_check_wave_height(const s
         THROW(__PRETTY_FUNCTION__, InternalErrorException, "Error when calculating surface elevation: the x and y vectors don't have the same size (size of x: "
             << x.size() << ", size of y: " << y.size() << ")");
     }
+    if (lattice) return interpolated_wave_height(x,y,t);
     return wave_height(x,y,t);
 }
 
@@ -187,6 +243,12 @@ std::vector<double> SurfaceElevationInterface::get_and_check_dynamic_pressure(co
         THROW(__PRETTY_FUNCTION__, InternalErrorException, "Error when calculating dynamic pressures: the x and eta vectors don't have the same size (size of x: "
             << x.size() << ", size of eta: " << eta.size() << ")");
     }
+    if (interpolates_dynamic_pressure())
+    {
+        std::vector<double> pdyn;
+        interpolated_dynamic_pressure(rho, g, x, y, z, eta, t, pdyn);
+        return pdyn;
+    }
     return dynamic_pressure(rho, g, x, y, z, eta, t);
 }
 
@@ -240,9 +302,59 @@ std::vector<double> SurfaceElevationInterface::get_dynamic_pressure(
         y.at(i) = OP.m(1, i);
         z.at(i) = OP.m(2, i);
     }
+    if (interpolates_dynamic_pressure())
+    {
+        std::vector<double> pdyn;
+        interpolated_dynamic_pressure(rho, g, x, y, z, eta, t, pdyn);
+        return pdyn;
+    }
     return dynamic_pressure(rho, g, x, y, z, eta, t);
 }
 
+void SurfaceElevationInterface::get_dynamic_pressure(
+    const double rho,                        //!< Water density (in kg/m^3)
+    const double g,                          //!< Gravity (in m/s^2)
+    const ssc::kinematics::PointMatrix& P,   //!< Positions of points P, relative to the centre of the NED frame, but projected in any frame
+    const ssc::kinematics::KinematicsPtr& k, //!< Object used to compute the transforms to the NED frame
+    const std::vector<double>& eta,          //!< Wave elevations at P in the NED frame (in meters)
+    const double t,                          //!< Current instant (in seconds)
+    DynamicPressureBuffers& buffers          //!< Input/output: coordinates of P in the NED frame & dynamic pressures
+    ) const
+{
+    const size_t n = (size_t)P.m.cols();
+    if (n != eta.size())
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException,
+            "Error when calculating dynamic pressure: the vector of positions of points P and the vector of their corresponding wave elevations don't have the same size (size of P: "
+                << n << ", size of eta: " << eta.size() << ")")
+    }
+    const ssc::kinematics::PointMatrix OP = compute_position_in_NED_frame(P, k);
+    buffers.x.resize(n);
+    buffers.y.resize(n);
+    buffers.z.resize(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        buffers.x[i] = OP.m(0, i);
+        buffers.y[i] = OP.m(1, i);
+        buffers.z[i] = OP.m(2, i);
+    }
+    buffers.pdyn.resize(n);
+    if (interpolates_dynamic_pressure())
+    {
+        interpolated_dynamic_pressure(rho, g, buffers.x, buffers.y, buffers.z, eta, t, buffers.pdyn);
+    }
+    else
+    {
+        fill_dynamic_pressure(rho, g, buffers.x, buffers.y, buffers.z, eta, t, buffers.pdyn, buffers.workspace);
+    }
+}
+
+void SurfaceElevationInterface::fill_dynamic_pressure(const double rho, const double g, const std::vector<double> &x, const std::vector<double> &y, const std::vector<double> &z,
+                                                      const std::vector<double> &eta, const double t, std::vector<double>& pdyn, DynamicPressureWorkspace&) const
+{
+    pdyn = dynamic_pressure(rho, g, x, y, z, eta, t);
+}
+
 ssc::kinematics::PointMatrixPtr SurfaceElevationInterface::get_output_mesh_in_NED_frame(
         const ssc::kinematics::KinematicsPtr& k) const
 {
@@ -259,13 +371,46 @@ ssc::kinematics::PointMatrix SurfaceElevationInterface::get_waves_on_mesh(
     return get_points_on_free_surface(t, get_output_mesh_in_NED_frame(k));
 }
 
+/**  \brief Checks whether the points of M are the nodes of a regular grid (x varying fastest) & computes its origin & steps
+  *  \details The steps are computed from the first & last nodes of each axis, then all nodes are checked
+  *           (up to the rounding errors made when building the mesh & changing its frame).
+  */
+bool is_a_regular_grid(const ssc::kinematics::PointMatrix& M, const size_t nx, const size_t ny, RegularGrid& grid);
+bool is_a_regular_grid(const ssc::kinematics::PointMatrix& M, const size_t nx, const size_t ny, RegularGrid& grid)
+{
+    grid.nx = nx;
+    grid.ny = ny;
+    grid.x0 = M.m(0,0);
+    grid.y0 = M.m(1,0);
+    grid.dx_i = nx > 1 ? (M.m(0,(long)(nx-1)) - grid.x0)/double(nx-1) : 0;
+    grid.dy_i = nx > 1 ? (M.m(1,(long)(nx-1)) - grid.y0)/double(nx-1) : 0;
+    grid.dx_j = ny > 1 ? (M.m(0,(long)(nx*(ny-1))) - grid.x0)/double(ny-1) : 0;
+    grid.dy_j = ny > 1 ? (M.m(1,(long)(nx*(ny-1))) - grid.y0)/double(ny-1) : 0;
+    const double eps = 1E-9*(1 + std::abs(grid.x0) + std::abs(grid.y0)
+                               + double(nx)*(std::abs(grid.dx_i) + std::abs(grid.dy_i))
+                               + double(ny)*(std::abs(grid.dx_j) + std::abs(grid.dy_j)));
+    std::vector<double> x, y;
+    grid.get_nodes(x, y);
+    for (size_t idx = 0 ; idx < nx*ny ; ++idx)
+    {
+        if (not(std::abs(M.m(0,(long)idx) - x[idx]) <= eps) or not(std::abs(M.m(1,(long)idx) - y[idx]) <= eps)) return false;
+    }
+    return true;
+}
+
+std::vector<double> SurfaceElevationInterface::wave_height_on_grid(const RegularGrid& grid, const double t) const
+{
+    std::vector<double> x, y;
+    grid.get_nodes(x, y);
+    return wave_height(x, y, t);
+}
+
 SurfaceElevationGrid SurfaceElevationInterface::get_waves_on_mesh_as_a_grid(
         const ssc::kinematics::KinematicsPtr& k,    //!< Object used to compute the transforms to the NED frame
         const double t                              //!< Current instant (in seconds)
         ) const
 {
-    ssc::kinematics::PointMatrix res = get_waves_on_mesh(k,t);
-    const size_t nPoints = (size_t)res.m.cols();
+    const size_t nPoints = (size_t)output_mesh->m.cols();
     if (nPoints==0) return SurfaceElevationGrid(t);
     const size_t nx = output_mesh_size.first;
     const size_t ny = output_mesh_size.second;
@@ -279,21 +424,42 @@ SurfaceElevationGrid SurfaceElevationInterface::get_waves_on_mesh_as_a_grid(
            <<" For example, if one declares a 'no waves' model, one should not have an 'output' section"<<std::endl;
         THROW(__PRETTY_FUNCTION__, ssc::exception_handling::Exception,ss.str());
     }
+    const ssc::kinematics::PointMatrixPtr Mned = get_output_mesh_in_NED_frame(k);
+    RegularGrid grid;
+    std::vector<double> zwave;
+    if (not(lattice) and is_a_regular_grid(*Mned, nx, ny, grid))
+    {
+        zwave = wave_height_on_grid(grid, t);
+        if (zwave.size() != nPoints)
+        {
+            THROW(__PRETTY_FUNCTION__, InternalErrorException, "Expected " << nPoints << " wave heights on the regular grid but got " << zwave.size());
+        }
+    }
+    else
+    {
+        std::vector<double> x(nPoints), y(nPoints);
+        for (size_t i = 0; i < nPoints; ++i)
+        {
+            x[i] = (double)Mned->m(0, (long)i);
+            y[i] = (double)Mned->m(1, (long)i);
+        }
+        zwave = get_and_check_wave_height(x, y, t);
+    }
     SurfaceElevationGrid s(nx,ny,t);
     for(long i=0;i<(long)nx;++i)
     {
-        s.x(i) = res.m(0,i);
+        s.x(i) = Mned->m(0,i);
     }
     for(long j=0; j<(long)ny; ++j)
     {
-        s.y(j) = res.m(1,j*((long)nx));
+        s.y(j) = Mned->m(1,j*((long)nx));
     }
     long idx = 0;
     for(long j=0;j<(long)ny;++j)
     {
         for(long i = 0;i<(long)nx;++i)
         {
-            s.z(i,j) = res.m(2,idx++);
+            s.z(i,j) = zwave[(size_t)idx++];
         }
     }
     return s;
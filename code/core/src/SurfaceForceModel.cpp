@@ -5,8 +5,12 @@
  *      Author: cady
  */
 
+#include <algorithm> // std::min, std::max
+#include <array>
+
 #include "BodyStates.hpp"
 #include "SurfaceForceModel.hpp"
+#include "ThreadPool.hpp"
 
 SurfaceForceModel::SurfaceForceModel(const std::string& name_, const std::string& body_name_, const EnvironmentAndFrames& env_) : ForceModel(name_, body_name_),
         env(env_),
@@ -19,35 +23,76 @@ SurfaceForceModel::~SurfaceForceModel()
 {
 }
 
+// Below that, splitting the loop on the facets costs more than it saves
+#define MIN_NB_OF_FACETS_PER_CHUNK 256
+
+typedef std::function<SurfaceForceModel::DF(const FacetIterator &,
+                                            const size_t,
+                                            const EnvironmentAndFrames &,
+                                            const BodyStates &,
+                                            const double)> DFFunction;
+typedef std::array<double,6> PartialWrench;
+
+size_t get_nb_of_chunks(const TR1(shared_ptr)<ThreadPool>& thread_pool, const size_t nb_of_facets);
+size_t get_nb_of_chunks(const TR1(shared_ptr)<ThreadPool>& thread_pool, const size_t nb_of_facets)
+{
+    if (not(thread_pool)) return 1;
+    return std::max((size_t)1, std::min(thread_pool->get_nb_of_threads(), nb_of_facets/MIN_NB_OF_FACETS_PER_CHUNK));
+}
+
+PartialWrench sum_of_elementary_wrenches(const DFFunction& dF_lambda, const FacetIterator& begin, const size_t first_facet, const size_t last_facet,
+                                         const EnvironmentAndFrames& env, const BodyStates& states, const double t);
+PartialWrench sum_of_elementary_wrenches(const DFFunction& dF_lambda, const FacetIterator& begin, const size_t first_facet, const size_t last_facet,
+                                         const EnvironmentAndFrames& env, const BodyStates& states, const double t)
+{
+    const double orientation_factor = states.intersector->mesh->orientation_factor;
+    PartialWrench F = {{0,0,0,0,0,0}};
+    auto that_facet = begin + first_facet;
+    for (size_t facet_index = first_facet ; facet_index < last_facet ; ++facet_index, ++that_facet)
+    {
+        const SurfaceForceModel::DF f = dF_lambda(that_facet, facet_index, env, states, t);
+        const double x = (f.C(0)-states.G.v(0));
+        const double y = (f.C(1)-states.G.v(1));
+        const double z = (f.C(2)-states.G.v(2));
+        F[0] += orientation_factor*f.dF(0);
+        F[1] += orientation_factor*f.dF(1);
+        F[2] += orientation_factor*f.dF(2);
+        F[3] += orientation_factor*(y*f.dF(2)-z*f.dF(1));
+        F[4] += orientation_factor*(z*f.dF(0)-x*f.dF(2));
+        F[5] += orientation_factor*(x*f.dF(1)-y*f.dF(0));
+    }
+    return F;
+}
+
 ssc::kinematics::Wrench SurfaceForceModel::operator()(const BodyStates& states, const double t) const
 {
     zg_calculator->update_transform(env.k->get("NED", states.name));
     ssc::kinematics::UnsafeWrench F(states.G);
-    const double orientation_factor = states.intersector->mesh->orientation_factor;
 
     const auto b = begin(states.intersector);
     const auto e = end(states.intersector);
-    std::function<SurfaceForceModel::DF(const FacetIterator &,
-                                        const size_t,
-                                        const EnvironmentAndFrames &,
-                                        const BodyStates &,
-                                        const double)> dF_lambda =
-        get_dF(b, e, env, states, t);
-    
-    size_t facet_index = 0;
-    for (auto that_facet = begin(states.intersector) ; that_facet != e ; ++that_facet)
+    const DFFunction dF_lambda = get_dF(b, e, env, states, t);
+
+    // The facets are split in contiguous chunks (which only depend on the number of facets &
+    // the number of threads) & the partial sums are added in the order of the chunks:
+    // the result does not depend on the way the threads are scheduled.
+    const size_t nb_of_facets = e - b;
+    const size_t nb_of_chunks = get_nb_of_chunks(env.thread_pool, nb_of_facets);
+    std::vector<PartialWrench> partial_wrenches(nb_of_chunks);
+    const auto sum_chunk = [&](const size_t chunk)
+        {
+            partial_wrenches[chunk] = sum_of_elementary_wrenches(dF_lambda, b, chunk*nb_of_facets/nb_of_chunks, (chunk+1)*nb_of_facets/nb_of_chunks, env, states, t);
+        };
+    if (nb_of_chunks == 1) sum_chunk(0);
+    else                   env.thread_pool->run(nb_of_chunks, sum_chunk);
+    for (const auto& partial_wrench:partial_wrenches)
     {
-        const DF f = dF_lambda(that_facet, facet_index, env, states, t);
-        const double x = (f.C(0)-states.G.v(0));
-        const double y = (f.C(1)-states.G.v(1));
-        const double z = (f.C(2)-states.G.v(2));
-        F.X() += orientation_factor*f.dF(0);
-        F.Y() += orientation_factor*f.dF(1);
-        F.Z() += orientation_factor*f.dF(2);
-        F.K() += orientation_factor*(y*f.dF(2)-z*f.dF(1));
-        F.M() += orientation_factor*(z*f.dF(0)-x*f.dF(2));
-        F.N() += orientation_factor*(x*f.dF(1)-y*f.dF(0));
-        ++facet_index;
+        F.X() += partial_wrench[0];
+        F.Y() += partial_wrench[1];
+        F.Z() += partial_wrench[2];
+        F.K() += partial_wrench[3];
+        F.M() += partial_wrench[4];
+        F.N() += partial_wrench[5];
     }
     return F;
 }
@@ -0,0 +1,109 @@
+/*
+ * ThreadPool.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: cady
+ */
+
+#include <algorithm> // std::max
+
+#include "ThreadPool.hpp"
+
+size_t get_nb_of_threads_to_use(const size_t nb_of_threads)
+{
+    if (nb_of_threads > 0) return nb_of_threads;
+    // hardware_concurrency returns zero if the number of cores can't be determined
+    return std::max((size_t)1, (size_t)std::thread::hardware_concurrency());
+}
+
+ThreadPool::ThreadPool(const size_t nb_of_threads_) :
+        nb_of_threads(get_nb_of_threads_to_use(nb_of_threads_)),
+        run_mutex(),
+        mutex(),
+        job_available(),
+        job_done(),
+        job(nullptr),
+        nb_of_tasks(0),
+        next_task(0),
+        nb_of_completed_tasks(0),
+        generation(0),
+        exception(),
+        stopping(false),
+        workers()
+{
+    // The calling thread is one of the threads
+    for (size_t i = 1 ; i < nb_of_threads ; ++i)
+    {
+        workers.push_back(std::thread(&ThreadPool::work, this));
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    job_available.notify_all();
+    for (auto& worker:workers) worker.join();
+}
+
+size_t ThreadPool::get_nb_of_threads() const
+{
+    return nb_of_threads;
+}
+
+void ThreadPool::run_tasks(std::unique_lock<std::mutex>& lock)
+{
+    while (next_task < nb_of_tasks)
+    {
+        const size_t task = next_task++;
+        const Task& f = *job;
+        lock.unlock();
+        std::exception_ptr e;
+        try
+        {
+            f(task);
+        }
+        catch (...)
+        {
+            e = std::current_exception();
+        }
+        lock.lock();
+        if (e and not(exception)) exception = e;
+        if (++nb_of_completed_tasks == nb_of_tasks) job_done.notify_all();
+    }
+}
+
+void ThreadPool::work()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    size_t last_generation = generation;
+    while (true)
+    {
+        job_available.wait(lock, [this,&last_generation]{return stopping or (generation != last_generation);});
+        if (stopping) return;
+        last_generation = generation;
+        run_tasks(lock);
+    }
+}
+
+void ThreadPool::run(const size_t n, const Task& f)
+{
+    std::lock_guard<std::mutex> serialize(run_mutex);
+    std::unique_lock<std::mutex> lock(mutex);
+    job = &f;
+    nb_of_tasks = n;
+    next_task = 0;
+    nb_of_completed_tasks = 0;
+    exception = std::exception_ptr();
+    ++generation;
+    job_available.notify_all();
+    run_tasks(lock);
+    job_done.wait(lock, [this]{return nb_of_completed_tasks == nb_of_tasks;});
+    job = nullptr;
+    const std::exception_ptr e = exception;
+    exception = std::exception_ptr();
+    lock.unlock();
+    if (e) std::rethrow_exception(e);
+}
@@ -0,0 +1,217 @@
+/*
+ * WaveFieldLattice.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: cady
+ */
+
+#include <algorithm> // std::min
+#include <cmath>
+#include <limits>
+
+#include "WaveFieldLattice.hpp"
+#include "discretize.hpp"
+#include "InternalErrorException.hpp"
+#include "InvalidInputException.hpp"
+#include "YamlWaveModelInput.hpp"
+
+WaveFieldLattice::Axis::Axis(const double min_, const double max_, const size_t n_) :
+        min(min_),
+        max(max_),
+        n(n_),
+        delta(n_ > 1 ? (max_-min_)/double(n_-1) : 0)
+{
+}
+
+bool WaveFieldLattice::Axis::contains(const double x) const
+{
+    return (x >= min) and (x <= max); // False if x is NaN
+}
+
+double WaveFieldLattice::Axis::locate(const double x, size_t& i) const
+{
+    const double s = (x-min)/delta;
+    i = std::min((size_t)s, n-2);
+    return s - double(i);
+}
+
+void check_axis(const std::string& name, const double min, const double max, const size_t n);
+void check_axis(const std::string& name, const double min, const double max, const size_t n)
+{
+    if (n < 2)
+    {
+        THROW(__PRETTY_FUNCTION__, InvalidInputException, "The wave lattice should have at least two nodes along the " << name << " axis, but n" << name << " = " << n);
+    }
+    if (not(min < max))
+    {
+        THROW(__PRETTY_FUNCTION__, InvalidInputException, "In the wave lattice, " << name << "min (" << min << " m) should be lower than " << name << "max (" << max << " m)");
+    }
+}
+
+/**  \brief Bound on the second derivatives of the dynamic pressure divided by rho*g, for z >= zmin
+  *  \details The dynamic pressure factors decrease with z, so they are largest at zmin
+  */
+double pressure_curvature(const std::vector<FlatDiscreteDirectionalWaveSpectrum>& spectra, const double zmin);
+double pressure_curvature(const std::vector<FlatDiscreteDirectionalWaveSpectrum>& spectra, const double zmin)
+{
+    double ret = 0;
+    for (const auto& spectrum:spectra)
+    {
+        if (spectrum.stretching.rescales_z())
+        {
+            THROW(__PRETTY_FUNCTION__, InvalidInputException, "The dynamic pressure cannot be interpolated on the wave lattice when the wave stretching is enabled: remove zmin, zmax & nz from the lattice or set h = 0 in the stretching section");
+        }
+        std::vector<double> factors(spectrum.k.size());
+        dynamic_pressure_factors(spectrum, zmin, 0, factors);
+        for (size_t i = 0 ; i < spectrum.k.size() ; ++i) ret += spectrum.a[i]*spectrum.k[i]*spectrum.k[i]*factors[i];
+    }
+    return ret;
+}
+
+WaveFieldLattice::WaveFieldLattice(const YamlWaveLattice& input, const std::vector<FlatDiscreteDirectionalWaveSpectrum>& spectra) :
+        x_axis(input.xmin, input.xmax, input.nx),
+        y_axis(input.ymin, input.ymax, input.ny),
+        z_axis(input.zmin, input.zmax, input.nz),
+        surface_nodes_x(),
+        surface_nodes_y(),
+        volume_nodes_x(),
+        volume_nodes_y(),
+        volume_nodes_z(),
+        elevations(),
+        pressures(),
+        elevation_time(std::numeric_limits<double>::quiet_NaN()),
+        pressure_time(std::numeric_limits<double>::quiet_NaN()),
+        mutex()
+{
+    check_axis("x", input.xmin, input.xmax, input.nx);
+    check_axis("y", input.ymin, input.ymax, input.ny);
+    if (input.nz) check_axis("z", input.zmin, input.zmax, input.nz);
+    if (not(input.tolerance > 0))
+    {
+        THROW(__PRETTY_FUNCTION__, InvalidInputException, "The tolerance of the wave lattice should be strictly positive, but got " << input.tolerance);
+    }
+    // Linear interpolation error on a cell of length h is at most h^2/8 times the second derivative
+    // & the second derivatives of sum(a_i sin(k_i.x + ...)) are bounded by sum(a_i k_i^2)
+    double elevation_curvature = 0;
+    for (const auto& spectrum:spectra)
+    {
+        for (size_t i = 0 ; i < spectrum.k.size() ; ++i) elevation_curvature += spectrum.a[i]*spectrum.k[i]*spectrum.k[i];
+    }
+    const double dxy2 = x_axis.delta*x_axis.delta + y_axis.delta*y_axis.delta;
+    if (dxy2/8*elevation_curvature > input.tolerance)
+    {
+        THROW(__PRETTY_FUNCTION__, InvalidInputException, "The wave lattice is too coarse to interpolate the wave elevation with a tolerance of " << input.tolerance
+              << " m: dx^2 + dy^2 should be lower than " << 8*input.tolerance/elevation_curvature << " m^2 but dx = " << x_axis.delta << " m & dy = " << y_axis.delta << " m");
+    }
+    if (input.nz)
+    {
+        const double dxyz2 = dxy2 + z_axis.delta*z_axis.delta;
+        const double curvature = pressure_curvature(spectra, input.zmin);
+        if (dxyz2/8*curvature > input.tolerance)
+        {
+            THROW(__PRETTY_FUNCTION__, InvalidInputException, "The wave lattice is too coarse to interpolate the dynamic pressure with a tolerance of " << input.tolerance
+                  << " m (pressure divided by rho*g): dx^2 + dy^2 + dz^2 should be lower than " << 8*input.tolerance/curvature << " m^2 but dx = " << x_axis.delta << " m, dy = " << y_axis.delta << " m & dz = " << z_axis.delta << " m");
+        }
+    }
+    for (size_t j = 0 ; j < y_axis.n ; ++j)
+    {
+        for (size_t i = 0 ; i < x_axis.n ; ++i)
+        {
+            surface_nodes_x.push_back(x_axis.min + double(i)*x_axis.delta);
+            surface_nodes_y.push_back(y_axis.min + double(j)*y_axis.delta);
+        }
+    }
+    for (size_t l = 0 ; l < z_axis.n ; ++l)
+    {
+        volume_nodes_x.insert(volume_nodes_x.end(), surface_nodes_x.begin(), surface_nodes_x.end());
+        volume_nodes_y.insert(volume_nodes_y.end(), surface_nodes_y.begin(), surface_nodes_y.end());
+        volume_nodes_z.insert(volume_nodes_z.end(), surface_nodes_x.size(), z_axis.min + double(l)*z_axis.delta);
+    }
+}
+
+bool WaveFieldLattice::interpolates_pressure() const
+{
+    return z_axis.n > 0;
+}
+
+std::vector<size_t> WaveFieldLattice::interpolate_elevation(const std::vector<double>& x, const std::vector<double>& y, const double t,
+                                                            const ElevationModel& model, std::vector<double>& eta)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (t != elevation_time)
+    {
+        elevations = model(surface_nodes_x, surface_nodes_y, t);
+        if (elevations.size() != surface_nodes_x.size())
+        {
+            THROW(__PRETTY_FUNCTION__, InternalErrorException, "Expected " << surface_nodes_x.size() << " wave elevations but got " << elevations.size());
+        }
+        elevation_time = t;
+    }
+    const size_t nx = x_axis.n;
+    std::vector<size_t> outside;
+    for (size_t k = 0 ; k < x.size() ; ++k)
+    {
+        if (x_axis.contains(x[k]) and y_axis.contains(y[k]))
+        {
+            size_t i, j;
+            const double u = x_axis.locate(x[k], i);
+            const double v = y_axis.locate(y[k], j);
+            const double* const e = elevations.data() + i + nx*j;
+            eta[k] = (1-v)*((1-u)*e[0] + u*e[1]) + v*((1-u)*e[nx] + u*e[nx+1]);
+        }
+        else
+        {
+            outside.push_back(k);
+        }
+    }
+    return outside;
+}
+
+std::vector<size_t> WaveFieldLattice::interpolate_pressure_head(const std::vector<double>& x, const std::vector<double>& y, const std::vector<double>& z,
+                                                                const std::vector<double>& eta, const double t, const PressureModel& model, std::vector<double>& p)
+{
+    if (not(interpolates_pressure()))
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "The wave lattice has no z axis: the dynamic pressure cannot be interpolated");
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    if (t != pressure_time)
+    {
+        // All nodes are considered to be under the free surface, so we get a smooth field which we can interpolate
+        const std::vector<double> eta_nodes(volume_nodes_z.size(), z_axis.min);
+        pressures = model(volume_nodes_x, volume_nodes_y, volume_nodes_z, eta_nodes, t);
+        if (pressures.size() != volume_nodes_z.size())
+        {
+            THROW(__PRETTY_FUNCTION__, InternalErrorException, "Expected " << volume_nodes_z.size() << " dynamic pressures but got " << pressures.size());
+        }
+        pressure_time = t;
+    }
+    const size_t nx = x_axis.n;
+    const size_t nxy = x_axis.n*y_axis.n;
+    std::vector<size_t> outside;
+    for (size_t k = 0 ; k < x.size() ; ++k)
+    {
+        if (x_axis.contains(x[k]) and y_axis.contains(y[k]) and z_axis.contains(z[k]) and not(std::isnan(eta[k])))
+        {
+            if (z[k] < eta[k])
+            {
+                p[k] = 0;
+                continue;
+            }
+            size_t i, j, l;
+            const double u = x_axis.locate(x[k], i);
+            const double v = y_axis.locate(y[k], j);
+            const double w = z_axis.locate(z[k], l);
+            const double* const P0 = pressures.data() + i + nx*j + nxy*l;
+            const double* const P1 = P0 + nxy;
+            const double p0 = (1-v)*((1-u)*P0[0] + u*P0[1]) + v*((1-u)*P0[nx] + u*P0[nx+1]);
+            const double p1 = (1-v)*((1-u)*P1[0] + u*P1[1]) + v*((1-u)*P1[nx] + u*P1[nx+1]);
+            p[k] = (1-w)*p0 + w*p1;
+        }
+        else
+        {
+            outside.push_back(k);
+        }
+    }
+    return outside;
+}
@@ -181,6 +181,17 @@ TEST_F(BodyTest, forced_states_are_taken_into_account)
     ASSERT_DOUBLE_EQ(4.5, states.u());
 }
 
+TEST_F(BodyTest, get_states_does_not_copy_the_states)
+{
+    const BodyPtr b = BodyBuilderTest::build_body(1);
+    const BodyStates& states = b->get_states();
+    ASSERT_EQ(&states, &b->get_states());
+    const StateType x = {1,2,3,4,5,6,7,8,9,10,11,12,13,1,2,3,44,5,6,7,8,9,3,5,7,13};
+    b->update_body_states(x, 3.4);
+    ASSERT_DOUBLE_EQ(4.5, states.u());
+    ASSERT_EQ(1, states.u.size());
+}
+
 TEST_F(BodyTest, forced_state_derivatives_are_taken_into_account)
 {
     const StateType x = {1,2,3,4,5,6,7,8,9,10,11,12,13,1,2,3,44,5,6,7,8,9,3,5,7,13};
@@ -210,6 +221,26 @@ TEST_F(BodyTest, forced_state_derivatives_are_taken_into_account)
     ASSERT_DOUBLE_EQ(1./4.2, dx_dt[UIDX(1)]);
 }
 
+TEST_F(BodyTest, position_derivatives_match_the_transform_in_the_kinematics_graph)
+{
+    StateType x = a.random_vector_of<double>().of_size(26).between(-10,10);
+    const double norm = std::hypot(std::hypot(std::hypot(x[QRIDX(1)],x[QIIDX(1)]),x[QJIDX(1)]),x[QKIDX(1)]);
+    x[QRIDX(1)] /= norm;
+    x[QIIDX(1)] /= norm;
+    x[QJIDX(1)] /= norm;
+    x[QKIDX(1)] /= norm;
+    StateType dx_dt(26, 0);
+    EnvironmentAndFrames env;
+    body->update_kinematics(x, env.k);
+    const ssc::kinematics::Wrench sum_of_forces(ssc::kinematics::Point(body->get_name(),0,0,0),Eigen::Vector3d::Zero(),Eigen::Vector3d::Zero());
+    body->calculate_state_derivatives(sum_of_forces, x, dx_dt, a.random<double>(), env);
+    const Eigen::Vector3d uvw = body->get_uvw(x);
+    const Eigen::Vector3d expected = env.k->get("NED", body->get_name()).get_rot()*uvw;
+    ASSERT_NEAR(expected(0), dx_dt[XIDX(1)], EPS);
+    ASSERT_NEAR(expected(1), dx_dt[YIDX(1)], EPS);
+    ASSERT_NEAR(expected(2), dx_dt[ZIDX(1)], EPS);
+}
+
 TEST_F(BodyTest, can_overwrite_history_with_single_value)
 {
     AbstractStates<History> new_states;
@@ -16,6 +16,7 @@
 #include "YamlWaveModelInput.hpp"
 #include "Stretching.hpp"
 #include "InvalidInputException.hpp"
+#include "random_kinematics.hpp"
 #include <ssc/kinematics.hpp>
 #define _USE_MATH_DEFINE
 #include <cmath>
@@ -246,3 +247,202 @@ TEST_F(SurfaceElevationFromWavesTest, dynamic_pressure_plus_hydrostatic)
     ASSERT_NEAR(-rho*g*(cosh(h-1)/cosh(h)), pdyn.at(4), EPS);
     ASSERT_NEAR(rho*g*(1-cosh(h-1)/cosh(h)), phs5 + pdyn.at(4), EPS);
 }
+
+TEST_F(SurfaceElevationFromWavesTest, dynamic_pressure_can_be_computed_in_caller_owned_buffers)
+{
+    ssc::kinematics::KinematicsPtr k(new ssc::kinematics::Kinematics());
+    const std::vector<WaveModelPtr> models({get_model(), get_model(PI/3, 2, 7, 0.5, 30, 0.1, 3, 20)});
+    const SurfaceElevationFromWaves wave(models);
+    const double rho = 1024;
+    const double g = 9.81;
+    DynamicPressureBuffers buffers;
+    const double* pdyn = nullptr;
+    const double* theta = nullptr;
+    for (size_t i = 0 ; i < 10 ; ++i)
+    {
+        // The number of points never increases so the buffers should not be reallocated
+        const size_t n = 20-i;
+        const double t = a.random<double>().between(0, 100);
+        ssc::kinematics::PointMatrix P("NED", n);
+        std::vector<double> eta(n);
+        for (size_t j = 0 ; j < n ; ++j)
+        {
+            P.m(0,(int)j) = a.random<double>().between(-100, 100);
+            P.m(1,(int)j) = a.random<double>().between(-100, 100);
+            P.m(2,(int)j) = a.random<double>().between(-1, 10);
+            eta[j] = a.random<double>().between(-1, 1);
+        }
+        wave.get_dynamic_pressure(rho, g, P, k, eta, t, buffers);
+        ASSERT_EQ(n, buffers.pdyn.size());
+        if (i == 0) pdyn = buffers.pdyn.data();
+        if (i == 0) theta = buffers.workspace.theta.data();
+        ASSERT_EQ(pdyn, buffers.pdyn.data());
+        ASSERT_EQ(theta, buffers.workspace.theta.data());
+        const std::vector<double> p1 = models[0]->get_dynamic_pressure(rho, g, buffers.x, buffers.y, buffers.z, eta, t);
+        const std::vector<double> p2 = models[1]->get_dynamic_pressure(rho, g, buffers.x, buffers.y, buffers.z, eta, t);
+        for (size_t j = 0 ; j < n ; ++j)
+        {
+            ASSERT_EQ(P.m(2,(int)j), buffers.z[j]);
+            ASSERT_DOUBLE_EQ(p1[j]+p2[j], buffers.pdyn[j]);
+        }
+    }
+}
+
+TEST_F(SurfaceElevationFromWavesTest, flat_directional_spectra_are_shared_between_calls)
+{
+    const std::vector<WaveModelPtr> models({get_model(), get_model(PI/3, 2, 7, 0.5, 30, 0.1, 3, 20)});
+    const SurfaceElevationPtr wave(new SurfaceElevationFromWaves(models));
+    const FlatDiscreteDirectionalWaveSpectraPtr spectra = wave->get_flat_directional_spectra(1, 2, 3);
+    ASSERT_EQ(spectra.get(), wave->get_flat_directional_spectra(4, 5, 6).get());
+    ASSERT_EQ(2, spectra->size());
+    for (size_t i = 0 ; i < 2 ; ++i)
+    {
+        const FlatDiscreteDirectionalWaveSpectrum& expected = models[i]->get_flat_spectrum();
+        ASSERT_EQ(expected.a, spectra->at(i).a);
+        ASSERT_EQ(expected.omega, spectra->at(i).omega);
+        ASSERT_EQ(expected.psi, spectra->at(i).psi);
+        ASSERT_EQ(expected.k, spectra->at(i).k);
+        ASSERT_EQ(expected.phase, spectra->at(i).phase);
+    }
+}
+
+TEST_F(SurfaceElevationFromWavesTest, waves_interpolated_on_a_lattice_should_match_direct_evaluation)
+{
+    //! [SurfaceElevationFromWavesTest lattice example]
+    const std::vector<WaveModelPtr> models({get_model(PI/3, 2, 7, 0.5, 30, 0.1, 3, 20), get_model(PI/5, 1, 9, 0.2, 30, 0.1, 3, 20)});
+    const SurfaceElevationPtr direct(new SurfaceElevationFromWaves(models));
+    const SurfaceElevationPtr interpolated(new SurfaceElevationFromWaves(models));
+    YamlWaveLattice lattice;
+    lattice.xmin = -50;
+    lattice.xmax = 50;
+    lattice.nx = 81;
+    lattice.ymin = -50;
+    lattice.ymax = 50;
+    lattice.ny = 81;
+    lattice.zmin = -3;
+    lattice.zmax = 20;
+    lattice.nz = 47;
+    lattice.tolerance = 1E-2;
+    interpolated->use_lattice(lattice);
+    //! [SurfaceElevationFromWavesTest lattice example]
+    const double rho = 1024;
+    const double g = 9.81;
+    for (size_t i = 0 ; i < 10 ; ++i)
+    {
+        const double t = a.random<double>().between(0, 100);
+        // Some points are outside the lattice: they should be evaluated directly
+        const std::vector<double> x = a.random_vector_of<double>().of_size(100).between(-60, 60);
+        const std::vector<double> y = a.random_vector_of<double>().of_size(100).between(-60, 60);
+        const std::vector<double> z = a.random_vector_of<double>().of_size(100).between(-2, 25);
+        const std::vector<double> eta_direct = direct->get_and_check_wave_height(x, y, t);
+        const std::vector<double> eta = interpolated->get_and_check_wave_height(x, y, t);
+        const std::vector<double> pdyn_direct = direct->get_and_check_dynamic_pressure(rho, g, x, y, z, eta_direct, t);
+        const std::vector<double> pdyn = interpolated->get_and_check_dynamic_pressure(rho, g, x, y, z, eta_direct, t);
+        for (size_t j = 0 ; j < x.size() ; ++j)
+        {
+            const bool outside = (std::abs(x[j]) > 50) or (std::abs(y[j]) > 50);
+            if (outside)
+            {
+                ASSERT_DOUBLE_EQ(eta_direct[j], eta[j]);
+                ASSERT_DOUBLE_EQ(pdyn_direct[j], pdyn[j]);
+            }
+            else
+            {
+                ASSERT_NEAR(eta_direct[j], eta[j], lattice.tolerance);
+                ASSERT_NEAR(pdyn_direct[j], pdyn[j], lattice.tolerance*rho*g);
+            }
+        }
+    }
+}
+
+TEST_F(SurfaceElevationFromWavesTest, should_throw_if_the_lattice_is_too_coarse_for_the_tolerance)
+{
+    const SurfaceElevationPtr wave(new SurfaceElevationFromWaves(get_model(PI/3, 2, 7, 0.5, 30, 0.1, 3, 20)));
+    YamlWaveLattice lattice;
+    lattice.xmin = -50;
+    lattice.xmax = 50;
+    lattice.nx = 3;
+    lattice.ymin = -50;
+    lattice.ymax = 50;
+    lattice.ny = 3;
+    lattice.tolerance = 1E-2;
+    ASSERT_THROW(wave->use_lattice(lattice), InvalidInputException);
+    lattice.nx = 51;
+    lattice.ny = 51;
+    ASSERT_NO_THROW(wave->use_lattice(lattice));
+    lattice.zmin = -3;
+    lattice.zmax = 20;
+    lattice.nz = 2;
+    ASSERT_THROW(wave->use_lattice(lattice), InvalidInputException);
+}
+
+TEST_F(SurfaceElevationFromWavesTest, waves_on_a_regular_grid_should_match_direct_summation)
+{
+    //! [SurfaceElevationFromWavesTest regular grid example]
+    const std::vector<WaveModelPtr> models({get_model(PI/3, 2, 7, 0.5, 30, 0.1, 3, 20), get_model(PI/5, 1, 9, 0.2, 30, 0.1, 3, 20)});
+    YamlWaveOutput out;
+    out.frame_of_reference = "body";
+    out.xmin = -40;
+    out.xmax = 60;
+    out.nx = 51;
+    out.ymin = -30;
+    out.ymax = 30;
+    out.ny = 31;
+    const SurfaceElevationFromWaves wave(models, std::make_pair(out.nx, out.ny), SurfaceElevationBuilderInterface::make_wave_mesh(out));
+    ssc::kinematics::KinematicsPtr k(new ssc::kinematics::Kinematics());
+    k->add(random_transform(a, "NED", "body"));
+    const double t = a.random<double>().between(0, 100);
+    const SurfaceElevationGrid grid = wave.get_waves_on_mesh_as_a_grid(k, t);
+    //! [SurfaceElevationFromWavesTest regular grid example]
+    // Direct summation, at each point of the output mesh
+    const ssc::kinematics::PointMatrix direct = wave.get_waves_on_mesh(k, t);
+    ASSERT_EQ(51, grid.z.rows());
+    ASSERT_EQ(31, grid.z.cols());
+    for (long j = 0 ; j < 31 ; ++j)
+    {
+        for (long i = 0 ; i < 51 ; ++i)
+        {
+            ASSERT_NEAR(direct.m(2, i + 51*j), grid.z(i,j), 1E-10) << "i = " << i << ", j = " << j;
+        }
+    }
+}
+
+TEST_F(SurfaceElevationFromWavesTest, waves_on_a_grid_matching_the_wave_lengths_should_match_direct_summation)
+{
+    // Wave numbers on the reciprocal lattice of the grid: the elevations are computed by an inverse FFT
+    const double Lx = 128;
+    const double Ly = 96;
+    const auto model = [](const double k, const double psi, const double Hs)
+                       {
+                           YamlStretching y;
+                           y.h = 0;
+                           y.delta = 1;
+                           const Stretching s(y);
+                           const double omega = sqrt(9.81*k); // Deep water
+                           return WaveModelPtr(new Airy(discretize(DiracSpectralDensity(omega, Hs), DiracDirectionalSpreading(psi), omega, omega, 1, s), 0.3));
+                       };
+    const std::vector<WaveModelPtr> models({model(2*PI*3/Lx, 0, 2), model(2*PI*2/Ly, PI/2, 1), model(2*PI*5/Lx, PI, 0.5)});
+    YamlWaveOutput out;
+    out.frame_of_reference = "NED";
+    out.xmin = 10;
+    out.xmax = 10 + Lx*63/64;
+    out.nx = 64;
+    out.ymin = -20;
+    out.ymax = -20 + Ly*47/48;
+    out.ny = 48;
+    const SurfaceElevationFromWaves wave(models, std::make_pair(out.nx, out.ny), SurfaceElevationBuilderInterface::make_wave_mesh(out));
+    ssc::kinematics::KinematicsPtr k(new ssc::kinematics::Kinematics());
+    for (size_t n = 0 ; n < 5 ; ++n)
+    {
+        const double t = a.random<double>().between(0, 100);
+        const SurfaceElevationGrid grid = wave.get_waves_on_mesh_as_a_grid(k, t);
+        const ssc::kinematics::PointMatrix direct = wave.get_waves_on_mesh(k, t);
+        for (long j = 0 ; j < 48 ; ++j)
+        {
+            for (long i = 0 ; i < 64 ; ++i)
+            {
+                ASSERT_NEAR(direct.m(2, i + 64*j), grid.z(i,j), 1E-10) << "i = " << i << ", j = " << j;
+            }
+        }
+    }
+}
@@ -0,0 +1,77 @@
+/*
+ * ThreadPoolTest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: cady
+ */
+
+#include <stdexcept>
+
+#include "ThreadPool.hpp"
+#include "ThreadPoolTest.hpp"
+
+ThreadPoolTest::ThreadPoolTest() : a(ssc::random_data_generator::DataGenerator(7545))
+{
+}
+
+ThreadPoolTest::~ThreadPoolTest()
+{
+}
+
+void ThreadPoolTest::SetUp()
+{
+}
+
+void ThreadPoolTest::TearDown()
+{
+}
+
+TEST_F(ThreadPoolTest, example)
+{
+//! [ThreadPoolTest example]
+    ThreadPool pool(4);
+    std::vector<double> squares(10);
+    pool.run(squares.size(), [&squares](const size_t i){squares[i] = (double)(i*i);});
+//! [ThreadPoolTest example]
+    ASSERT_EQ(4, pool.get_nb_of_threads());
+    for (size_t i = 0 ; i < squares.size() ; ++i)
+    {
+        ASSERT_EQ((double)(i*i), squares[i]);
+    }
+}
+
+TEST_F(ThreadPoolTest, can_be_used_several_times)
+{
+    ThreadPool pool(3);
+    for (size_t k = 0 ; k < 1000 ; ++k)
+    {
+        const size_t n = a.random<size_t>().between(0, 7);
+        std::vector<size_t> calls(n, 0);
+        pool.run(n, [&calls](const size_t i){calls[i]++;});
+        for (size_t i = 0 ; i < n ; ++i)
+        {
+            ASSERT_EQ(1, calls[i]);
+        }
+    }
+}
+
+TEST_F(ThreadPoolTest, exceptions_thrown_by_the_tasks_are_rethrown_by_run)
+{
+    ThreadPool pool(2);
+    std::vector<size_t> calls(4, 0);
+    ASSERT_THROW(pool.run(4, [&calls](const size_t i){calls[i]++; if (i == 2) throw std::runtime_error("task failed");}), std::runtime_error);
+    for (size_t i = 0 ; i < 4 ; ++i)
+    {
+        ASSERT_EQ(1, calls[i]);
+    }
+    // The pool can still be used
+    pool.run(4, [&calls](const size_t i){calls[i]++;});
+    ASSERT_EQ(2, calls[3]);
+}
+
+TEST_F(ThreadPoolTest, zero_threads_means_one_per_core)
+{
+    ASSERT_EQ(3, get_nb_of_threads_to_use(3));
+    ASSERT_LE(1, get_nb_of_threads_to_use(0));
+    ASSERT_EQ(get_nb_of_threads_to_use(0), ThreadPool(0).get_nb_of_threads());
+}
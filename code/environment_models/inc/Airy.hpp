@@ -35,6 +35,18 @@ class Airy : public WaveModel
                             const std::vector<double>& rao_phase //!< Phase of the RAO
                              ) const;
 
+        /**  \brief Adds the dynamic pressure at given points to pdyn (without allocating a vector for the result)
+          */
+        void add_dynamic_pressure(const double rho,                   //!< water density (in kg/m^3)
+                                  const double g,                     //!< gravity (in m/s^2)
+                                  const std::vector<double> &x,       //!< x-positions in the NED frame (in meters)
+                                  const std::vector<double> &y,       //!< y-positions in the NED frame (in meters)
+                                  const std::vector<double> &z,       //!< z-positions in the NED frame (in meters)
+                                  const std::vector<double> &eta,     //!< Wave elevations at (x,y) in the NED frame (in meters)
+                                  const double t,                     //!< Current time instant (in seconds)
+                                  std::vector<double>& pdyn,          //!< Output: dynamic pressures (in Pascal)
+                                  DynamicPressureWorkspace& workspace //!< Scratch vectors (resized if needed)
+                                 ) const;
 
     private:
         Airy(); // Disabled
@@ -52,6 +64,21 @@ class Airy : public WaveModel
                                       const double t                           //!< Current time instant (in seconds)
                                       ) const;
 
+        /**  \brief Surface elevations at the nodes of a regular grid
+          *  \details The phase of each component at node (i,j) is theta0 + i*alpha + j*beta, so the elevations
+          *           are computed without evaluating one sine per (node, component) pair:
+          *           - if the wave vectors are on the reciprocal lattice of the grid (i.e. alpha*nx & beta*ny are
+          *             multiples of 2 pi), the Airy sum is an inverse discrete Fourier transform of the amplitudes & is
+          *             computed by an inverse FFT (in O(nx*ny*log(nx*ny)) operations),
+          *           - otherwise the sum is computed directly, but factorized:
+          *             sin(theta0 + j*beta + i*alpha) = sin(i*alpha)*cos(theta0 + j*beta) + cos(i*alpha)*sin(theta0 + j*beta),
+          *             which only needs (nx+ny) sines & cosines per component, the rest being a matrix product.
+          *  \snippet core/unit_tests/src/SurfaceElevationFromWavesTest.cpp SurfaceElevationFromWavesTest regular grid example
+          */
+        std::vector<double> elevation_on_grid(const RegularGrid& grid, //!< Nodes at which to compute the elevations
+                                              const double t           //!< Current time instant (in seconds)
+                                             ) const;
+
         /**  \brief Wave velocity (projected in the NED frame, at points (x,y,z)).
           *  \returns Orbital velocities in m/s
           *  \see "Environmental Conditions and Environmental Loads", April 2014, DNV-RP-C205, Det Norske Veritas AS, page 47
@@ -8,9 +8,10 @@
 #ifndef DISCRETEDIRECTIONALWAVESPECTRUM_HPP_
 #define DISCRETEDIRECTIONALWAVESPECTRUM_HPP_
 
-#include <functional>
 #include <vector>
 
+#include "Stretching.hpp"
+
 /** \author cec
  *  \date Jul 31, 2014, 1:08:15 PM
  *  \brief Used by 'discretize'
@@ -30,10 +31,8 @@ struct DiscreteDirectionalWaveSpectrum
     std::vector<double> psi;                                    //!< Directions between 0 & 2pi the spatial spreading was discretized at (in rad)
     std::vector<double> k;                                      //!< Discretized wave number (for each frequency) in rad/m
     std::vector<std::vector<double> > phase;                    //!< Random phases, for each (frequency, direction) couple (but time invariant) in radian phases *phase[i_freq][i_dir]*
-
-
-    std::function<double(double,double,double)> pdyn_factor;    //!< Factor used when computing the dynamic pressure (no unit)
-    std::function<double(double,double,double)> pdyn_factor_sh; //!< Factor used when computing the orbital velocity (no unit)
+    double depth;                                               //!< Water depth (in meters) used to compute the wave numbers, or 0 for the infinite depth hypothesis
+    Stretching stretching;                                      //!< Dilate z-axis when computing the dynamic pressure factors (delta-stretching)
 };
 
 /** \brief Used by the wave models (eg. Airy, Stokes, etc.)
@@ -54,8 +53,9 @@ struct FlatDiscreteDirectionalWaveSpectrum
     std::vector<double> sin_psi; //!< Sinus directions between 0 & 2pi the spatial spreading was discretized at (so we do not compute it each time), for each angular frequency omega, and direction
     std::vector<double> k;       //!< Discretized wave number (for each frequency) in rad/m, for each angular frequency omega, i.e. same size as omega
     std::vector<double> phase;   //!< Random phases, for each (frequency, direction) couple (but time invariant) in radian, for each angular frequency omega, and direction
-    std::function<double(double,double,double)> pdyn_factor;    //!< Factor used when computing the dynamic pressure (no unit)
-    std::function<double(double,double,double)> pdyn_factor_sh; //!< Factor used when computing the orbital velocity (no unit)
+    std::vector<double> depth_attenuation; //!< 1/(1+exp(-2kh)) for each angular frequency omega, and direction (1 in infinite depth): see dynamic_pressure_factors
+    double depth;                //!< Water depth (in meters) used to compute the wave numbers, or 0 for the infinite depth hypothesis
+    Stretching stretching;       //!< Dilate z-axis when computing the dynamic pressure factors (delta-stretching)
 };
 
 #endif /* DISCRETEDIRECTIONALWAVESPECTRUM_HPP_ */
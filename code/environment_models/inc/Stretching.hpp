@@ -31,6 +31,10 @@ class Stretching
                           const double wave_height //!< Wave height (in meters), z being oriented downwards
                          ) const;
 
+        /**  \brief False if the stretching is disabled (h = 0), in which case rescaled_z(z, wave_height) = z
+          */
+        bool rescales_z() const;
+
     private:
         Stretching(); // Disabled
         double delta; //!< 0 for Wheeler stretching, 1 for linear extrapolation
@@ -14,6 +14,40 @@
 #include <ssc/macros.hpp>
 #include TR1INC(memory)
 
+/** \brief Regular grid of points in the NED frame
+ *  \details Node (i,j) is at (x0 + i*dx_i + j*dx_j, y0 + i*dy_i + j*dy_j), for i < nx & j < ny. The axes
+ *           of the grid need not be those of the NED frame (eg. if the output mesh is defined in a body's frame).
+ */
+struct RegularGrid
+{
+    RegularGrid();
+    double x0;   //!< x-coordinate of node (0,0) in the NED frame (in meters)
+    double y0;   //!< y-coordinate of node (0,0) in the NED frame (in meters)
+    double dx_i; //!< Variation of x from node (i,j) to node (i+1,j) (in meters)
+    double dy_i; //!< Variation of y from node (i,j) to node (i+1,j) (in meters)
+    double dx_j; //!< Variation of x from node (i,j) to node (i,j+1) (in meters)
+    double dy_j; //!< Variation of y from node (i,j) to node (i,j+1) (in meters)
+    size_t nx;   //!< Number of nodes along the first axis of the grid
+    size_t ny;   //!< Number of nodes along the second axis of the grid
+
+    /**  \brief Coordinates of all nodes in the NED frame, i varying fastest
+      */
+    void get_nodes(std::vector<double>& x, std::vector<double>& y) const;
+};
+
+/** \brief Caller-owned scratch vectors for WaveModel::add_dynamic_pressure
+ *  \details Kept from one time step to the next (in DynamicPressureBuffers) so that the wave models
+ *           can compute the dynamic pressure without allocating anything once the vectors have their capacity.
+ */
+struct DynamicPressureWorkspace
+{
+    DynamicPressureWorkspace();
+    std::vector<double> phases_t;  //!< Part of the phase of each component which does not depend on the position
+    std::vector<double> theta;     //!< Phase of each component at the current point
+    std::vector<double> sin_theta; //!< Sine of theta
+    std::vector<double> factors;   //!< Dynamic pressure factor of each component at the current point
+};
+
 /** \author cec
  *  \date Aug 1, 2014, 3:15:04 PM
  *  \brief Interface to wave models.
@@ -50,6 +84,13 @@ class WaveModel
                                           const double t                //!< Current time instant (in seconds)
                                          ) const;
 
+        /**  \brief Computes the surface elevations at the nodes of a regular grid
+          *  \returns Elevations at each node (i varying fastest), in meters: same as get_elevation at the coordinates of the nodes
+          */
+        std::vector<double> get_elevation_on_grid(const RegularGrid& grid, //!< Nodes at which to compute the elevations
+                                                  const double t           //!< Current time instant (in seconds)
+                                                 ) const;
+
         /**  \brief Computes the orbital velocity at given points.
           *  \returns Velocities of the fluid at given points & instant, in m/s
           */
@@ -74,6 +115,22 @@ class WaveModel
                                                  const double t                  //!< Current time instant (in seconds)
                                                 ) const;
 
+        /**  \brief Adds the dynamic pressure at given points to pdyn
+          *  \details Lets SurfaceElevationFromWaves sum the pressures induced by several wave models without
+          *           allocating a vector for each model. pdyn should have the same size as x, y, z & eta.
+          *           The default implementation calls dynamic_pressure.
+          */
+        virtual void add_dynamic_pressure(const double rho,                   //!< water density (in kg/m^3)
+                                          const double g,                     //!< gravity (in m/s^2)
+                                          const std::vector<double> &x,       //!< x-positions in the NED frame (in meters)
+                                          const std::vector<double> &y,       //!< y-positions in the NED frame (in meters)
+                                          const std::vector<double> &z,       //!< z-positions in the NED frame (in meters)
+                                          const std::vector<double> &eta,     //!< Wave elevations at (x,y) in the NED frame (in meters)
+                                          const double t,                     //!< Current time instant (in seconds)
+                                          std::vector<double>& pdyn,          //!< Output: dynamic pressures (in Pascal) to which the pressures induced by this model are added
+                                          DynamicPressureWorkspace& workspace //!< Scratch vectors (resized if needed)
+                                         ) const;
+
         /**  \returns List of angular frequencies for which the spectra will be calculated.
           *  \details Needed by the RAOs (RadiationForceModel)
           */
@@ -84,7 +141,7 @@ class WaveModel
           */
         std::vector<double> get_psis() const;
 
-        FlatDiscreteDirectionalWaveSpectrum get_flat_spectrum() const {return flat_spectrum;};
+        const FlatDiscreteDirectionalWaveSpectrum& get_flat_spectrum() const {return flat_spectrum;};
         DiscreteDirectionalWaveSpectrum get_spectrum() const {return spectrum;};
 
     private:
@@ -102,6 +159,13 @@ class WaveModel
                                               const double t                //!< Current time instant (in seconds)
                                               ) const = 0;
 
+        /**  \brief Surface elevations at the nodes of a regular grid
+          *  \details Lets the models exploit the structure of the grid (see Airy). The default implementation calls elevation.
+          */
+        virtual std::vector<double> elevation_on_grid(const RegularGrid& grid, //!< Nodes at which to compute the elevations
+                                                      const double t           //!< Current time instant (in seconds)
+                                                     ) const;
+
         /**  \author cec
           *  \date Feb 3, 2015, 10:06:45 AM
           *  \brief Orbital velocity
@@ -8,6 +8,9 @@
 #ifndef DISCRETIZE_HPP_
 #define DISCRETIZE_HPP_
 
+#include <cstddef> // size_t
+#include <vector>
+
 #include "DiscreteDirectionalWaveSpectrum.hpp"
 
 class Stretching;
@@ -90,4 +93,28 @@ double dynamic_pressure_factor_sh(const double k,              //!< Wave number
                                   const Stretching& stretching //!< Dilate z-axis to properly compute orbital velocities (delta-stretching)
                                  );
 
+/**  \brief Evaluates dynamic_pressure_factor for all components of a flat spectrum, at a given depth
+  *  \details Used by the wave models, at each point. The stretching is only computed once per point and
+  *           the finite depth factor is computed from coefficients tabulated by 'flatten':
+  *           \f$\frac{\cosh(k(h-z))}{\cosh(kh)}=\frac{e^{-kz}+e^{-k(2h-z)}}{1+e^{-2kh}}\f$
+  *           (which, contrary to the hyperbolic functions, does not overflow for large values of kh).
+  *           Same results as dynamic_pressure_factor (infinite or finite depth, depending on the spectrum), up to rounding errors.
+  *  \snippet environment_models/unit_tests/src/discretizeTest.cpp discretizeTest dynamic_pressure_factors example
+  */
+void dynamic_pressure_factors(const FlatDiscreteDirectionalWaveSpectrum& spectrum, //!< Spectrum built by 'flatten'
+                              const double z,                                      //!< z-position in the NED frame (in meters)
+                              const double eta,                                    //!< Wave elevation at (x,y) in the NED frame (in meters)
+                              std::vector<double>& factors                         //!< Output: one factor for each component of the spectrum (should have the same size as the spectrum)
+                              );
+
+/**  \brief Same as above, but also evaluates dynamic_pressure_factor_sh (used for the vertical orbital velocity)
+  *  \details In infinite depth, both factors are equal.
+  */
+void dynamic_pressure_factors(const FlatDiscreteDirectionalWaveSpectrum& spectrum, //!< Spectrum built by 'flatten'
+                              const double z,                                      //!< z-position in the NED frame (in meters)
+                              const double eta,                                    //!< Wave elevation at (x,y) in the NED frame (in meters)
+                              std::vector<double>& factors,                        //!< Output: one factor for each component of the spectrum (should have the same size as the spectrum)
+                              std::vector<double>& factors_sh                      //!< Output: one factor for each component of the spectrum (should have the same size as the spectrum)
+                              );
+
 #endif /* DISCRETIZE_HPP_ */
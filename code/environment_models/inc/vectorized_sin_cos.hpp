@@ -0,0 +1,33 @@
+/*
+ * vectorized_sin_cos.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: cady
+ */
+
+#ifndef VECTORIZED_SIN_COS_HPP_
+#define VECTORIZED_SIN_COS_HPP_
+
+#include <vector>
+
+/**  \brief Computes the sine of all angles in a vector
+  *  \details Used by the wave models, which evaluate one sine per (point, spectrum component) pair.
+  *           Range reduction (Cody & Waite) & polynomial approximation (fdlibm's kernels) are written
+  *           without branches so the compiler can vectorize the loop. Results are within a few ULPs of std::sin.
+  *           Angles whose magnitude exceeds 1E6 rad (for which the reduction is no longer accurate)
+  *           are computed with std::sin.
+  *  \snippet environment_models/unit_tests/src/vectorized_sin_cosTest.cpp vectorized_sin_cosTest example
+  */
+void vectorized_sin(const std::vector<double>& theta, //!< Angles (in radian)
+                    std::vector<double>& sin_theta    //!< Output: sin(theta) (should have the same size as theta)
+                    );
+
+/**  \brief Computes the sine & cosine of all angles in a vector
+  *  \details Same algorithm as vectorized_sin (the range reduction is shared).
+  */
+void vectorized_sin_cos(const std::vector<double>& theta, //!< Angles (in radian)
+                        std::vector<double>& sin_theta,   //!< Output: sin(theta) (should have the same size as theta)
+                        std::vector<double>& cos_theta    //!< Output: cos(theta) (should have the same size as theta)
+                        );
+
+#endif /* VECTORIZED_SIN_COS_HPP_ */
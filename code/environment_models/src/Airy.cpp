@@ -9,10 +9,116 @@
 #include "InternalErrorException.hpp"
 #include "InvalidInputException.hpp"
 #include "discretize.hpp"
+#include "vectorized_sin_cos.hpp"
 
+#include <complex>
 #include <vector>
+#include <Eigen/Dense>
+#include <unsupported/Eigen/FFT>
 #include <ssc/macros.hpp>
 
+#define _USE_MATH_DEFINE
+#include <cmath>
+#define PI M_PI
+
+namespace
+{
+    /**  \brief Part of the phase of each component which does not depend on the position: theta - omega*t
+      */
+    void time_dependent_phases(std::vector<double>& phases_t, const FlatDiscreteDirectionalWaveSpectrum& spectrum, const double t)
+    {
+        const size_t n = spectrum.omega.size();
+        phases_t.resize(n);
+        for (size_t i = 0 ; i < n ; ++i) phases_t[i] = spectrum.phase[i] - spectrum.omega[i] * t;
+    }
+
+    std::vector<double> time_dependent_phases(const FlatDiscreteDirectionalWaveSpectrum& spectrum, const double t)
+    {
+        std::vector<double> ret;
+        time_dependent_phases(ret, spectrum, t);
+        return ret;
+    }
+
+    /**  \brief Phase of each component at (x,y): -omega*t + k*(x*cos(psi) + y*sin(psi)) + theta
+      *  \details Plain loop on contiguous arrays: vectorized by the compiler
+      */
+    void phases_at(std::vector<double>& phases, const FlatDiscreteDirectionalWaveSpectrum& spectrum, const std::vector<double>& phases_t, const double x, const double y)
+    {
+        const size_t n = phases.size();
+        const double* const k = spectrum.k.data();
+        const double* const cos_psi = spectrum.cos_psi.data();
+        const double* const sin_psi = spectrum.sin_psi.data();
+        const double* const phase_t = phases_t.data();
+        double* const out = phases.data();
+        for (size_t i = 0 ; i < n ; ++i) out[i] = k[i] * (x * cos_psi[i] + y * sin_psi[i]) + phase_t[i];
+    }
+
+    /**  \brief Index of the discrete frequency 2*pi*m/n matching a phase increment (modulo n)
+      *  \returns False if the phase increment is not a multiple of 2*pi/n
+      */
+    bool is_fft_frequency(const double phase_increment, const size_t n, size_t& m)
+    {
+        const double s = phase_increment*double(n)/(2*PI);
+        const double r = std::round(s);
+        if (std::abs(s-r) > 1E-9) return false;
+        const long idx = (long)r % (long)n;
+        m = (size_t)(idx < 0 ? idx + (long)n : idx);
+        return true;
+    }
+
+    /**  \brief Elevations on a grid, as the imaginary part of the (unscaled) inverse DFT of a*exp(i*theta0)
+      *  \returns False (without computing anything) if a component is not at a frequency of the DFT
+      */
+    bool elevation_by_inverse_fft(const std::vector<double>& a, const std::vector<double>& theta0, const std::vector<double>& alpha, const std::vector<double>& beta,
+                                  const size_t nx, const size_t ny, std::vector<double>& eta)
+    {
+        std::vector<std::complex<double> > spectrum(nx*ny, 0);
+        for (size_t c = 0 ; c < a.size() ; ++c)
+        {
+            size_t m, q;
+            if (not(is_fft_frequency(alpha[c], nx, m)) or not(is_fft_frequency(beta[c], ny, q))) return false;
+            spectrum[m + nx*q] += std::polar(a[c], theta0[c]);
+        }
+        Eigen::FFT<double> fft;
+        fft.SetFlag(Eigen::FFT<double>::Unscaled);
+        std::vector<std::complex<double> > along_i(nx*ny);
+        for (size_t q = 0 ; q < ny ; ++q) fft.inv(along_i.data() + nx*q, spectrum.data() + nx*q, (long)nx);
+        std::vector<std::complex<double> > column(ny), transformed_column(ny);
+        eta.resize(nx*ny);
+        for (size_t i = 0 ; i < nx ; ++i)
+        {
+            for (size_t q = 0 ; q < ny ; ++q) column[q] = along_i[i + nx*q];
+            fft.inv(transformed_column.data(), column.data(), (long)ny);
+            for (size_t j = 0 ; j < ny ; ++j) eta[i + nx*j] = -transformed_column[j].imag();
+        }
+        return true;
+    }
+
+    /**  \brief Elevations on a grid, using sin(theta0 + j*beta + i*alpha) = sin(i*alpha)*cos(theta0 + j*beta) + cos(i*alpha)*sin(theta0 + j*beta)
+      */
+    std::vector<double> factorized_elevation(const std::vector<double>& a, const std::vector<double>& theta0, const std::vector<double>& alpha, const std::vector<double>& beta,
+                                             const size_t nx, const size_t ny)
+    {
+        const size_t n = a.size();
+        std::vector<double> phases_i(nx*n), sin_i(nx*n), cos_i(nx*n);
+        for (size_t c = 0 ; c < n ; ++c)
+        {
+            for (size_t i = 0 ; i < nx ; ++i) phases_i[i + nx*c] = double(i)*alpha[c];
+        }
+        std::vector<double> phases_j(n*ny), sin_j(n*ny), cos_j(n*ny);
+        for (size_t j = 0 ; j < ny ; ++j)
+        {
+            for (size_t c = 0 ; c < n ; ++c) phases_j[c + n*j] = theta0[c] + double(j)*beta[c];
+        }
+        vectorized_sin_cos(phases_i, sin_i, cos_i);
+        vectorized_sin_cos(phases_j, sin_j, cos_j);
+        typedef Eigen::Map<const Eigen::MatrixXd> Matrix;
+        const Eigen::VectorXd amplitudes = Eigen::Map<const Eigen::VectorXd>(a.data(), (long)n);
+        const Eigen::MatrixXd zeta = -(Matrix(sin_i.data(), (long)nx, (long)n) * (amplitudes.asDiagonal() * Matrix(cos_j.data(), (long)n, (long)ny))
+                                     + Matrix(cos_i.data(), (long)nx, (long)n) * (amplitudes.asDiagonal() * Matrix(sin_j.data(), (long)n, (long)ny)));
+        return std::vector<double>(zeta.data(), zeta.data() + nx*ny);
+    }
+}
 
 
 Airy::Airy(const DiscreteDirectionalWaveSpectrum& spectrum_, const double constant_random_phase) : WaveModel(spectrum_, constant_random_phase)
@@ -32,19 +138,20 @@ double Airy::evaluate_rao(
         const std::vector<double>& rao_phase_for_each_frequency_and_incidence      //!< "Flattened" matrix containing the phase of the RAO for each angular frequency omega and each wave incidence beta
         ) const
 {
-    double F = 0;
     const size_t nb_of_omegas_x_nb_of_directions = rao_module_for_each_frequency_and_incidence.size();
     if (nb_of_omegas_x_nb_of_directions != flat_spectrum.k.size())
     {
         THROW(__PRETTY_FUNCTION__, InternalErrorException, "Number of angular frequencies times number of incidences in HDB RAO is " << nb_of_omegas_x_nb_of_directions << ", which does not match spectrum size (" << flat_spectrum.k.size() << " (omega,psi) pairs)");
     }
+    std::vector<double> theta(nb_of_omegas_x_nb_of_directions);
+    phases_at(theta, flat_spectrum, time_dependent_phases(flat_spectrum, t), x, y);
+    for (size_t i = 0 ; i < nb_of_omegas_x_nb_of_directions ; ++i) theta[i] += rao_phase_for_each_frequency_and_incidence[i];
+    std::vector<double> sin_theta(nb_of_omegas_x_nb_of_directions);
+    vectorized_sin(theta, sin_theta);
+    double F = 0;
     for (size_t i = 0 ; i < nb_of_omegas_x_nb_of_directions ; ++i) // For each (omega,beta) pair
     {
-        const double rao_amplitude = rao_module_for_each_frequency_and_incidence[i] * flat_spectrum.a[i];
-        const double omega_t = flat_spectrum.omega[i] * t;
-        const double k_xCosPsi_ySinPsi = flat_spectrum.k[i] * (x * flat_spectrum.cos_psi[i] + y * flat_spectrum.sin_psi[i]);
-        const double theta = flat_spectrum.phase[i];
-        F -= rao_amplitude * sin(-omega_t + k_xCosPsi_ySinPsi + theta + rao_phase_for_each_frequency_and_incidence[i]);
+        F -= rao_module_for_each_frequency_and_incidence[i] * flat_spectrum.a[i] * sin_theta[i];
     }
     return F;
 }
@@ -55,23 +162,45 @@ std::vector<double> Airy::elevation(
     const double t                //!< Current time instant (in seconds)
     ) const
 {
-    std::vector<double> zeta(x.size());
+    std::vector<double> zeta(x.size(), 0);
     const size_t n = flat_spectrum.psi.size();
-
-    for (size_t j = 0; j < zeta.size(); ++j) {
+    const std::vector<double> phases_t = time_dependent_phases(flat_spectrum, t);
+    std::vector<double> theta(n);
+    std::vector<double> sin_theta(n);
+    for (size_t j = 0; j < zeta.size(); ++j)
+    {
+        phases_at(theta, flat_spectrum, phases_t, x[j], y[j]);
+        vectorized_sin(theta, sin_theta);
         for (size_t i = 0 ; i < n ; ++i)
         {
-            const double a = flat_spectrum.a[i];
-            const double omega_t = flat_spectrum.omega[i] * t;
-            const double k_xCosPsi_ySinPsi = flat_spectrum.k[i] * (x.at(j) * flat_spectrum.cos_psi[i] + y.at(j) * flat_spectrum.sin_psi[i]);
-            const double theta = flat_spectrum.phase[i];
-            zeta.at(j) -= a * sin(-omega_t + k_xCosPsi_ySinPsi + theta);
+            zeta[j] -= flat_spectrum.a[i] * sin_theta[i];
         }
     }
 
     return zeta;
 }
 
+std::vector<double> Airy::elevation_on_grid(
+    const RegularGrid& grid, //!< Nodes at which to compute the elevations
+    const double t           //!< Current time instant (in seconds)
+    ) const
+{
+    const size_t n = flat_spectrum.k.size();
+    std::vector<double> theta0(n);
+    phases_at(theta0, flat_spectrum, time_dependent_phases(flat_spectrum, t), grid.x0, grid.y0);
+    std::vector<double> alpha(n), beta(n);
+    for (size_t c = 0 ; c < n ; ++c)
+    {
+        const double kx = flat_spectrum.k[c] * flat_spectrum.cos_psi[c];
+        const double ky = flat_spectrum.k[c] * flat_spectrum.sin_psi[c];
+        alpha[c] = kx * grid.dx_i + ky * grid.dy_i;
+        beta[c] = kx * grid.dx_j + ky * grid.dy_j;
+    }
+    std::vector<double> zeta;
+    if (elevation_by_inverse_fft(flat_spectrum.a, theta0, alpha, beta, grid.nx, grid.ny, zeta)) return zeta;
+    return factorized_elevation(flat_spectrum.a, theta0, alpha, beta, grid.nx, grid.ny);
+}
+
 std::vector<double> Airy::dynamic_pressure(
     const double rho,               //!< water density (in kg/m^3)
     const double g,                 //!< gravity (in m/s^2)
@@ -83,8 +212,33 @@ std::vector<double> Airy::dynamic_pressure(
     ) const
 {
     std::vector<double> p(x.size(), 0);
+    DynamicPressureWorkspace workspace;
+    add_dynamic_pressure(rho, g, x, y, z, eta, t, p, workspace);
+    return p;
+}
 
-    for (size_t j = 0; j < p.size(); ++j)
+void Airy::add_dynamic_pressure(
+    const double rho,                   //!< water density (in kg/m^3)
+    const double g,                     //!< gravity (in m/s^2)
+    const std::vector<double> &x,       //!< x-positions in the NED frame (in meters)
+    const std::vector<double> &y,       //!< y-positions in the NED frame (in meters)
+    const std::vector<double> &z,       //!< z-positions in the NED frame (in meters)
+    const std::vector<double> &eta,     //!< Wave elevations at (x,y) in the NED frame (in meters)
+    const double t,                     //!< Current time instant (in seconds)
+    std::vector<double>& pdyn,          //!< Output: dynamic pressures (in Pascal)
+    DynamicPressureWorkspace& workspace //!< Scratch vectors (resized if needed)
+    ) const
+{
+    const size_t n = flat_spectrum.psi.size();
+    time_dependent_phases(workspace.phases_t, flat_spectrum, t);
+    workspace.theta.resize(n);
+    workspace.sin_theta.resize(n);
+    workspace.factors.resize(n);
+    const std::vector<double>& phases_t = workspace.phases_t;
+    std::vector<double>& theta = workspace.theta;
+    std::vector<double>& sin_theta = workspace.sin_theta;
+    std::vector<double>& pdyn_factors = workspace.factors;
+    for (size_t j = 0; j < pdyn.size(); ++j)
     {
         if (std::isnan(z[j]))
         {
@@ -95,28 +249,19 @@ std::vector<double> Airy::dynamic_pressure(
             THROW(__PRETTY_FUNCTION__, InternalErrorException, "eta (wave height, in meters) was NaN");
         }
 
-        if (z[j] < eta[j])
+        if (z[j] >= eta[j])
         {
-            p[j] = 0;
-        }
-        else
-        {
-            const size_t n = flat_spectrum.psi.size();
+            dynamic_pressure_factors(flat_spectrum, z[j], eta[j], pdyn_factors);
+            phases_at(theta, flat_spectrum, phases_t, x[j], y[j]);
+            vectorized_sin(theta, sin_theta);
+            double p = 0;
             for (size_t i = 0; i < n; ++i)
             {
-                const double a = flat_spectrum.a[i];
-                const double k = flat_spectrum.k[i];
-                const double omega_t = flat_spectrum.omega[i] * t;
-                const double pdyn_fact = flat_spectrum.pdyn_factor(k, z[j], eta[j]);
-                const double k_xCosPsi_ySinPsi = k * (x[j] * flat_spectrum.cos_psi[i] + y[j] * flat_spectrum.sin_psi[i]);
-                const double theta = flat_spectrum.phase[i];
-                p[j] += a * pdyn_fact * sin(-omega_t + k_xCosPsi_ySinPsi + theta);
+                p += flat_spectrum.a[i] * pdyn_factors[i] * sin_theta[i];
             }
-            p[j] *= rho * g;
+            pdyn[j] += p * (rho * g);
         }
-        
     }
-    return p;
 }
 
 ssc::kinematics::PointMatrix Airy::orbital_velocity(
@@ -129,33 +274,38 @@ ssc::kinematics::PointMatrix Airy::orbital_velocity(
         ) const
 {
     ssc::kinematics::PointMatrix M("NED", x.size());
-    for (size_t point_index = 0; point_index < x.size(); ++point_index) {
-
-        if (z.at(point_index) < eta.at(point_index)) 
+    const size_t n = flat_spectrum.psi.size();
+    const std::vector<double> phases_t = time_dependent_phases(flat_spectrum, t);
+    std::vector<double> a_k_omega(n);
+    for (size_t i = 0 ; i < n ; ++i) a_k_omega[i] = flat_spectrum.a[i] * flat_spectrum.k[i] / flat_spectrum.omega[i];
+    std::vector<double> theta(n);
+    std::vector<double> sin_theta(n);
+    std::vector<double> cos_theta(n);
+    std::vector<double> pdyn_factors(n);
+    std::vector<double> pdyn_factors_sh(n);
+    for (size_t point_index = 0; point_index < x.size(); ++point_index)
+    {
+        if (z[point_index] < eta[point_index])
         {
             M.m(0, point_index) = 0;
             M.m(1, point_index) = 0;
             M.m(2, point_index) = 0;
-        } else {
-            const size_t n = flat_spectrum.psi.size();
+        }
+        else
+        {
+            // No stretching for the orbital velocity
+            dynamic_pressure_factors(flat_spectrum, z[point_index], 0, pdyn_factors, pdyn_factors_sh);
+            phases_at(theta, flat_spectrum, phases_t, x[point_index], y[point_index]);
+            vectorized_sin_cos(theta, sin_theta, cos_theta);
             double u = 0;
             double v = 0;
             double w = 0;
             for (size_t i = 0 ; i < n ; ++i)
             {
-                const double omega = flat_spectrum.omega[i];
-                const double k = flat_spectrum.k[i];
-                const double pdyn_factor = flat_spectrum.pdyn_factor(k,z[point_index],0); // No stretching for the orbital velocity
-                const double pdyn_factor_sh = flat_spectrum.pdyn_factor_sh(k,z[point_index],0); // No stretching for the orbital velocity
-                const double k_xCosPsi_ySinPsi = k * (x[point_index] * flat_spectrum.cos_psi[i] + y[point_index] * flat_spectrum.sin_psi[i]);
-                const double theta = -omega * t + k_xCosPsi_ySinPsi + flat_spectrum.phase[i];
-                const double cos_theta = cos(theta);
-                const double sin_theta = sin(theta);
-                const double a_k_omega = flat_spectrum.a[i] * k / omega;
-                const double a_k_omega_pdyn_factor_sin_theta = a_k_omega * pdyn_factor * sin_theta;
+                const double a_k_omega_pdyn_factor_sin_theta = a_k_omega[i] * pdyn_factors[i] * sin_theta[i];
                 u += a_k_omega_pdyn_factor_sin_theta * flat_spectrum.cos_psi[i];
                 v += a_k_omega_pdyn_factor_sin_theta * flat_spectrum.sin_psi[i];
-                w += a_k_omega * pdyn_factor_sh * cos_theta;
+                w += a_k_omega[i] * pdyn_factors_sh[i] * cos_theta[i];
             }
             M.m(0, point_index) = u * g;
             M.m(1, point_index) = v * g;
@@ -163,5 +313,4 @@ ssc::kinematics::PointMatrix Airy::orbital_velocity(
         }
     }
     return M;
-
 }
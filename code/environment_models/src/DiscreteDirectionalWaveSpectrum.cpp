@@ -6,6 +6,7 @@
  */
 
 #include "DiscreteDirectionalWaveSpectrum.hpp"
+#include "YamlWaveModelInput.hpp"
 
 FlatDiscreteDirectionalWaveSpectrum::FlatDiscreteDirectionalWaveSpectrum() :
                     a(),
@@ -15,8 +16,9 @@ FlatDiscreteDirectionalWaveSpectrum::FlatDiscreteDirectionalWaveSpectrum() :
                     sin_psi(),
                     k(),
                     phase(),
-                    pdyn_factor(),
-                    pdyn_factor_sh()
+                    depth_attenuation(),
+                    depth(0),
+                    stretching(YamlStretching())
 {
 }
 
@@ -27,8 +29,8 @@ DiscreteDirectionalWaveSpectrum::DiscreteDirectionalWaveSpectrum() :
                     psi(),
                     k(),
                     phase(),
-                    pdyn_factor(),
-                    pdyn_factor_sh()
+                    depth(0),
+                    stretching(YamlStretching())
 {
 }
 
@@ -39,3 +39,8 @@ double Stretching::rescaled_z(const double z, //!< z value we wish to rescale (i
     }
     return (z-h)*(delta*ksi-h)/(ksi-h)+h;
 }
+
+bool Stretching::rescales_z() const
+{
+    return h != 0;
+}
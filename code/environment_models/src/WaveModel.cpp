@@ -15,6 +15,28 @@
 #include <cmath>
 #define PI M_PI
 
+RegularGrid::RegularGrid() : x0(0), y0(0), dx_i(0), dy_i(0), dx_j(0), dy_j(0), nx(0), ny(0)
+{
+}
+
+DynamicPressureWorkspace::DynamicPressureWorkspace() : phases_t(), theta(), sin_theta(), factors()
+{
+}
+
+void RegularGrid::get_nodes(std::vector<double>& x, std::vector<double>& y) const
+{
+    x.resize(nx*ny);
+    y.resize(nx*ny);
+    for (size_t j = 0 ; j < ny ; ++j)
+    {
+        for (size_t i = 0 ; i < nx ; ++i)
+        {
+            x[i+nx*j] = x0 + double(i)*dx_i + double(j)*dx_j;
+            y[i+nx*j] = y0 + double(i)*dy_i + double(j)*dy_j;
+        }
+    }
+}
+
 DiscreteDirectionalWaveSpectrum add_constant_phases(DiscreteDirectionalWaveSpectrum spectrum, const double constant_phase);
 DiscreteDirectionalWaveSpectrum add_constant_phases(DiscreteDirectionalWaveSpectrum spectrum, const double constant_phase)
 {
@@ -135,6 +157,20 @@ std::vector<double> WaveModel::get_elevation(const std::vector<double> &x, //!<
     return elevation(x, y, t);
 }
 
+std::vector<double> WaveModel::get_elevation_on_grid(const RegularGrid& grid, //!< Nodes at which to compute the elevations
+                                                     const double t           //!< Current time instant (in seconds)
+                                                    ) const
+{
+    return elevation_on_grid(grid, t);
+}
+
+std::vector<double> WaveModel::elevation_on_grid(const RegularGrid& grid, const double t) const
+{
+    std::vector<double> x, y;
+    grid.get_nodes(x, y);
+    return elevation(x, y, t);
+}
+
 ssc::kinematics::PointMatrix WaveModel::get_orbital_velocity(
         const double g,                //!< gravity (in m/s^2)
         const std::vector<double>& x,  //!< x-positions in the NED frame (in meters)
@@ -169,3 +205,10 @@ std::vector<double> WaveModel::get_dynamic_pressure(const double rho,
     }
     return dynamic_pressure(rho, g, x, y, z, eta, t);
 }
+
+void WaveModel::add_dynamic_pressure(const double rho, const double g, const std::vector<double> &x, const std::vector<double> &y, const std::vector<double> &z,
+                                     const std::vector<double> &eta, const double t, std::vector<double>& pdyn, DynamicPressureWorkspace&) const
+{
+    const std::vector<double> p = dynamic_pressure(rho, g, x, y, z, eta, t);
+    for (size_t i = 0 ; i < pdyn.size() ; ++i) pdyn[i] += p[i];
+}
@@ -55,8 +55,8 @@ DiscreteDirectionalWaveSpectrum discretize(
     DiscreteDirectionalWaveSpectrum ret = common(S,D,omega_min,omega_max,nfreq);
     ret.k.reserve(ret.omega.size());
     for (const auto omega:ret.omega) ret.k.push_back(S.get_wave_number(omega));
-    ret.pdyn_factor = [stretching](const double k, const double z, const double eta){return dynamic_pressure_factor(k,z,eta,stretching);};
-    ret.pdyn_factor_sh = [stretching](const double k, const double z, const double eta){return dynamic_pressure_factor(k,z,eta,stretching);};
+    ret.depth = 0;
+    ret.stretching = stretching;
     return ret;
 }
 
@@ -87,8 +87,8 @@ DiscreteDirectionalWaveSpectrum discretize(
             THROW(__PRETTY_FUNCTION__, InvalidInputException, "You should be using a shallow water model (currently none exist in X-DYN) because the water depth (h = " << h << " m) is lower than the wave length divided by twenty (lambda/20 = " << 2*PI/k << ") for omega = " << ret.omega.at(i));
         }
     }
-    ret.pdyn_factor = [h,stretching](const double k, const double z, const double eta){return dynamic_pressure_factor(k,z,h,eta,stretching);};
-    ret.pdyn_factor_sh = [h,stretching](const double k, const double z, const double eta){return dynamic_pressure_factor_sh(k,z,h,eta,stretching);};
+    ret.depth = h;
+    ret.stretching = stretching;
     return ret;
 }
 
@@ -115,6 +115,7 @@ FlatDiscreteDirectionalWaveSpectrum flatten(
     if (nOmega*nPsi > 0)
     {
         ret.phase.reserve(nOmega*nPsi);
+        ret.depth_attenuation.reserve(nOmega*nPsi);
     }
     for (size_t i = 0 ; i < nOmega ; ++i)
     {
@@ -166,10 +167,11 @@ FlatDiscreteDirectionalWaveSpectrum flatten(
             const double s = spectrum.Si[i] * spectrum.Dj[j];
             ret.a.push_back(sqrt(2 * s * domega * dpsi));
             ret.phase.push_back(spectrum.phase.at(i).at(j));
+            ret.depth_attenuation.push_back(spectrum.depth > 0 ? 1/(1+exp(-2*spectrum.k[i]*spectrum.depth)) : 1);
         }
     }
-    ret.pdyn_factor = spectrum.pdyn_factor;
-    ret.pdyn_factor_sh = spectrum.pdyn_factor_sh;
+    ret.depth = spectrum.depth;
+    ret.stretching = spectrum.stretching;
     return ret;
 }
 
@@ -192,8 +194,8 @@ FlatDiscreteDirectionalWaveSpectrum filter(
     const size_t n = spectrum.omega.size();
     std::list<ValIdx> SiDj;
     FlatDiscreteDirectionalWaveSpectrum ret;
-    ret.pdyn_factor=spectrum.pdyn_factor;
-    ret.pdyn_factor_sh=spectrum.pdyn_factor_sh;
+    ret.depth = spectrum.depth;
+    ret.stretching = spectrum.stretching;
     for (size_t i = 0 ; i < n; ++i)
     {
         a = spectrum.a.at(i);
@@ -215,6 +217,7 @@ FlatDiscreteDirectionalWaveSpectrum filter(
         ret.cos_psi.push_back(spectrum.cos_psi.at(sidj.second));
         ret.sin_psi.push_back(spectrum.sin_psi.at(sidj.second));
         ret.k.push_back(spectrum.k.at(sidj.second));
+        ret.depth_attenuation.push_back(spectrum.depth_attenuation.at(sidj.second));
     }
     return ret;
 }
@@ -268,3 +271,108 @@ double dynamic_pressure_factor_sh(const double k,              //!< Wave number
     if (z>h) return 0;
     return sinh(k*(h-stretching.rescaled_z(z,eta)))/cosh(k*h);
 }
+
+void check_size(const FlatDiscreteDirectionalWaveSpectrum& spectrum, const std::vector<double>& factors);
+void check_size(const FlatDiscreteDirectionalWaveSpectrum& spectrum, const std::vector<double>& factors)
+{
+    if (factors.size() != spectrum.k.size())
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "Output vector should have the same size as the spectrum (" << spectrum.k.size() << ") but got " << factors.size());
+    }
+    if (spectrum.depth_attenuation.size() != spectrum.k.size())
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "Spectrum has " << spectrum.k.size() << " wave numbers but " << spectrum.depth_attenuation.size() << " depth attenuation factors: it should have been built using 'flatten'");
+    }
+}
+
+bool factors_are_zero(const FlatDiscreteDirectionalWaveSpectrum& spectrum, const double z, const double eta);
+bool factors_are_zero(const FlatDiscreteDirectionalWaveSpectrum& spectrum, const double z, const double eta)
+{
+    if (std::isnan(z))
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "z (value to rescale, in meters) was NaN");
+    }
+    if (std::isnan(eta))
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "eta (wave height, in meters) was NaN");
+    }
+    if (eta != 0 && z<eta) return true;
+    return (spectrum.depth > 0) and (z > spectrum.depth);
+}
+
+void dynamic_pressure_factors(const FlatDiscreteDirectionalWaveSpectrum& spectrum, //!< Spectrum built by 'flatten'
+                              const double z,                                      //!< z-position in the NED frame (in meters)
+                              const double eta,                                    //!< Wave elevation at (x,y) in the NED frame (in meters) for stretching
+                              std::vector<double>& factors                         //!< Output: one factor for each component of the spectrum
+                              )
+{
+    check_size(spectrum, factors);
+    const size_t n = factors.size();
+    if (factors_are_zero(spectrum, z, eta))
+    {
+        for (size_t i = 0 ; i < n ; ++i) factors[i] = 0;
+        return;
+    }
+    const double rescaled_z = spectrum.stretching.rescaled_z(z,eta);
+    const double* const k = spectrum.k.data();
+    const double* const attenuation = spectrum.depth_attenuation.data();
+    const double two_h = 2*spectrum.depth;
+    for (size_t i = 0 ; i < n ; ++i)
+    {
+        // The wave number is the same for all directions of a given frequency
+        if ((i > 0) and (k[i] == k[i-1]))
+        {
+            factors[i] = factors[i-1];
+        }
+        else if (spectrum.depth > 0)
+        {
+            factors[i] = attenuation[i]*(exp(-k[i]*rescaled_z) + exp(-k[i]*(two_h-rescaled_z)));
+        }
+        else
+        {
+            factors[i] = exp(-k[i]*rescaled_z);
+        }
+    }
+}
+
+void dynamic_pressure_factors(const FlatDiscreteDirectionalWaveSpectrum& spectrum, //!< Spectrum built by 'flatten'
+                              const double z,                                      //!< z-position in the NED frame (in meters)
+                              const double eta,                                    //!< Wave elevation at (x,y) in the NED frame (in meters) for stretching
+                              std::vector<double>& factors,                        //!< Output: one factor for each component of the spectrum
+                              std::vector<double>& factors_sh                      //!< Output: one factor for each component of the spectrum (for the vertical orbital velocity)
+                              )
+{
+    check_size(spectrum, factors);
+    check_size(spectrum, factors_sh);
+    const size_t n = factors.size();
+    if (factors_are_zero(spectrum, z, eta))
+    {
+        for (size_t i = 0 ; i < n ; ++i) factors[i] = 0;
+        for (size_t i = 0 ; i < n ; ++i) factors_sh[i] = 0;
+        return;
+    }
+    const double rescaled_z = spectrum.stretching.rescaled_z(z,eta);
+    const double* const k = spectrum.k.data();
+    const double* const attenuation = spectrum.depth_attenuation.data();
+    const double two_h = 2*spectrum.depth;
+    for (size_t i = 0 ; i < n ; ++i)
+    {
+        if ((i > 0) and (k[i] == k[i-1]))
+        {
+            factors[i] = factors[i-1];
+            factors_sh[i] = factors_sh[i-1];
+        }
+        else if (spectrum.depth > 0)
+        {
+            const double e1 = exp(-k[i]*rescaled_z);
+            const double e2 = exp(-k[i]*(two_h-rescaled_z));
+            factors[i] = attenuation[i]*(e1 + e2);
+            factors_sh[i] = attenuation[i]*(e1 - e2);
+        }
+        else
+        {
+            factors[i] = exp(-k[i]*rescaled_z);
+            factors_sh[i] = factors[i];
+        }
+    }
+}
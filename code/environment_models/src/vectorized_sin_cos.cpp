@@ -0,0 +1,111 @@
+/*
+ * vectorized_sin_cos.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: cady
+ */
+
+#include <cmath>
+
+#include "InternalErrorException.hpp"
+#include "vectorized_sin_cos.hpp"
+
+// Beyond that, q*PIO2_1 is no longer exact & we fall back to std::sin & std::cos
+#define MAX_ANGLE_FOR_REDUCTION 1E6
+#define TWO_OVER_PI 6.36619772367581382433e-01
+// pi/2 = PIO2_1 + PIO2_2 + PIO2_3, where PIO2_1 & PIO2_2 only have 33 significant bits (fdlibm)
+#define PIO2_1 1.57079632673412561417e+00
+#define PIO2_2 6.07710050630396597660e-11
+#define PIO2_3 2.02226624871116645580e-21
+// Adding then subtracting 1.5*2^52 rounds to the nearest integer
+#define ROUNDING_CONSTANT 6755399441055744.0
+// Coefficients of fdlibm's __kernel_sin & __kernel_cos, valid on [-pi/4,pi/4]
+#define S1 -1.66666666666666324348e-01
+#define S2  8.33333333332248946124e-03
+#define S3 -1.98412698298579493134e-04
+#define S4  2.75573137070700676789e-06
+#define S5 -2.50507602534068634195e-08
+#define S6  1.58969099521155010221e-10
+#define C1  4.16666666666666019037e-02
+#define C2 -1.38888888888741095749e-03
+#define C3  2.48015872894767294178e-05
+#define C4 -2.75573143513906633035e-07
+#define C5  2.08757232129817482790e-09
+#define C6 -1.13596475577881948265e-11
+
+namespace
+{
+    // Rounds to the nearest integer without calling a (non-vectorizable) function
+    inline double round_to_int(const double x)
+    {
+        return (x + ROUNDING_CONSTANT) - ROUNDING_CONSTANT;
+    }
+
+    // Inlined in the loops below. No branches & no comparisons (which cannot be turned into
+    // vector selects with -ftrapping-math), so the compiler can vectorize them.
+    // Results are meaningless for angles beyond MAX_ANGLE_FOR_REDUCTION: they are overwritten by the caller.
+    inline void reduced_sin_cos(const double x, double& s, double& c)
+    {
+        const double q = round_to_int(x*TWO_OVER_PI);
+        const double r = ((x - q*PIO2_1) - q*PIO2_2) - q*PIO2_3;
+        const double z = r*r;
+        const double sin_r = r + r*z*(S1+z*(S2+z*(S3+z*(S4+z*(S5+z*S6)))));
+        const double cos_r = 1. - (0.5*z - z*z*(C1+z*(C2+z*(C3+z*(C4+z*(C5+z*C6))))));
+        // sin(r + q*pi/2) & cos(r + q*pi/2) depend on the quadrant m = q mod 4 (0, 1, 2 or 3)
+        // q/4 - 3/8 and m/2 - 1/4 are never halfway between two integers, so rounding them gives the floor
+        const double m = q - 4*round_to_int(0.25*q - 0.375);
+        const double sin_is_negative = round_to_int(0.5*m - 0.25); // m = 2 or 3
+        const double odd = m - 2*sin_is_negative;                  // m = 1 or 3
+        const double cos_is_negative = sin_is_negative + odd - 2*sin_is_negative*odd; // m = 1 or 2
+        // Multiplications by 0, 1 or -1 are exact
+        s = (1-2*sin_is_negative)*(odd*cos_r + (1-odd)*sin_r);
+        c = (1-2*cos_is_negative)*(odd*sin_r + (1-odd)*cos_r);
+    }
+
+    void check_sizes(const std::vector<double>& theta, const std::vector<double>& output)
+    {
+        if (output.size() != theta.size())
+        {
+            THROW(__PRETTY_FUNCTION__, InternalErrorException, "Output vector should have the same size as the input vector (" << theta.size() << ") but got " << output.size());
+        }
+    }
+}
+
+void vectorized_sin(const std::vector<double>& theta, std::vector<double>& sin_theta)
+{
+    check_sizes(theta, sin_theta);
+    const size_t n = theta.size();
+    const double* const x = theta.data();
+    double* const s = sin_theta.data();
+    for (size_t i = 0 ; i < n ; ++i)
+    {
+        double c;
+        reduced_sin_cos(x[i], s[i], c);
+    }
+    for (size_t i = 0 ; i < n ; ++i)
+    {
+        if (not(std::abs(x[i]) <= MAX_ANGLE_FOR_REDUCTION)) s[i] = std::sin(x[i]);
+    }
+}
+
+void vectorized_sin_cos(const std::vector<double>& theta, std::vector<double>& sin_theta, std::vector<double>& cos_theta)
+{
+    check_sizes(theta, sin_theta);
+    check_sizes(theta, cos_theta);
+    const size_t n = theta.size();
+    const double* const x = theta.data();
+    double* const s = sin_theta.data();
+    double* const c = cos_theta.data();
+    for (size_t i = 0 ; i < n ; ++i)
+    {
+        reduced_sin_cos(x[i], s[i], c[i]);
+    }
+    for (size_t i = 0 ; i < n ; ++i)
+    {
+        if (not(std::abs(x[i]) <= MAX_ANGLE_FOR_REDUCTION))
+        {
+            s[i] = std::sin(x[i]);
+            c[i] = std::cos(x[i]);
+        }
+    }
+}
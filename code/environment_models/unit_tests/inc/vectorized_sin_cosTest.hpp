@@ -0,0 +1,25 @@
+/*
+ * vectorized_sin_cosTest.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: cady
+ */
+
+#ifndef VECTORIZED_SIN_COSTEST_HPP_
+#define VECTORIZED_SIN_COSTEST_HPP_
+
+#include "gtest/gtest.h"
+#include <ssc/random_data_generator.hpp>
+
+class vectorized_sin_cosTest : public ::testing::Test
+{
+    protected:
+        vectorized_sin_cosTest();
+        virtual ~vectorized_sin_cosTest();
+        virtual void SetUp();
+        virtual void TearDown();
+        ssc::random_data_generator::DataGenerator a;
+
+};
+
+#endif  /* VECTORIZED_SIN_COSTEST_HPP_ */
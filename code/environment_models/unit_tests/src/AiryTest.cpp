@@ -11,6 +11,7 @@
 #include "Cos2sDirectionalSpreading.hpp"
 #include "DiracSpectralDensity.hpp"
 #include "DiracDirectionalSpreading.hpp"
+#include "JonswapSpectrum.hpp"
 #include "SumOfWaveSpectralDensities.hpp"
 #include "SumOfWaveDirectionalSpreadings.hpp"
 
@@ -799,3 +800,71 @@ TEST_F(AiryTest, get_dynamic_pressure_and_orbital_velocities_should_be_0_above_w
         ASSERT_DOUBLE_EQ(0, wave.get_orbital_velocity(g, x, y, z, t, eta).m.col(0).norm());
     }
 }
+
+TEST_F(AiryTest, vectorized_kernels_should_match_scalar_computation)
+{
+    const double g = 9.81;
+    const double rho = 1026;
+    YamlStretching ys;
+    ys.h = 0;
+    ys.delta = 1;
+    const Stretching stretching(ys);
+    const JonswapSpectrum S(5, 10, 3.3);
+    const Cos2sDirectionalSpreading D(PI/3, 2);
+    for (const double h : {0., 400.})
+    {
+        const DiscreteDirectionalWaveSpectrum A = h > 0 ? discretize(S, D, 0.3, 4, 30, h, stretching)
+                                                        : discretize(S, D, 0.3, 4, 30, stretching);
+        const Airy wave(A, 54);
+        const FlatDiscreteDirectionalWaveSpectrum spectrum = wave.get_flat_spectrum();
+        const auto pdyn_factor = [h,&stretching](const double k, const double z, const double eta){return h > 0 ? dynamic_pressure_factor(k,z,h,eta,stretching) : dynamic_pressure_factor(k,z,eta,stretching);};
+        const auto pdyn_factor_sh = [h,&stretching](const double k, const double z, const double eta){return h > 0 ? dynamic_pressure_factor_sh(k,z,h,eta,stretching) : dynamic_pressure_factor(k,z,eta,stretching);};
+        const size_t n = spectrum.a.size();
+        const std::vector<double> rao_module = a.random_vector_of<double>().of_size(n).between(0, 10);
+        const std::vector<double> rao_phase = a.random_vector_of<double>().of_size(n).between(-PI, PI);
+        for (const double t : {0., 12.3, 3600.7})
+        {
+            std::vector<double> x, y, z;
+            for (size_t j = 0 ; j < 50 ; ++j)
+            {
+                x.push_back(a.random<double>().between(-1000, 1000));
+                y.push_back(a.random<double>().between(-1000, 1000));
+                z.push_back(a.random<double>().between(-1, 20));
+            }
+            const std::vector<double> eta = wave.get_elevation(x, y, t);
+            const std::vector<double> pdyn = wave.get_dynamic_pressure(rho, g, x, y, z, eta, t);
+            const ssc::kinematics::PointMatrix V = wave.get_orbital_velocity(g, x, y, z, t, eta);
+            for (size_t j = 0 ; j < x.size() ; ++j)
+            {
+                // Scalar computation, one sine (or cosine) per (point, component) pair
+                double eta_ref = 0, p_ref = 0, u_ref = 0, v_ref = 0, w_ref = 0;
+                for (size_t i = 0 ; i < n ; ++i)
+                {
+                    const double k = spectrum.k[i];
+                    const double theta = -spectrum.omega[i]*t + k*(x[j]*spectrum.cos_psi[i] + y[j]*spectrum.sin_psi[i]) + spectrum.phase[i];
+                    eta_ref -= spectrum.a[i]*sin(theta);
+                    if (z[j] >= eta[j])
+                    {
+                        p_ref += rho*g*spectrum.a[i]*pdyn_factor(k, z[j], eta[j])*sin(theta);
+                        const double a_k_omega = spectrum.a[i]*k/spectrum.omega[i];
+                        u_ref += g*a_k_omega*pdyn_factor(k, z[j], 0)*sin(theta)*spectrum.cos_psi[i];
+                        v_ref += g*a_k_omega*pdyn_factor(k, z[j], 0)*sin(theta)*spectrum.sin_psi[i];
+                        w_ref += g*a_k_omega*pdyn_factor_sh(k, z[j], 0)*cos(theta);
+                    }
+                }
+                ASSERT_NEAR(eta_ref, eta[j], EPS);
+                ASSERT_NEAR(p_ref, pdyn[j], EPS*rho*g);
+                ASSERT_NEAR(u_ref, (double)V.m(0,j), EPS);
+                ASSERT_NEAR(v_ref, (double)V.m(1,j), EPS);
+                ASSERT_NEAR(w_ref, (double)V.m(2,j), EPS);
+            }
+            double F_ref = 0;
+            for (size_t i = 0 ; i < n ; ++i)
+            {
+                const double theta = -spectrum.omega[i]*t + spectrum.k[i]*(x[0]*spectrum.cos_psi[i] + y[0]*spectrum.sin_psi[i]) + spectrum.phase[i];
+                F_ref -= rao_module[i]*spectrum.a[i]*sin(theta + rao_phase[i]);
+            }
+            ASSERT_NEAR(F_ref, wave.evaluate_rao(x[0], y[0], t, rao_module, rao_phase), EPS);
+        }
+    }
+}
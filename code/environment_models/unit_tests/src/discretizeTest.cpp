@@ -16,6 +16,7 @@
 #include "DiracSpectralDensity.hpp"
 #include "DiracDirectionalSpreading.hpp"
 #include "InvalidInputException.hpp"
+#include "InternalErrorException.hpp"
 #include "Stretching.hpp"
 #include "YamlWaveModelInput.hpp"
 
@@ -308,3 +309,51 @@ TEST_F(discretizeTest, dynamic_pressure_factor)
     ASSERT_DOUBLE_EQ((exp(0.14)+exp(-0.14))/(exp(0.08)+exp(-0.08)), dynamic_pressure_factor(0.2,-0.3,0.4,-0.5,s));
     //! [discretizeTest dynamic_pressure_factor example]
 }
+
+TEST_F(discretizeTest, tabulated_dynamic_pressure_factors_should_match_dynamic_pressure_factor)
+{
+    YamlStretching y;
+    y.h = 20;
+    y.delta = 0.5;
+    const Stretching stretching(y);
+    const JonswapSpectrum S(5, 10, 3.3);
+    const Cos2sDirectionalSpreading D(PI/3, 2);
+    for (const double h : {0., 50.})
+    {
+        //! [discretizeTest dynamic_pressure_factors example]
+        DiscreteDirectionalWaveSpectrum A = h > 0 ? discretize(S, D, 0.3, 4, 30, h, stretching)
+                                                  : discretize(S, D, 0.3, 4, 30, stretching);
+        A.phase = std::vector<std::vector<double> >(A.omega.size(), std::vector<double>(A.psi.size(), 0));
+        const FlatDiscreteDirectionalWaveSpectrum spectrum = flatten(A);
+        const size_t n = spectrum.k.size();
+        std::vector<double> factors(n), factors_sh(n), factors_alone(n);
+        for (size_t j = 0 ; j < 100 ; ++j)
+        {
+            const double z = a.random<double>().between(-2, 60);
+            const double eta = a.random<double>().between(-1, 1);
+            dynamic_pressure_factors(spectrum, z, eta, factors_alone);
+            dynamic_pressure_factors(spectrum, z, eta, factors, factors_sh);
+            //! [discretizeTest dynamic_pressure_factors example]
+            for (size_t i = 0 ; i < n ; ++i)
+            {
+                const double k = spectrum.k[i];
+                const double expected = h > 0 ? dynamic_pressure_factor(k, z, h, eta, stretching) : dynamic_pressure_factor(k, z, eta, stretching);
+                const double expected_sh = h > 0 ? dynamic_pressure_factor_sh(k, z, h, eta, stretching) : expected;
+                ASSERT_NEAR(expected, factors_alone[i], 1E-12*(1+std::abs(expected)));
+                ASSERT_NEAR(expected, factors[i], 1E-12*(1+std::abs(expected)));
+                ASSERT_NEAR(expected_sh, factors_sh[i], 1E-12*(1+std::abs(expected_sh)));
+            }
+        }
+    }
+}
+
+TEST_F(discretizeTest, dynamic_pressure_factors_should_throw_if_output_does_not_have_the_right_size)
+{
+    YamlStretching y;
+    const Stretching s(y);
+    DiscreteDirectionalWaveSpectrum A = discretize(JonswapSpectrum(5, 10, 3.3), Cos2sDirectionalSpreading(PI/3, 2), 0.3, 4, 10, 50, s);
+    A.phase = std::vector<std::vector<double> >(A.omega.size(), std::vector<double>(A.psi.size(), 0));
+    const FlatDiscreteDirectionalWaveSpectrum spectrum = flatten(A);
+    std::vector<double> factors(spectrum.k.size()+1);
+    ASSERT_THROW(dynamic_pressure_factors(spectrum, 3, 0, factors), InternalErrorException);
+}
@@ -0,0 +1,106 @@
+/*
+ * vectorized_sin_cosTest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: cady
+ */
+
+#define _USE_MATH_DEFINE
+#include <cmath>
+#define PI M_PI
+
+#include "vectorized_sin_cosTest.hpp"
+#include "vectorized_sin_cos.hpp"
+#include "InternalErrorException.hpp"
+
+vectorized_sin_cosTest::vectorized_sin_cosTest() : a(ssc::random_data_generator::DataGenerator(1212))
+{
+}
+
+vectorized_sin_cosTest::~vectorized_sin_cosTest()
+{
+}
+
+void vectorized_sin_cosTest::SetUp()
+{
+}
+
+void vectorized_sin_cosTest::TearDown()
+{
+}
+
+#define EPS 1E-15
+
+TEST_F(vectorized_sin_cosTest, example)
+{
+//! [vectorized_sin_cosTest example]
+    const std::vector<double> theta{0, PI/6, PI/2, -3*PI/4, 10};
+    std::vector<double> sin_theta(theta.size());
+    std::vector<double> cos_theta(theta.size());
+    vectorized_sin_cos(theta, sin_theta, cos_theta);
+//! [vectorized_sin_cosTest example]
+//! [vectorized_sin_cosTest expected output]
+    ASSERT_NEAR(0, sin_theta[0], EPS);
+    ASSERT_NEAR(0.5, sin_theta[1], EPS);
+    ASSERT_NEAR(1, sin_theta[2], EPS);
+    ASSERT_NEAR(-sqrt(2)/2, sin_theta[3], EPS);
+    ASSERT_NEAR(sin(10.), sin_theta[4], EPS);
+    ASSERT_NEAR(1, cos_theta[0], EPS);
+    ASSERT_NEAR(sqrt(3)/2, cos_theta[1], EPS);
+    ASSERT_NEAR(0, cos_theta[2], EPS);
+    ASSERT_NEAR(-sqrt(2)/2, cos_theta[3], EPS);
+    ASSERT_NEAR(cos(10.), cos_theta[4], EPS);
+//! [vectorized_sin_cosTest expected output]
+}
+
+TEST_F(vectorized_sin_cosTest, should_match_std_sin_and_cos_in_all_quadrants)
+{
+    for (const double max_angle : {1., 10., 1E3, 1E5, 1E6})
+    {
+        const std::vector<double> theta = a.random_vector_of<double>().of_size(1000).between(-max_angle, max_angle);
+        std::vector<double> sin_theta(theta.size());
+        std::vector<double> cos_theta(theta.size());
+        std::vector<double> sin_only(theta.size());
+        vectorized_sin_cos(theta, sin_theta, cos_theta);
+        vectorized_sin(theta, sin_only);
+        for (size_t i = 0 ; i < theta.size() ; ++i)
+        {
+            ASSERT_NEAR(sin(theta[i]), sin_theta[i], EPS) << "theta = " << theta[i];
+            ASSERT_NEAR(cos(theta[i]), cos_theta[i], EPS) << "theta = " << theta[i];
+            ASSERT_EQ(sin_theta[i], sin_only[i]) << "theta = " << theta[i];
+        }
+    }
+}
+
+TEST_F(vectorized_sin_cosTest, should_fall_back_to_std_functions_for_huge_angles)
+{
+    const std::vector<double> theta{1E7, -3.5E9, 1E300, 2};
+    std::vector<double> sin_theta(theta.size());
+    std::vector<double> cos_theta(theta.size());
+    vectorized_sin_cos(theta, sin_theta, cos_theta);
+    for (size_t i = 0 ; i < theta.size() ; ++i)
+    {
+        ASSERT_NEAR(sin(theta[i]), sin_theta[i], EPS);
+        ASSERT_NEAR(cos(theta[i]), cos_theta[i], EPS);
+    }
+}
+
+TEST_F(vectorized_sin_cosTest, should_propagate_nans)
+{
+    const std::vector<double> theta{1, std::nan(""), 3};
+    std::vector<double> sin_theta(theta.size());
+    vectorized_sin(theta, sin_theta);
+    ASSERT_FALSE(std::isnan(sin_theta[0]));
+    ASSERT_TRUE(std::isnan(sin_theta[1]));
+    ASSERT_FALSE(std::isnan(sin_theta[2]));
+}
+
+TEST_F(vectorized_sin_cosTest, should_throw_if_output_does_not_have_the_right_size)
+{
+    const std::vector<double> theta(10, 1);
+    std::vector<double> sin_theta(9);
+    std::vector<double> cos_theta(10);
+    ASSERT_THROW(vectorized_sin(theta, sin_theta), InternalErrorException);
+    ASSERT_THROW(vectorized_sin_cos(theta, sin_theta, cos_theta), InternalErrorException);
+    ASSERT_THROW(vectorized_sin_cos(theta, cos_theta, sin_theta), InternalErrorException);
+}
@@ -21,6 +21,7 @@ struct XdynCommandLineArguments
     double initial_timestep;
     double tstart;
     double tend;
+    size_t nb_of_threads;
     bool catch_exceptions;
     bool empty() const;
 };
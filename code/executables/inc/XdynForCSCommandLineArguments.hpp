@@ -23,6 +23,9 @@ struct XdynForCSCommandLineArguments
     bool verbose;
     bool show_help;
     bool show_websocket_debug_information;
+    size_t nb_of_threads;
+    double session_timeout;
+    size_t max_nb_of_sessions;
 };
 
 #endif /* EXECUTABLES_INC_XDYNFORCSCOMMANDLINEARGUMENTS_HPP_ */
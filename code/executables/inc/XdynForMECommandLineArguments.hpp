@@ -21,6 +21,7 @@ struct XdynForMECommandLineArguments
     bool verbose;
     bool show_help;
     bool show_websocket_debug_information;
+    size_t nb_of_threads;
 };
 
 
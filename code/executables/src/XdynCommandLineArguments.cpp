@@ -14,6 +14,7 @@ XdynCommandLineArguments::XdynCommandLineArguments() : yaml_filenames(),
                          initial_timestep(0),
                          tstart(0),
                          tend(0),
+                         nb_of_threads(1),
                          catch_exceptions(false)
 {
 }
@@ -0,0 +1,24 @@
+/*
+ * benchmark.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: cady
+ */
+
+#include <chrono>
+#include <iostream>
+
+#include "benchmark.hpp"
+
+double duration_in_seconds(const std::function<void()>& f)
+{
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void print_throughput(const std::string& what, const size_t nb_of_evaluations, const double duration)
+{
+    std::cout << what << ": " << nb_of_evaluations << " evaluations in " << duration << " s ("
+              << double(nb_of_evaluations)/duration << " evaluations/s)" << std::endl;
+}
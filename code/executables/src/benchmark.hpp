@@ -0,0 +1,22 @@
+/*
+ * benchmark.hpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: cady
+ */
+
+#ifndef BENCHMARK_HPP_
+#define BENCHMARK_HPP_
+
+#include <functional>
+#include <string>
+
+/**  \brief Wall-clock time taken by f(), in seconds
+  */
+double duration_in_seconds(const std::function<void()>& f);
+
+/**  \brief Prints "<what>: <n> evaluations in <duration> s (<n/duration> evaluations/s)" on std::cout
+  */
+void print_throughput(const std::string& what, const size_t nb_of_evaluations, const double duration);
+
+#endif /* BENCHMARK_HPP_ */
@@ -23,13 +23,14 @@
 
 struct GZOptions
 {
-    GZOptions() : dphi(0), phi_max(0), stl_filename(), yaml_files(), output_csv_file()
+    GZOptions() : dphi(0), phi_max(0), stl_filename(), yaml_files(), output_csv_file(), nb_of_threads(0)
     {}
     double dphi;
     double phi_max;
     std::string stl_filename;
     std::vector<std::string> yaml_files;
     std::string output_csv_file;
+    size_t nb_of_threads;
     bool empty() const
     {
         return (dphi==0) and (phi_max == 0) and stl_filename.empty() and yaml_files.empty() and output_csv_file.empty();
@@ -74,6 +75,7 @@ po::options_description gz_options(GZOptions& input_data)
         ("dphi",    po::value<double>(&input_data.dphi),                                    "Roll angle step (in degrees)")
         ("phi_max", po::value<double>(&input_data.phi_max),                                 "Maximum roll angle (in degrees)")
         ("csv,c",   po::value<std::string>(&input_data.output_csv_file)->default_value(""), "Name of the output CSV file (optional)")
+        ("threads", po::value<size_t>(&input_data.nb_of_threads)->default_value(0),         "Number of threads computing the righting levers (each with its own simulator). Default (0): one per core.")
     ;
     return desc;
 }
@@ -106,9 +108,10 @@ int main(int argc, char** argv)
             {
                 const ssc::text_file_reader::TextFileReader yaml_reader(input_data.yaml_files);
                 const ssc::text_file_reader::TextFileReader stl_reader(input_data.stl_filename);
-                const Sim sim = GZ::make_sim(yaml_reader.get_contents(), stl_reader.get_contents());
-                const GZ::Curve calculate(sim);
-                const auto phis = calculate.get_phi(input_data.dphi*PI/180., input_data.phi_max*PI/180.);
+                const std::string yaml = yaml_reader.get_contents();
+                const std::string stl = stl_reader.get_contents();
+                const auto phis = GZ::Curve::get_phi(input_data.dphi*PI/180., input_data.phi_max*PI/180.);
+                const auto gz = GZ::compute_gz([&yaml,&stl](){return GZ::make_sim(yaml, stl);}, phis, input_data.nb_of_threads);
                 std::ofstream of;
 
                 if (not(input_data.output_csv_file.empty()))
@@ -119,9 +122,9 @@ int main(int argc, char** argv)
                 std::ostream& os = input_data.output_csv_file.empty() ? std::cout : of;
                 const char sep = input_data.output_csv_file.empty() ? '\t' : ';';
                 write<std::string>(os,"Phi [deg]", "GZ(phi) [m]", sep);
-                for (auto phi:phis)
+                for (size_t i = 0 ; i < phis.size() ; ++i)
                 {
-                    write(os, phi*180./PI, calculate.gz(phi), sep);
+                    write(os, phis[i]*180./PI, gz[i], sep);
                 }
             };
         report_xdyn_exceptions_to_user(f, [](const std::string& s){std::cerr << s;});
@@ -48,6 +48,7 @@ po::options_description attach_command_line_arguments_to_options_description(Xdy
         ("tend",       po::value<double>(&input_data.tend),                              "Last time step")
         ("output,o",   po::value<std::string>(&input_data.output_filename),              "Name of the output file where all computed data will be exported.\nPossible values/extensions are csv, tsv, json, hdf5, h5, ws")
         ("waves,w",    po::value<std::string>(&input_data.wave_output),                  "Name of the output file where the wave heights will be stored ('output' section of the YAML file). In case output is made to a HDF5 file or web sockets, this option appends the wave height to the main output")
+        ("threads",    po::value<size_t>(&input_data.nb_of_threads)->default_value(1),   "Number of threads computing the forces integrated on the hull (Froude-Krylov, hydrostatic). Results are reproducible for a given number of threads. Default (1): sequential. 0: one per core.")
         ("debug,d",                                                                      "Used by the application's support team to help error diagnosis. Allows us to pinpoint the exact location in code where the error occurred (do not catch exceptions), eg. for use in a debugger.")
     ;
     return desc;
@@ -36,6 +36,11 @@ bool invalid(const XdynForCSCommandLineArguments& input)
         std::cerr << "Error: you cannot start this websocket server on port " << input.port << ": only range 1024-65535 is available." << std::endl;
         return true;
     }
+    if (not(input.session_timeout > 0))
+    {
+        std::cerr << "Error: the session timeout should be strictly positive." << std::endl;
+        return true;
+    }
     return false;
 }
 
@@ -51,6 +56,9 @@ po::options_description get_options_description(XdynForCSCommandLineArguments& i
         ("websocket-debug,w",                                                            "Display *all* websocket-related information (connect/disconnect, payload, etc.): very chatty.")
         ("debug,d",                                                                      "Used by the application's support team to help error diagnosis. Allows us to pinpoint the exact location in code where the error occurred (do not catch exceptions), eg. for use in a debugger.")
         ("port,p",     po::value<short unsigned int>(&input_data.port),                  "port for the websocket server. Available values are 1024-65535 (2^16, but port 0 is reserved and unavailable and ports in range 1-1023 are privileged (application needs to be run as root to have access to those ports)")
+        ("threads",    po::value<size_t>(&input_data.nb_of_threads)->default_value(0),   "Number of worker threads (each with its own simulator) processing the requests. Default (0): one per core.")
+        ("session-timeout", po::value<double>(&input_data.session_timeout)->default_value(600), "Co-simulation sessions which have not received any request for that long (in seconds) are forgotten.")
+        ("max-sessions", po::value<size_t>(&input_data.max_nb_of_sessions)->default_value(100), "Maximum number of co-simulation sessions open at the same time.")
         ;
     return desc;
 }
@@ -0,0 +1,69 @@
+/*
+ * test_diffraction_spectra.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: cady
+ */
+
+// Cost of the flat directional spectra in a diffraction case (test ship, two wave spectra)
+// Usage: test_diffraction_spectra [nb of evaluations] [nb of frequencies (& directions)]
+// Writes test_ship.hdb in the current directory (as the diffraction model reads it from there).
+// The spectra used to be copied at each call to get_flat_directional_spectra: the
+// "Copy of the flat spectra" line shows what each evaluation of the diffraction model
+// used to spend on that.
+
+#include "benchmark.hpp"
+#include "generate_test_ship.hpp"
+#include "hdb_data.hpp"
+#include "simulator_api.hpp"
+#include "yaml_data.hpp"
+
+#include <boost/algorithm/string/replace.hpp>
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#define N 1000
+#define NFREQ 50
+
+std::string get_yaml(const size_t nfreq);
+std::string get_yaml(const size_t nfreq)
+{
+    std::stringstream ss;
+    ss << "n: " << nfreq << "\n";
+    std::string yaml = test_data::test_ship_diffraction();
+    boost::replace_all(yaml, "n: 10\n", ss.str());
+    return yaml;
+}
+
+int main(int argc, char* argv[])
+{
+    const size_t n = argc>1 ? (size_t)atoi(argv[1]) : N;
+    const size_t nfreq = argc>2 ? (size_t)atoi(argv[2]) : NFREQ;
+    {
+        std::ofstream hdb("test_ship.hdb");
+        hdb << test_data::test_ship_hdb();
+    }
+    Sim sys = get_system(get_yaml(nfreq), test_ship(), 0);
+    const SurfaceElevationPtr w = sys.get_env().w;
+    const FlatDiscreteDirectionalWaveSpectraPtr spectra = w->get_flat_directional_spectra(0, 0, 0);
+    size_t nb_of_components = 0;
+    for (const auto& spectrum:*spectra) nb_of_components += spectrum.a.size();
+    std::cout << spectra->size() << " spectra, " << nb_of_components << " components" << std::endl;
+
+    size_t total_size = 0;
+    const double t_shared = duration_in_seconds([&](){for (size_t i = 0 ; i < n ; ++i) total_size += w->get_flat_directional_spectra(0, 0, 0)->size();});
+    print_throughput("Shared flat spectra", n, t_shared);
+    const double t_copy = duration_in_seconds([&](){for (size_t i = 0 ; i < n ; ++i) total_size += std::vector<FlatDiscreteDirectionalWaveSpectrum>(*spectra).size();});
+    print_throughput("Copy of the flat spectra", n, t_copy);
+
+    StateType dx_dt(sys.state.size(), 0);
+    const double dt = 0.01;
+    const double t_dx_dt = duration_in_seconds([&](){for (size_t i = 0 ; i < n ; ++i) sys.dx_dt(sys.state, dx_dt, double(i)*dt);});
+    print_throughput("Diffraction case (dx_dt)", n, t_dx_dt);
+    std::cout << "Copying the flat spectra would add " << 100*t_copy/t_dx_dt << "% to each evaluation of dx_dt"
+              << " (" << total_size << " spectra handled)" << std::endl;
+    return 0;
+}
@@ -0,0 +1,118 @@
+/*
+ * test_dx_dt.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: cady
+ */
+
+// Overhead of Sim::dx_dt (kinematics, states & sums of forces) on one or several bodies, without any costly force model
+// Usage: test_dx_dt [nb of evaluations] [nb of bodies] [1 to add a gravity force model to each body]
+// (eg. 12 bodies for towing & mooring scenarios)
+
+#include "benchmark.hpp"
+#include "simulator_api.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+
+#define N 100000
+
+std::string get_body_yaml(const std::string& name, const bool gravity);
+std::string get_body_yaml(const std::string& name, const bool gravity)
+{
+    std::stringstream ss;
+    ss << "  - name: " << name << "\n"
+       << "    position of body frame relative to mesh:\n"
+       << "        frame: mesh\n"
+       << "        x: {value: 0, unit: m}\n"
+       << "        y: {value: 0, unit: m}\n"
+       << "        z: {value: 0, unit: m}\n"
+       << "        phi: {value: 0, unit: rad}\n"
+       << "        theta: {value: 0, unit: rad}\n"
+       << "        psi: {value: 0, unit: rad}\n"
+       << "    initial position of body frame relative to NED:\n"
+       << "        frame: NED\n"
+       << "        x: {value: 4, unit: m}\n"
+       << "        y: {value: 8, unit: m}\n"
+       << "        z: {value: 12, unit: m}\n"
+       << "        phi: {value: 0, unit: rad}\n"
+       << "        theta: {value: 0, unit: rad}\n"
+       << "        psi: {value: 0, unit: rad}\n"
+       << "    initial velocity of body frame relative to NED:\n"
+       << "        frame: " << name << "\n"
+       << "        u: {value: 1, unit: m/s}\n"
+       << "        v: {value: 0, unit: m/s}\n"
+       << "        w: {value: 0, unit: m/s}\n"
+       << "        p: {value: 0, unit: rad/s}\n"
+       << "        q: {value: 0.1, unit: rad/s}\n"
+       << "        r: {value: 0, unit: rad/s}\n"
+       << "    dynamics:\n"
+       << "        hydrodynamic forces calculation point in body frame:\n"
+       << "            x: {value: 0.696, unit: m}\n"
+       << "            y: {value: 0, unit: m}\n"
+       << "            z: {value: 1.418, unit: m}\n"
+       << "        centre of inertia:\n"
+       << "            frame: " << name << "\n"
+       << "            x: {value: 0, unit: m}\n"
+       << "            y: {value: 0, unit: m}\n"
+       << "            z: {value: 0.5, unit: m}\n"
+       << "        rigid body inertia matrix at the center of gravity and projected in the body frame:\n"
+       << "            row 1: [1E6,0,0,0,0,0]\n"
+       << "            row 2: [0,1E6,0,0,0,0]\n"
+       << "            row 3: [0,0,1E6,0,0,0]\n"
+       << "            row 4: [0,0,0,1E6,0,0]\n"
+       << "            row 5: [0,0,0,0,1E6,0]\n"
+       << "            row 6: [0,0,0,0,0,1E6]\n"
+       << "        added mass matrix at the center of gravity and projected in the body frame:\n"
+       << "            row 1: [0,0,0,0,0,0]\n"
+       << "            row 2: [0,0,0,0,0,0]\n"
+       << "            row 3: [0,0,0,0,0,0]\n"
+       << "            row 4: [0,0,0,0,0,0]\n"
+       << "            row 5: [0,0,0,0,0,0]\n"
+       << "            row 6: [0,0,0,0,0,0]\n";
+    if (gravity)
+    {
+        ss << "    external forces:\n"
+           << "      - model: gravity\n";
+    }
+    return ss.str();
+}
+
+std::string get_yaml(const size_t nb_of_bodies, const bool gravity);
+std::string get_yaml(const size_t nb_of_bodies, const bool gravity)
+{
+    std::stringstream ss;
+    ss << "rotations convention: [psi, theta', phi'']\n"
+       << "\n"
+       << "environmental constants:\n"
+       << "    g: {value: 9.81, unit: m/s^2}\n"
+       << "    rho: {value: 1000, unit: kg/m^3}\n"
+       << "    nu: {value: 1.18e-6, unit: m^2/s}\n"
+       << "environment models: []\n"
+       << "\n"
+       << "bodies: # All bodies have NED as parent frame\n";
+    for (size_t i = 0 ; i < nb_of_bodies ; ++i)
+    {
+        std::stringstream name;
+        name << "body_" << i+1;
+        ss << get_body_yaml(name.str(), gravity);
+    }
+    return ss.str();
+}
+
+int main(int argc, char* argv[])
+{
+    const size_t n = argc>1 ? (size_t)atoi(argv[1]) : N;
+    const size_t nb_of_bodies = argc>2 ? (size_t)atoi(argv[2]) : 1;
+    const bool gravity = argc>3 and atoi(argv[3]);
+    Sim sys = get_system(get_yaml(nb_of_bodies, gravity), 0);
+    StateType dx_dt(sys.state.size(), 0);
+    const double dt = 0.01;
+    const double t = duration_in_seconds([&](){for (size_t i = 0 ; i < n ; ++i) sys.dx_dt(sys.state, dx_dt, double(i)*dt);});
+    std::stringstream ss;
+    ss << "dx_dt (" << nb_of_bodies << " bod" << (nb_of_bodies > 1 ? "ies" : "y") << ", " << (gravity ? "gravity" : "no force model") << ")";
+    print_throughput(ss.str(), n, t);
+    std::cout << "    " << 1E6*t/double(n) << " microseconds per evaluation, " << 1E6*t/double(n*nb_of_bodies) << " per body" << std::endl;
+    return 0;
+}
@@ -0,0 +1,112 @@
+/*
+ * test_finite_depth_factors.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: cady
+ */
+
+// Cost of the finite depth dynamic pressure factors, for each component of a flat spectrum
+// Usage: test_finite_depth_factors [nb of points] [nb of frequencies (& directions)]
+// Compares the factors tabulated by 'flatten' (dynamic_pressure_factors) with a call to
+// a std::function per component (which is what the spectra used to store), then times
+// the dynamic pressure & orbital velocities computed by Airy.
+
+#include "Airy.hpp"
+#include "benchmark.hpp"
+#include "Cos2sDirectionalSpreading.hpp"
+#include "discretize.hpp"
+#include "JonswapSpectrum.hpp"
+#include "Stretching.hpp"
+#include "YamlWaveModelInput.hpp"
+
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+
+#define N 2000
+#define NFREQ 50
+
+#define _USE_MATH_DEFINE
+#include <cmath>
+#define PI M_PI
+
+int main(int argc, char* argv[])
+{
+    const size_t n = argc>1 ? (size_t)atoi(argv[1]) : N;
+    const size_t nfreq = argc>2 ? (size_t)atoi(argv[2]) : NFREQ;
+    const double h = 100;
+    const double g = 9.81;
+    const double rho = 1000;
+    YamlStretching ys;
+    ys.h = 0;
+    ys.delta = 1;
+    const Stretching stretching(ys);
+    const DiscreteDirectionalWaveSpectrum A = discretize(JonswapSpectrum(5, 10, 1.2), Cos2sDirectionalSpreading(PI/4, 2), 0.3, 3, nfreq, h, stretching);
+    const Airy wave(A, 0);
+    const FlatDiscreteDirectionalWaveSpectrum& spectrum = wave.get_flat_spectrum();
+    const size_t nb_of_components = spectrum.k.size();
+    std::cout << nb_of_components << " components, " << n << " points" << std::endl;
+
+    std::vector<double> z(n);
+    for (size_t i = 0 ; i < n ; ++i) z[i] = 20*double(i)/double(n);
+    const double eta = 0.5;
+    std::vector<double> factors(nb_of_components);
+    std::vector<double> factors_sh(nb_of_components);
+    double sum = 0;
+
+    const std::function<double(double,double,double)> pdyn_factor = [h, &stretching](const double k, const double z_, const double eta_){return dynamic_pressure_factor(k, z_, h, eta_, stretching);};
+    const std::function<double(double,double,double)> pdyn_factor_sh = [h, &stretching](const double k, const double z_, const double eta_){return dynamic_pressure_factor_sh(k, z_, h, eta_, stretching);};
+    const double t_functor = duration_in_seconds([&]()
+        {
+            for (size_t i = 0 ; i < n ; ++i)
+            {
+                for (size_t j = 0 ; j < nb_of_components ; ++j) factors[j] = pdyn_factor(spectrum.k[j], z[i], eta);
+                sum += factors.back();
+            }
+        });
+    print_throughput("Dynamic pressure factors, one functor call per component", n, t_functor);
+    const double t_tabulated = duration_in_seconds([&]()
+        {
+            for (size_t i = 0 ; i < n ; ++i)
+            {
+                dynamic_pressure_factors(spectrum, z[i], eta, factors);
+                sum += factors.back();
+            }
+        });
+    print_throughput("Dynamic pressure factors, tabulated", n, t_tabulated);
+    std::cout << "    Speed-up: " << t_functor/t_tabulated << std::endl;
+
+    const double t_functor_sh = duration_in_seconds([&]()
+        {
+            for (size_t i = 0 ; i < n ; ++i)
+            {
+                for (size_t j = 0 ; j < nb_of_components ; ++j)
+                {
+                    factors[j] = pdyn_factor(spectrum.k[j], z[i], eta);
+                    factors_sh[j] = pdyn_factor_sh(spectrum.k[j], z[i], eta);
+                }
+                sum += factors_sh.back();
+            }
+        });
+    print_throughput("Orbital velocity factors, two functor calls per component", n, t_functor_sh);
+    const double t_tabulated_sh = duration_in_seconds([&]()
+        {
+            for (size_t i = 0 ; i < n ; ++i)
+            {
+                dynamic_pressure_factors(spectrum, z[i], eta, factors, factors_sh);
+                sum += factors_sh.back();
+            }
+        });
+    print_throughput("Orbital velocity factors, tabulated", n, t_tabulated_sh);
+    std::cout << "    Speed-up: " << t_functor_sh/t_tabulated_sh << std::endl;
+
+    const std::vector<double> x(n, 1);
+    const std::vector<double> y(n, 2);
+    const std::vector<double> etas(n, eta);
+    const double t_pdyn = duration_in_seconds([&](){sum += wave.get_dynamic_pressure(rho, g, x, y, z, etas, 0).back();});
+    print_throughput("Airy::get_dynamic_pressure", n, t_pdyn);
+    const double t_orbital = duration_in_seconds([&](){sum += wave.get_orbital_velocity(g, x, y, z, 0, etas).m(0, 0);});
+    print_throughput("Airy::get_orbital_velocity", n, t_orbital);
+    std::cout << "(checksum: " << sum << ")" << std::endl;
+    return 0;
+}
@@ -0,0 +1,100 @@
+/*
+ * test_radiation_damping_convolution.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: cady
+ */
+
+// Cost of the radiation damping convolution as a function of tau max, for a fixed-step solver
+// Usage: test_radiation_damping_convolution [nb of time steps] [time step]
+// Compares RadiationDampingBuilder::convolution (quadrature, for each quadrature type used by the
+// radiation damping model) with the streaming mode (FixedLagConvolution) on the same history.
+// As in the force model, the retardation function is a spline through tabulated values.
+
+#include "benchmark.hpp"
+#include "FixedLagConvolution.hpp"
+#include "hdb_data.hpp"
+#include "History.hpp"
+#include "RadiationDampingBuilder.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+
+#define N 2000
+#define DT 0.05
+#define TMIN 0.2
+
+double convolution_velocity(const double t);
+double convolution_velocity(const double t)
+{
+    return sin(0.7*t) + 0.3*cos(1.9*t);
+}
+
+std::function<double(double)> get_retardation_function(const RadiationDampingBuilder& builder, const double Tmax);
+std::function<double(double)> get_retardation_function(const RadiationDampingBuilder& builder, const double Tmax)
+{
+    std::vector<double> taus, K;
+    const size_t n = 1000;
+    for (size_t i = 0 ; i <= n ; ++i)
+    {
+        taus.push_back(Tmax*double(i)/double(n));
+        K.push_back(test_data::analytical_K(taus.back()));
+    }
+    return builder.build_interpolator(taus, K);
+}
+
+int main(int argc, char* argv[])
+{
+    const size_t n = argc>1 ? (size_t)atoi(argv[1]) : N;
+    const double dt = argc>2 ? atof(argv[2]) : DT;
+    const std::vector<std::pair<std::string,TypeOfQuadrature> > quadratures = {{"rectangle", TypeOfQuadrature::RECTANGLE},
+                                                                               {"simpson", TypeOfQuadrature::SIMPSON},
+                                                                               {"clenshaw-curtis", TypeOfQuadrature::CLENSHAW_CURTIS},
+                                                                               {"gauss-kronrod", TypeOfQuadrature::GAUSS_KRONROD}};
+    for (const double Tmax:{5., 20., 60., 120.})
+    {
+        std::cout << "tau max = " << Tmax << " s" << std::endl;
+        // Same history for all methods: the first Tmax seconds fill it
+        const size_t nb_of_steps_to_fill_history = (size_t)(Tmax/dt);
+        History h(Tmax);
+        for (size_t i = 0 ; i < nb_of_steps_to_fill_history ; ++i) h.record(dt*double(i), convolution_velocity(dt*double(i)));
+        for (const auto& quadrature:quadratures)
+        {
+            const RadiationDampingBuilder builder(quadrature.second, TypeOfQuadrature::SIMPSON);
+            const std::function<double(double)> K = get_retardation_function(builder, Tmax);
+            History h_quadrature(h);
+            double F = 0;
+            const double t = duration_in_seconds([&]()
+                {
+                    for (size_t i = 0 ; i < n ; ++i)
+                    {
+                        const double ti = dt*double(nb_of_steps_to_fill_history + i);
+                        h_quadrature.record(ti, convolution_velocity(ti));
+                        F = builder.convolution(h_quadrature, K, TMIN, Tmax);
+                    }
+                });
+            std::stringstream ss;
+            ss << "    Quadrature (" << quadrature.first << ")";
+            print_throughput(ss.str(), n, t);
+            std::cout << "        Last value: " << F << std::endl;
+        }
+        const RadiationDampingBuilder builder(TypeOfQuadrature::SIMPSON, TypeOfQuadrature::SIMPSON);
+        FixedLagConvolution convolution(get_retardation_function(builder, Tmax), TMIN, Tmax, dt);
+        // The first call samples the whole history
+        double F = convolution(h);
+        const double t = duration_in_seconds([&]()
+            {
+                for (size_t i = 0 ; i < n ; ++i)
+                {
+                    const double ti = dt*double(nb_of_steps_to_fill_history + i);
+                    h.record(ti, convolution_velocity(ti));
+                    F = convolution(h);
+                }
+            });
+        print_throughput("    Streaming (fixed lag)", n, t);
+        std::cout << "        Last value: " << F << std::endl;
+    }
+    return 0;
+}
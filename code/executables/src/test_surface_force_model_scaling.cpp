@@ -0,0 +1,162 @@
+/*
+ * test_surface_force_model_scaling.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: cady
+ */
+
+// Evaluation rate of the surface force models as a function of the number of threads
+// Usage: test_surface_force_model_scaling [nb of evaluations] [max nb of threads] [nb of refinements] [STL file]
+// Each refinement splits each facet in four (the default mesh is the test ship)
+
+#include "benchmark.hpp"
+#include "Body.hpp"
+#include "BodyBuilder.hpp"
+#include "ExactHydrostaticForceModel.hpp"
+#include "FastHydrostaticForceModel.hpp"
+#include "FroudeKrylovForceModel.hpp"
+#include "generate_test_ship.hpp"
+#include "stl_reader.hpp"
+#include "ThreadPool.hpp"
+#include "YamlRotation.hpp"
+#include "DiracSpectralDensity.hpp"
+#include "DiracDirectionalSpreading.hpp"
+#include "discretize.hpp"
+#include "Airy.hpp"
+#include "SurfaceElevationFromWaves.hpp"
+#include "Stretching.hpp"
+#include "YamlWaveModelInput.hpp"
+
+#include <ssc/kinematics.hpp>
+#include <ssc/text_file_reader.hpp>
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+
+#define BODY "body 1"
+
+#define N 200
+#define _USE_MATH_DEFINE
+#include <cmath>
+#define PI M_PI
+
+VectorOfVectorOfPoints refine(const VectorOfVectorOfPoints& mesh);
+VectorOfVectorOfPoints refine(const VectorOfVectorOfPoints& mesh)
+{
+    VectorOfVectorOfPoints ret;
+    for (const auto& facet:mesh)
+    {
+        // Polygons are split in triangles (fan), then each triangle in four
+        for (size_t i = 1 ; i+1 < facet.size() ; ++i)
+        {
+            const EPoint& a = facet[0];
+            const EPoint& b = facet[i];
+            const EPoint& c = facet[i+1];
+            const EPoint ab = (a+b)/2;
+            const EPoint bc = (b+c)/2;
+            const EPoint ca = (c+a)/2;
+            ret.push_back({a, ab, ca});
+            ret.push_back({ab, b, bc});
+            ret.push_back({ca, bc, c});
+            ret.push_back({ab, bc, ca});
+        }
+    }
+    return ret;
+}
+
+VectorOfVectorOfPoints get_mesh(const int argc, char* argv[]);
+VectorOfVectorOfPoints get_mesh(const int argc, char* argv[])
+{
+    VectorOfVectorOfPoints mesh = test_ship();
+    if (argc > 4)
+    {
+        const std::string stl_file = argv[4];
+        const ssc::text_file_reader::TextFileReader reader(stl_file);
+        mesh = read_stl(reader.get_contents());
+    }
+    const size_t nb_of_refinements = argc>3 ? (size_t)atoi(argv[3]) : 0;
+    for (size_t i = 0 ; i < nb_of_refinements ; ++i) mesh = refine(mesh);
+    return mesh;
+}
+
+BodyPtr get_body(const VectorOfVectorOfPoints& mesh);
+BodyPtr get_body(const VectorOfVectorOfPoints& mesh)
+{
+    YamlRotation rot;
+    rot.convention.push_back("z");
+    rot.convention.push_back("y'");
+    rot.convention.push_back("x''");
+    rot.order_by = "angle";
+    return BodyBuilder(rot).build(BODY, mesh, 0, 0, rot, 0);
+}
+
+TR1(shared_ptr)<WaveModel> get_wave_model();
+TR1(shared_ptr)<WaveModel> get_wave_model()
+{
+    const double psi0 = PI/4;
+    const double Hs = 3;
+    const double Tp = 10;
+    const double omega0 = 2*PI/Tp;
+    const double omega_min = 0.1;
+    const double omega_max = 5;
+    const size_t nfreq = 10;
+    YamlStretching ys;
+    ys.h = 0;
+    ys.delta = 1;
+    const Stretching ss(ys);
+    const DiscreteDirectionalWaveSpectrum A = discretize(DiracSpectralDensity(omega0, Hs), DiracDirectionalSpreading(psi0), omega_min, omega_max, nfreq, ss);
+    int random_seed = 0;
+    return TR1(shared_ptr)<WaveModel>(new Airy(A, random_seed));
+}
+
+EnvironmentAndFrames get_env(const size_t nb_of_threads);
+EnvironmentAndFrames get_env(const size_t nb_of_threads)
+{
+    EnvironmentAndFrames env;
+    env.g = 9.81;
+    env.rho = 1024;
+    env.k = ssc::kinematics::KinematicsPtr(new ssc::kinematics::Kinematics());
+    env.k->add(ssc::kinematics::Transform(ssc::kinematics::Point("NED"), "mesh(" BODY ")"));
+    env.k->add(ssc::kinematics::Transform(ssc::kinematics::Point("NED"), BODY));
+    env.w = SurfaceElevationPtr(new SurfaceElevationFromWaves(get_wave_model()));
+    // Same convention as SimulatorBuilder: no pool for a single thread
+    if (nb_of_threads > 1) env.thread_pool.reset(new ThreadPool(nb_of_threads));
+    return env;
+}
+
+double evaluation_time(const ForceModel& F, const BodyStates& states, const size_t n);
+double evaluation_time(const ForceModel& F, const BodyStates& states, const size_t n)
+{
+    return duration_in_seconds([&](){for (size_t i = 0 ; i < n ; ++i) F(states, 0);});
+}
+
+int main(int argc, char* argv[])
+{
+    const size_t n = argc>1 ? (size_t)atoi(argv[1]) : N;
+    const size_t max_nb_of_threads = get_nb_of_threads_to_use(argc>2 ? (size_t)atoi(argv[2]) : 0);
+    const VectorOfVectorOfPoints mesh = get_mesh(argc, argv);
+    std::cout << mesh.size() << " facets" << std::endl;
+    BodyPtr body = get_body(mesh);
+    const std::vector<std::string> models = {"Fast hydrostatic", "Exact hydrostatic", "Froude-Krylov"};
+    std::vector<double> sequential_durations(models.size(), 0);
+    for (size_t nb_of_threads = 1 ; nb_of_threads <= max_nb_of_threads ; ++nb_of_threads)
+    {
+        const EnvironmentAndFrames env = get_env(nb_of_threads);
+        body->update_intersection_with_free_surface(env, 0);
+        BodyStates states = body->get_states();
+        states.g_in_mesh_frame = EPoint(0, 0, env.g);
+        const double durations[] = {evaluation_time(FastHydrostaticForceModel(BODY, env), states, n),
+                                    evaluation_time(ExactHydrostaticForceModel(BODY, env), states, n),
+                                    evaluation_time(FroudeKrylovForceModel(BODY, env), states, n)};
+        for (size_t i = 0 ; i < models.size() ; ++i)
+        {
+            if (nb_of_threads == 1) sequential_durations[i] = durations[i];
+            std::stringstream ss;
+            ss << models[i] << " (" << nb_of_threads << " thread(s))";
+            print_throughput(ss.str(), n, durations[i]);
+            std::cout << "    Speed-up: " << sequential_durations[i]/durations[i] << std::endl;
+        }
+    }
+    return 0;
+}
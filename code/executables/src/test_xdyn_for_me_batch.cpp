@@ -0,0 +1,68 @@
+/*
+ * test_xdyn_for_me_batch.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: cady
+ */
+
+// Compares a batch evaluated by XdynForME with the same inputs evaluated one by one
+// Usage: test_xdyn_for_me_batch [nb of inputs] [nb of threads] [YAML file]
+// (without YAML file, the falling ball of the unit tests is used)
+
+#include "benchmark.hpp"
+#include "HistoryParser.hpp"
+#include "XdynForME.hpp"
+#include "yaml_data.hpp"
+
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+#define N 2000
+
+std::string get_yaml(const int argc, char* argv[]);
+std::string get_yaml(const int argc, char* argv[])
+{
+    if (argc <= 3) return test_data::falling_ball_example();
+    std::ifstream file(argv[3]);
+    std::stringstream ss;
+    ss << file.rdbuf();
+    return ss.str();
+}
+
+std::string get_batch(const size_t n);
+std::string get_batch(const size_t n)
+{
+    std::stringstream ss;
+    ss << std::setprecision(17) << "[";
+    for (size_t i = 0 ; i < n ; ++i)
+    {
+        ss << (i ? "," : "")
+           << "{\"states\": [{\"t\": " << 0.001*double(i) << ", \"x\": 4, \"y\": 8, \"z\": 12, \"u\": " << 0.01*double(i) << ", \"v\": 0, \"w\": 0"
+           << ", \"p\": 0, \"q\": 0, \"r\": 0, \"qr\": 1, \"qi\": 0, \"qj\": 0, \"qk\": 0}]}";
+    }
+    ss << "]";
+    return ss.str();
+}
+
+int main(int argc, char* argv[])
+{
+    const size_t n = argc>1 ? (size_t)atoi(argv[1]) : N;
+    const size_t nb_of_threads = argc>2 ? (size_t)atoi(argv[2]) : 0;
+    const std::string yaml = get_yaml(argc, argv);
+    XdynForME sequential(yaml);
+    XdynForME parallel(yaml, nb_of_threads);
+    const std::vector<SimServerInputs> inputs = parse_SimServerInputs_batch(get_batch(n), sequential.get_Tmax());
+
+    std::vector<StateType> dx_dts(n);
+    const double t_sequential = duration_in_seconds([&](){for (size_t i = 0 ; i < n ; ++i) dx_dts[i] = sequential.calculate_dx_dt(inputs[i]);});
+    const double t_batch = duration_in_seconds([&](){dx_dts = parallel.calculate_dx_dt(inputs);});
+    print_throughput("Sequential single calls", n, t_sequential);
+    std::stringstream batch;
+    batch << "Batch (" << parallel.get_nb_of_threads() << " thread(s))";
+    print_throughput(batch.str(), n, t_batch);
+    std::cout << "Speed-up: " << t_sequential/t_batch << std::endl;
+    return 0;
+}
@@ -0,0 +1,68 @@
+/*
+ * wait_for_ctrl_c.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: cady
+ */
+
+#include "wait_for_ctrl_c.hpp"
+
+#ifdef _WIN32
+// The console control handler runs in a thread of its own, so it can notify a condition variable
+#include <windows.h>
+#include <condition_variable>
+#include <mutex>
+
+std::mutex ctrl_c_mutex;
+std::condition_variable ctrl_c_pressed;
+bool ctrl_c = false;
+
+BOOL WINAPI ctrl_c_handler(DWORD event);
+BOOL WINAPI ctrl_c_handler(DWORD event)
+{
+    if (event != CTRL_C_EVENT) return FALSE;
+    {
+        std::lock_guard<std::mutex> lock(ctrl_c_mutex);
+        ctrl_c = true;
+    }
+    ctrl_c_pressed.notify_all();
+    return TRUE;
+}
+
+void prepare_to_wait_for_ctrl_c()
+{
+    SetConsoleCtrlHandler(ctrl_c_handler, TRUE);
+}
+
+void wait_for_ctrl_c()
+{
+    std::unique_lock<std::mutex> lock(ctrl_c_mutex);
+    ctrl_c_pressed.wait(lock, []{return ctrl_c;});
+}
+#else
+// A signal handler can't notify a condition variable: SIGINT is received synchronously, by sigwait
+#include <pthread.h>
+#include <csignal>
+
+sigset_t get_ctrl_c_signals();
+sigset_t get_ctrl_c_signals()
+{
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    return signals;
+}
+
+void prepare_to_wait_for_ctrl_c()
+{
+    const sigset_t signals = get_ctrl_c_signals();
+    pthread_sigmask(SIG_BLOCK, &signals, NULL);
+}
+
+void wait_for_ctrl_c()
+{
+    const sigset_t signals = get_ctrl_c_signals();
+    int signal_number = 0;
+    sigwait(&signals, &signal_number);
+}
+#endif
@@ -0,0 +1,21 @@
+/*
+ * wait_for_ctrl_c.hpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: cady
+ */
+
+#ifndef WAIT_FOR_CTRL_C_HPP_
+#define WAIT_FOR_CTRL_C_HPP_
+
+/**  \brief Prepares wait_for_ctrl_c
+  *  \details Should be called before any thread is created: on POSIX systems, SIGINT is blocked
+  *           in the calling thread & in all threads it creates afterwards, so only wait_for_ctrl_c receives it.
+  */
+void prepare_to_wait_for_ctrl_c();
+
+/**  \brief Blocks the calling thread until Ctrl+C is pressed (without polling)
+  */
+void wait_for_ctrl_c();
+
+#endif /* WAIT_FOR_CTRL_C_HPP_ */
@@ -116,6 +116,7 @@ std::string input_data_serialize(const XdynCommandLineArguments& inputData)
     s << " --tend " << inputData.tend<<" ";
     s << " --dt " << inputData.initial_timestep<<" ";
     s << " --solver "<<inputData.solver;
+    if (inputData.nb_of_threads != 1) s << " --threads " << inputData.nb_of_threads;
     if (not(inputData.output_filename.empty()))
     {
         s << " -o " << inputData.output_filename;
@@ -134,7 +135,7 @@ void run_simulation(const XdynCommandLineArguments& input_data)
     {
         const auto yaml_input = ssc::text_file_reader::TextFileReader(input_data.yaml_filenames).get_contents();
         ssc::data_source::DataSource command_listener;
-        auto sys = get_system(yaml_input, input_data.tstart);
+        auto sys = get_system(yaml_input, input_data.tstart, input_data.nb_of_threads);
         auto observers_description = build_observers_description(yaml_input, input_data);
         ListOfObservers observers(observers_description);
         serialize_context_if_necessary(observers_description, sys, yaml_input, input_data_serialize(input_data));
@@ -1,13 +1,17 @@
+#include "SimServerPool.hpp"
 #include "XdynForCS.hpp"
 #include "parse_history.hpp"
+#include "cosimulation_protobuf.hpp"
 #include "report_xdyn_exceptions_to_user.hpp"
 #include "parse_XdynForCSCommandLineArguments.hpp"
+#include "wait_for_ctrl_c.hpp"
 
 #include <ssc/websocket/WebSocketServer.hpp>
 #include <ssc/text_file_reader.hpp>
 #include <ssc/macros.hpp>
 #include TR1INC(memory)
 #include <sstream>
+#include <vector>
 
 using namespace ssc::websocket;
 
@@ -26,58 +30,83 @@ std::string replace_newlines_by_spaces(std::string str)
     return str;
 }
 
+void send_binary(const Message& msg, const std::string& payload);
+void send_binary(const Message& msg, const std::string& payload)
+{
+    msg.send_binary(std::vector<char>(payload.begin(), payload.end()));
+}
+
 struct SimulationMessage : public MessageHandler
 {
-    SimulationMessage(const TR1(shared_ptr)<SimServer>& simserver, const bool verbose_) : sim_server(simserver), verbose(verbose_)
+    SimulationMessage(const TR1(shared_ptr)<SimServerPool>& pool_, const bool verbose_) : pool(pool_), verbose(verbose_)
     {
     }
     void operator()(const Message& msg)
     {
-        const std::string input_json = msg.get_payload();
+        const std::string payload = msg.get_payload();
+        // Each client chooses its encoding with the websocket frame type: text frames are JSON requests (and get JSON responses),
+        // binary frames are protobuf requests (cf. cosimulation.proto) and get protobuf responses
+        const bool json = msg.get_opcode() != websocketpp::frame::opcode::binary;
         if (verbose)
         {
-            std::cout << current_date_time() << " Received: " << input_json << std::endl;
+            if (json) std::cout << current_date_time() << " Received: " << payload << std::endl;
+            else      std::cout << current_date_time() << " Received: binary request (" << payload.size() << " bytes)" << std::endl;
+        }
+        // The simulation is run by one of the pool's workers (each having its own simulator)
+        // so the websocket server can receive other requests (from other clients) in the meantime
+        const bool verbose_ = verbose;
+        if (json)
+        {
+            pool->post([msg, payload, verbose_](SimServer& sim_server)
+            {
+                const std::function<void(const std::string&)> quiet_error_outputter = [&msg](const std::string& what) {msg.send_text(replace_newlines_by_spaces(std::string("{\"error\": \"") + what + "\"}"));};
+                const std::function<void(const std::string&)> verbose_error_outputter = [&msg](const std::string& what) {std::cerr << current_date_time() << " Error: " << what << std::endl; msg.send_text(replace_newlines_by_spaces(std::string("{\"error\": \"") + what + "\"}"));};
+                const auto error_outputter = verbose_ ? verbose_error_outputter : quiet_error_outputter;
+                const std::function<void(void)> quiet_f = [&msg, &sim_server, &payload]() {msg.send_text(encode_YamlStates(sim_server.play_one_step(payload)));};
+                const std::function<void(void)> verbose_f = [&msg, &sim_server, &payload]() {const std::string json = encode_YamlStates(sim_server.play_one_step(payload)); std::cout << current_date_time() << " Sending: " << json << std::endl; msg.send_text(json);};
+                const std::function<void(void)> f = verbose_ ? verbose_f : quiet_f;
+                report_xdyn_exceptions_to_user(f, error_outputter);
+            });
+        }
+        else
+        {
+            pool->post([msg, payload, verbose_](SimServer& sim_server)
+            {
+                const std::function<void(const std::string&)> quiet_error_outputter = [&msg](const std::string& what) {send_binary(msg, encode_binary_error(what));};
+                const std::function<void(const std::string&)> verbose_error_outputter = [&msg](const std::string& what) {std::cerr << current_date_time() << " Error: " << what << std::endl; send_binary(msg, encode_binary_error(what));};
+                const auto error_outputter = verbose_ ? verbose_error_outputter : quiet_error_outputter;
+                const std::function<void(void)> quiet_f = [&msg, &sim_server, &payload]() {send_binary(msg, encode_binary_YamlStates(sim_server.play_one_step(decode_binary_YamlSimServerInputs(payload))));};
+                const std::function<void(void)> verbose_f = [&msg, &sim_server, &payload]() {const std::string binary = encode_binary_YamlStates(sim_server.play_one_step(decode_binary_YamlSimServerInputs(payload))); std::cout << current_date_time() << " Sending: binary response (" << binary.size() << " bytes)" << std::endl; send_binary(msg, binary);};
+                const std::function<void(void)> f = verbose_ ? verbose_f : quiet_f;
+                report_xdyn_exceptions_to_user(f, error_outputter);
+            });
         }
-        const std::function<void(const std::string&)> quiet_error_outputter = [&msg](const std::string& what) {msg.send_text(replace_newlines_by_spaces(std::string("{\"error\": \"") + what + "\"}"));};
-        const std::function<void(const std::string&)> verbose_error_outputter = [&msg](const std::string& what) {std::cerr << current_date_time() << " Error: " << what << std::endl; msg.send_text(replace_newlines_by_spaces(std::string("{\"error\": \"") + what + "\"}"));};
-        const auto error_outputter = verbose ? verbose_error_outputter : quiet_error_outputter;
-        const std::function<void(void)> quiet_f = [&msg, this, &input_json]() {msg.send_text(encode_YamlStates(this->sim_server->play_one_step(input_json)));};
-        const std::function<void(void)> verbose_f = [&msg, this, &input_json]() {const std::string json = encode_YamlStates(this->sim_server->play_one_step(input_json)); std::cout << current_date_time() << " Sending: " << json << std::endl; msg.send_text(json);};
-        const std::function<void(void)> f = verbose ? verbose_f : quiet_f;
-        report_xdyn_exceptions_to_user(f, error_outputter);
     }
 
     private:
-        TR1(shared_ptr)<SimServer> sim_server;
+        TR1(shared_ptr)<SimServerPool> pool;
         const bool verbose;
 };
 
 
-// For handling Ctrl+C
-#include <unistd.h>
-#include <cstdio>
-#include <csignal>
-
-volatile sig_atomic_t stop;
-
-void inthand(int);
-void inthand(int)
-{
-    stop = 1;
-}
-
 void start_server(const XdynForCSCommandLineArguments& input_data);
 void start_server(const XdynForCSCommandLineArguments& input_data)
 {
+    // Before the worker threads are created, so they do not receive Ctrl+C
+    prepare_to_wait_for_ctrl_c();
     const ssc::text_file_reader::TextFileReader yaml_reader(input_data.yaml_filenames);
     const auto yaml = yaml_reader.get_contents();
-    TR1(shared_ptr)<SimServer> sim_server (new SimServer(yaml, input_data.solver, input_data.initial_timestep));
-    SimulationMessage handler(sim_server, input_data.verbose);
-    std::cout << "Starting websocket server on " << ADDRESS << ":" << input_data.port << " (press Ctrl+C to terminate)" << std::endl;
+    SessionLimits session_limits;
+    session_limits.idle_timeout = input_data.session_timeout;
+    session_limits.max_nb_of_sessions = input_data.max_nb_of_sessions;
+    TR1(shared_ptr)<SimServerPool> pool(new SimServerPool(yaml, input_data.solver, input_data.initial_timestep, input_data.nb_of_threads, session_limits));
+    SimulationMessage handler(pool, input_data.verbose);
+    std::cout << "Starting websocket server on " << ADDRESS << ":" << input_data.port << " with " << pool->get_nb_of_threads() << " worker thread(s) (press Ctrl+C to terminate)" << std::endl;
     TR1(shared_ptr)<ssc::websocket::Server> w(new ssc::websocket::Server(handler, input_data.port, input_data.show_websocket_debug_information));
-    signal(SIGINT, inthand);
-    while(!stop){}
+    wait_for_ctrl_c();
     std::cout << std::endl << "Gracefully stopping the websocket server..." << std::endl;
+    // The jobs reply through the websocket server, so they must be done before it is destroyed
+    pool->stop();
 }
 
 int main(int argc, char** argv)
@@ -11,9 +11,12 @@
 
 #include "display_command_line_arguments.hpp"
 #include "HistoryParser.hpp"
+#include "InvalidInputException.hpp"
+#include "parse_history.hpp"
 #include "parse_XdynForMECommandLineArguments.hpp"
 #include "report_xdyn_exceptions_to_user.hpp"
 #include "XdynForMECommandLineArguments.hpp"
+#include "wait_for_ctrl_c.hpp"
 
 #include <ssc/text_file_reader.hpp>
 #include <ssc/websocket.hpp>
@@ -24,19 +27,6 @@
 #include <ssc/check_ssc_version.hpp>
 CHECK_SSC_VERSION(8,0)
 
-// For handling Ctrl+C
-#include <unistd.h>
-#include <cstdio>
-#include <csignal>
-
-volatile sig_atomic_t stop;
-
-void inthand(int);
-void inthand(int)
-{
-    stop = 1;
-}
-
 #include <boost/algorithm/string/replace.hpp>
 std::string replace_newlines_by_spaces(std::string str);
 std::string replace_newlines_by_spaces(std::string str)
@@ -45,6 +35,59 @@ std::string replace_newlines_by_spaces(std::string str)
     return str;
 }
 
+void write_dx_dt(std::ostream& os, const std::vector<double>& dx_dt);
+void write_dx_dt(std::ostream& os, const std::vector<double>& dx_dt)
+{
+    os << "{"
+       << "\"dx_dt\": "  << dx_dt[0] << ","
+       << "\"dy_dt\": "  << dx_dt[1] << ","
+       << "\"dz_dt\": "  << dx_dt[2] << ","
+       << "\"du_dt\": "  << dx_dt[3] << ","
+       << "\"dv_dt\": "  << dx_dt[4] << ","
+       << "\"dw_dt\": "  << dx_dt[5] << ","
+       << "\"dp_dt\": "  << dx_dt[6] << ","
+       << "\"dq_dt\": "  << dx_dt[7] << ","
+       << "\"dr_dt\": "  << dx_dt[8] << ","
+       << "\"dqr_dt\": " << dx_dt[9] << ","
+       << "\"dqi_dt\": " << dx_dt[10] << ","
+       << "\"dqj_dt\": " << dx_dt[11] << ","
+       << "\"dqk_dt\": " << dx_dt[12]
+       << "}";
+}
+
+void write_row(std::ostream& os, const std::vector<double>& row);
+void write_row(std::ostream& os, const std::vector<double>& row)
+{
+    os << "[";
+    for (size_t i = 0 ; i < row.size() ; ++i)
+    {
+        if (i) os << ",";
+        os << row[i];
+    }
+    os << "]";
+}
+
+void write_jacobian(std::ostream& os, const DxDtJacobian& jacobian);
+void write_jacobian(std::ostream& os, const DxDtJacobian& jacobian)
+{
+    os << "{\"d_dx_dt_d_states\": [";
+    for (size_t i = 0 ; i < jacobian.wrt_states.size() ; ++i)
+    {
+        if (i) os << ",";
+        write_row(os, jacobian.wrt_states[i]);
+    }
+    os << "], \"d_dx_dt_d_commands\": {";
+    bool first = true;
+    for (const auto& command:jacobian.wrt_commands)
+    {
+        if (not(first)) os << ",";
+        first = false;
+        os << "\"" << command.first << "\": ";
+        write_row(os, command.second);
+    }
+    os << "}}";
+}
+
 struct SimulationMessage : public ssc::websocket::MessageHandler
 {
     SimulationMessage(const TR1(shared_ptr)<XdynForME>& xdyn_for_me_, const bool verbose_) : xdyn_for_me(xdyn_for_me_), verbose(verbose_)
@@ -64,27 +107,42 @@ struct SimulationMessage : public ssc::websocket::MessageHandler
         const auto f =
                 [&input_yaml, this, &msg]()
         {
-            SimServerInputs server_inputs = parse_SimServerInputs(input_yaml, xdyn_for_me->get_Tmax());
-            const std::vector<double> dx_dt = xdyn_for_me->calculate_dx_dt(server_inputs);
             std::stringstream ss;
             // Set precision to shortest possible representation, without losing precision
             // Cf. https://stackoverflow.com/a/23437425, and, more specifically answer https://stackoverflow.com/a/4462034
             ss << std::defaultfloat << std::setprecision(17);
-            ss << "{"
-               << "\"dx_dt\": "  << dx_dt[0] << ","
-               << "\"dy_dt\": "  << dx_dt[1] << ","
-               << "\"dz_dt\": "  << dx_dt[2] << ","
-               << "\"du_dt\": "  << dx_dt[3] << ","
-               << "\"dv_dt\": "  << dx_dt[4] << ","
-               << "\"dw_dt\": "  << dx_dt[5] << ","
-               << "\"dp_dt\": "  << dx_dt[6] << ","
-               << "\"dq_dt\": "  << dx_dt[7] << ","
-               << "\"dr_dt\": "  << dx_dt[8] << ","
-               << "\"dqr_dt\": " << dx_dt[9] << ","
-               << "\"dqi_dt\": " << dx_dt[10] << ","
-               << "\"dqj_dt\": " << dx_dt[11] << ","
-               << "\"dqk_dt\": " << dx_dt[12]
-               << "}";
+            if (is_a_batch(input_yaml))
+            {
+                // A JSON array of requests: one round trip for all the derivatives
+                const std::vector<SimServerInputs> server_inputs = parse_SimServerInputs_batch(input_yaml, xdyn_for_me->get_Tmax());
+                for (const auto& server_input:server_inputs)
+                {
+                    if (server_input.jacobian)
+                    {
+                        THROW(__PRETTY_FUNCTION__, InvalidInputException, "Jacobians can only be requested in single requests, not in batches");
+                    }
+                }
+                const std::vector<std::vector<double> > dx_dts = xdyn_for_me->calculate_dx_dt(server_inputs);
+                ss << "[";
+                for (size_t i = 0 ; i < dx_dts.size() ; ++i)
+                {
+                    if (i) ss << ",";
+                    write_dx_dt(ss, dx_dts[i]);
+                }
+                ss << "]";
+            }
+            else
+            {
+                SimServerInputs server_inputs = parse_SimServerInputs(input_yaml, xdyn_for_me->get_Tmax());
+                if (server_inputs.jacobian)
+                {
+                    write_jacobian(ss, xdyn_for_me->calculate_jacobian(server_inputs));
+                }
+                else
+                {
+                    write_dx_dt(ss, xdyn_for_me->calculate_dx_dt(server_inputs));
+                }
+            }
             const std::string output_json = ss.str();
             if (verbose)
             {
@@ -103,14 +161,15 @@ struct SimulationMessage : public ssc::websocket::MessageHandler
 void start_server(const XdynForMECommandLineArguments& input_data);
 void start_server(const XdynForMECommandLineArguments& input_data)
 {
+    // Before the worker threads are created, so they do not receive Ctrl+C
+    prepare_to_wait_for_ctrl_c();
     const ssc::text_file_reader::TextFileReader yaml_reader(input_data.yaml_filenames);
     const auto yaml = yaml_reader.get_contents();
-    TR1(shared_ptr)<XdynForME> sim_server (new XdynForME(yaml));
+    TR1(shared_ptr)<XdynForME> sim_server (new XdynForME(yaml, input_data.nb_of_threads));
     SimulationMessage handler(sim_server, input_data.verbose);
     TR1(shared_ptr)<ssc::websocket::Server> w(new ssc::websocket::Server(handler, input_data.port, input_data.show_websocket_debug_information));
-    std::cout << "Starting websocket server on " << ADDRESS << ":" << input_data.port << " (press Ctrl+C to terminate)" << std::endl;
-    signal(SIGINT, inthand);
-    while(!stop){}
+    std::cout << "Starting websocket server on " << ADDRESS << ":" << input_data.port << " with " << sim_server->get_nb_of_threads() << " thread(s) for batches (press Ctrl+C to terminate)" << std::endl;
+    wait_for_ctrl_c();
     std::cout << std::endl << "Gracefully stopping the websocket server..." << std::endl;
 }
 
@@ -24,6 +24,7 @@ struct YamlDiffraction
     std::string     hdb_filename;
     YamlCoordinates calculation_point;
     bool            mirror;
+    double          heading_step_for_rao_cache; //!< Resolution (in radians) of the grid of headings on which the RAO are tabulated (0 to interpolate the RAO at each time step)
 };
 
 #endif /* YAMLDIFFRACTION_HPP_ */
@@ -19,6 +19,8 @@ struct YamlOutput
     std::string address;
     short unsigned int port;
     std::vector<std::string> data;
+    size_t chunk_size;      //!< Number of samples buffered (per variable) before writing to HDF5
+    int compression_level;  //!< Deflate compression level for HDF5 outputs (0: no compression)
 };
 
 #endif /* YAMLOUTPUT_HPP_ */
@@ -27,6 +27,9 @@ struct YamlRadiationDamping
     double              tau_max;                                              //!< Upper bound of the convolution integral, to calculate Fr
     bool                output_Br_and_K;                                      //!< Should the program output
     YamlCoordinates     calculation_point_in_body_frame;                      //!< Where were the damping matrices (read from the HDB file) computed?
+    bool                use_recursive_convolution;                            //!< Should the retardation functions be fitted by sums of exponentials to compute the convolutions recursively?
+    size_t              max_nb_of_exponentials_for_recursive_convolution;     //!< Maximum number of exponentials used to fit each retardation function
+    double              streaming_convolution_time_step;                      //!< Step of the lag grid used to compute the convolutions as sliding dot products (0 to use a quadrature)
 };
 
 #endif /* YAMLRADIATIONDAMPING_HPP_ */
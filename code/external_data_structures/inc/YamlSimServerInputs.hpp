@@ -2,6 +2,7 @@
 #define EXTERNAL_DATA_STRUCTURES_INC_YAMLSIMSERVERINPUTS_HPP_
 #include "YamlState.hpp"
 #include <map>
+#include <string>
 
 struct YamlSimServerInputs
 {
@@ -9,6 +10,11 @@ struct YamlSimServerInputs
     double Dt;
     std::vector<YamlState> states;
     std::map<std::string, double> commands;
+    std::string session;   //!< Client's session (empty if the request contains the whole state history)
+    bool close_session;    //!< If true, the server forgets the session once this request is processed
+    bool jacobian;               //!< If true, xdyn-for-me returns the Jacobian of the derivatives (instead of the derivatives)
+    double state_perturbation;   //!< Relative perturbation of the states used to compute the Jacobian
+    double command_perturbation; //!< Relative perturbation of the commands used to compute the Jacobian
 };
 
 
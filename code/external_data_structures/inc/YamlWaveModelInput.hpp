@@ -41,12 +41,28 @@ struct YamlSpectra
     YamlStretching stretching;              //!< Stretching model for orbital wave velocities (delta-stretching model)
 };
 
+struct YamlWaveLattice
+{
+    YamlWaveLattice();
+    double xmin;      //!< Minimum x value (in meters) of the nodes of the lattice, in the NED frame
+    double xmax;      //!< Maximum x value (in meters) of the nodes of the lattice, in the NED frame
+    size_t nx;        //!< Number of nodes along the x axis (0 if no lattice is used)
+    double ymin;      //!< Minimum y value (in meters) of the nodes of the lattice, in the NED frame
+    double ymax;      //!< Maximum y value (in meters) of the nodes of the lattice, in the NED frame
+    size_t ny;        //!< Number of nodes along the y axis
+    double zmin;      //!< Minimum z value (in meters) of the nodes of the lattice, in the NED frame
+    double zmax;      //!< Maximum z value (in meters) of the nodes of the lattice, in the NED frame
+    size_t nz;        //!< Number of nodes along the z axis (0 if the dynamic pressure is not interpolated)
+    double tolerance; //!< Maximum interpolation error (in meters) on the wave elevation & on the dynamic pressure divided by rho*g
+};
+
 struct YamlWaveModel
 {
     YamlWaveModel();
     YamlDiscretization discretization; //!< Spectral discretization parameters
     std::vector<YamlSpectra> spectra;  //!< Wave spectra to generate
     YamlWaveOutput output;             //!< Defines what wave data is outputted during the simulation & how it is generated
+    YamlWaveLattice lattice;           //!< Optional lattice on which the waves are evaluated once per time step & then interpolated
 };
 
 struct YamlJonswap
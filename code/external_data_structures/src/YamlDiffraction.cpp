@@ -9,6 +9,7 @@
 
 YamlDiffraction::YamlDiffraction() : hdb_filename(),
                                      calculation_point(),
-                                     mirror(false)
+                                     mirror(false),
+                                     heading_step_for_rao_cache(0)
 {
 }
@@ -7,6 +7,6 @@
 
 #include "YamlOutput.hpp"
 
-YamlOutput::YamlOutput() : filename(), format(), address(), port(), data()
+YamlOutput::YamlOutput() : filename(), format(), address(), port(), data(), chunk_size(1000), compression_level(0)
 {
 }
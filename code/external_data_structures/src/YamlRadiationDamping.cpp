@@ -16,6 +16,9 @@ YamlRadiationDamping::YamlRadiationDamping() : hdb_filename(),
                                                tau_min(0),
                                                tau_max(0),
                                                output_Br_and_K(),
-                                               calculation_point_in_body_frame()
+                                               calculation_point_in_body_frame(),
+                                               use_recursive_convolution(false),
+                                               max_nb_of_exponentials_for_recursive_convolution(20),
+                                               streaming_convolution_time_step(0)
 {
 }
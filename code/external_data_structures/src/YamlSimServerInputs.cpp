@@ -4,5 +4,10 @@ YamlSimServerInputs::YamlSimServerInputs()
     : Dt()
     , states()
     , commands()
+    , session()
+    , close_session(false)
+    , jacobian(false)
+    , state_perturbation(1E-6)
+    , command_perturbation(1E-6)
 {
 }
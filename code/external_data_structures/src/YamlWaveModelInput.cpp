@@ -26,10 +26,24 @@ YamlStretching::YamlStretching():
         h(0)
 {}
 
+YamlWaveLattice::YamlWaveLattice():
+        xmin(0),
+        xmax(0),
+        nx(0),
+        ymin(0),
+        ymax(0),
+        ny(0),
+        zmin(0),
+        zmax(0),
+        nz(0),
+        tolerance(0)
+{}
+
 YamlWaveModel::YamlWaveModel()
 :discretization()
 ,spectra()
 ,output()
+,lattice()
 {}
 
 YamlJonswap::YamlJonswap():
@@ -9,6 +9,7 @@
 #define FROUDEKRYLOVFORCEMODEL_HPP_
 
 #include "ImmersedSurfaceForceModel.hpp"
+#include "SurfaceElevationInterface.hpp"
 
 /** \brief
  *  \details
@@ -39,6 +40,17 @@ class FroudeKrylovForceModel : public ImmersedSurfaceForceModel
     private:
         FroudeKrylovForceModel();
         double pe(const BodyStates& states, const std::vector<double>& x, const EnvironmentAndFrames& env) const;
+
+        /**  \brief Data computed for all immersed facets at each time step, kept so the vectors can be reused
+          */
+        struct Workspace
+        {
+            Workspace(const std::string& frame);
+            std::vector<double> average_eta_per_facet;
+            ssc::kinematics::PointMatrix centres_of_gravity; //!< Projected in the body frame
+            DynamicPressureBuffers buffers;
+        };
+        TR1(shared_ptr)<Workspace> workspace;
 };
 
 #endif /* FROUDEKRYLOVFORCEMODEL_HPP_ */
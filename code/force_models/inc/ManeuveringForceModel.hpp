@@ -10,12 +10,12 @@
 
 #include <map>
 
-#include <ssc/data_source.hpp>
 #include <ssc/macros.hpp>
 
 #include "ControllableForceModel.hpp"
 #include "YamlPosition.hpp"
 #include "ManeuveringInternal.hpp"
+#include "maneuvering_compiler.hpp"
 
 
 #include TR1INC(memory)
@@ -42,7 +42,8 @@ class ManeuveringForceModel : public ControllableForceModel
     private:
         ManeuveringForceModel();
         std::map<std::string, maneuvering::NodePtr> m;
-        TR1(shared_ptr)<ssc::data_source::DataSource> ds;
+        TR1(shared_ptr)<maneuvering::Tape> tape;
+        std::vector<size_t> command_inputs; //!< Indices (in tape->get_inputs()) of the inputs read from the commands at each evaluation. The others (g, nu & rho) are set by the constructor.
 };
 
 #endif /* MANEUVERINGFORCEMODEL_HPP_ */
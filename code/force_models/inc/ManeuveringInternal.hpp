@@ -24,6 +24,7 @@ namespace maneuvering
     typedef TR1(shared_ptr)<Node> NodePtr;
 
     class AbstractNodeVisitor;
+    class Tape;
 
     class Node
     {
@@ -31,6 +32,10 @@ namespace maneuvering
             Node(const std::vector<NodePtr>& children);
             virtual ~Node();
             virtual Function get_lambda() const = 0;
+            /**  \brief Appends the instructions computing this node to a Tape
+              *  \returns Index of the register containing the result
+              */
+            virtual size_t append_to(Tape& tape) const = 0;
             std::vector<NodePtr> get_children() const;
             virtual void accept(AbstractNodeVisitor& visitor) const = 0;
             virtual double get_max() const = 0;
@@ -67,6 +72,7 @@ namespace maneuvering
         public:
             Constant(const double val);
             Function get_lambda() const;
+            size_t append_to(Tape& tape) const;
             void accept(AbstractNodeVisitor& visitor) const;
             double get_max() const;
             double get_min() const;
@@ -88,6 +94,7 @@ namespace maneuvering
         public:
             Cos(const NodePtr& operand);
             Function get_lambda() const;
+            size_t append_to(Tape& tape) const;
             void accept(AbstractNodeVisitor& visitor) const;
             double get_max() const;
             double get_min() const;
@@ -98,6 +105,7 @@ namespace maneuvering
         public:
             Sin(const NodePtr& operand);
             Function get_lambda() const;
+            size_t append_to(Tape& tape) const;
             void accept(AbstractNodeVisitor& visitor) const;
             double get_max() const;
             double get_min() const;
@@ -108,6 +116,7 @@ namespace maneuvering
         public:
             Abs(const NodePtr& operand);
             Function get_lambda() const;
+            size_t append_to(Tape& tape) const;
             void accept(AbstractNodeVisitor& visitor) const;
             double get_max() const;
             double get_min() const;
@@ -118,6 +127,7 @@ namespace maneuvering
         public:
             Log(const NodePtr& operand);
             Function get_lambda() const;
+            size_t append_to(Tape& tape) const;
             void accept(AbstractNodeVisitor& visitor) const;
             double get_max() const;
             double get_min() const;
@@ -128,6 +138,7 @@ namespace maneuvering
         public:
             Sum(const NodePtr& lhs, const NodePtr& rhs);
             Function get_lambda() const;
+            size_t append_to(Tape& tape) const;
             void accept(AbstractNodeVisitor& visitor) const;
             double get_max() const;
             double get_min() const;
@@ -138,6 +149,7 @@ namespace maneuvering
         public:
             Pow(const NodePtr& lhs, const NodePtr& rhs);
             Function get_lambda() const;
+            size_t append_to(Tape& tape) const;
             void accept(AbstractNodeVisitor& visitor) const;
             double get_max() const;
             double get_min() const;
@@ -148,6 +160,7 @@ namespace maneuvering
         public:
             Exp(const NodePtr& operand);
             Function get_lambda() const;
+            size_t append_to(Tape& tape) const;
             void accept(AbstractNodeVisitor& visitor) const;
             double get_max() const;
             double get_min() const;
@@ -158,6 +171,7 @@ namespace maneuvering
         public:
             Sqrt(const NodePtr& operand);
             Function get_lambda() const;
+            size_t append_to(Tape& tape) const;
             void accept(AbstractNodeVisitor& visitor) const;
             double get_max() const;
             double get_min() const;
@@ -168,6 +182,7 @@ namespace maneuvering
         public:
             Difference(const NodePtr& lhs, const NodePtr& rhs);
             Function get_lambda() const;
+            size_t append_to(Tape& tape) const;
             void accept(AbstractNodeVisitor& visitor) const;
             double get_max() const;
             double get_min() const;
@@ -178,6 +193,7 @@ namespace maneuvering
         public:
             Divide(const NodePtr& lhs, const NodePtr& rhs);
             Function get_lambda() const;
+            size_t append_to(Tape& tape) const;
             void accept(AbstractNodeVisitor& visitor) const;
             double get_max() const;
             double get_min() const;
@@ -188,6 +204,7 @@ namespace maneuvering
         public:
             Multiply(const NodePtr& lhs, const NodePtr& rhs);
             Function get_lambda() const;
+            size_t append_to(Tape& tape) const;
             void accept(AbstractNodeVisitor& visitor) const;
             double get_max() const;
             double get_min() const;
@@ -234,6 +251,7 @@ namespace maneuvering
                             return op(states,ds,t);
                         };
             }
+            size_t append_to(Tape& tape) const;
 
 
             double get_max() const
@@ -254,6 +272,7 @@ namespace maneuvering
         public:
             Time();
             Function get_lambda() const;
+            size_t append_to(Tape& tape) const;
             void accept(AbstractNodeVisitor& visitor) const;
             double get_max() const;
             double get_min() const;
@@ -264,6 +283,7 @@ namespace maneuvering
         public:
             UnknownIdentifier(const std::string& identifier_name);
             Function get_lambda() const;
+            size_t append_to(Tape& tape) const;
             void accept(AbstractNodeVisitor& visitor) const;
             std::string get_name() const;
             double get_max() const;
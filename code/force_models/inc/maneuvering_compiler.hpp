@@ -9,6 +9,11 @@
 #ifndef MANEUVERING_COMPILER_HPP_
 #define MANEUVERING_COMPILER_HPP_
 
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
 #include "ManeuveringInternal.hpp"
 
 namespace maneuvering
@@ -16,6 +21,69 @@ namespace maneuvering
     NodePtr compile(const std::string& expression, const YamlRotation& rot);
     std::string print(const std::string& expression);
     double get_Tmax(const NodePtr& node);
+
+    enum class Operation {COS, SIN, ABS, LOG, EXP, SQRT, SUM, POW, DIFFERENCE, DIVIDE, MULTIPLY, STATE};
+
+    struct Instruction
+    {
+        Operation op;
+        StateType state; //!< Only used if op == Operation::STATE
+        size_t out;      //!< Register receiving the result
+        size_t lhs;      //!< Register containing the (first) operand
+        size_t rhs;      //!< Register containing the second operand, or index of the rotation convention for Operation::STATE
+    };
+
+    /** \brief Flat, register-based version of a set of maneuvering expressions
+     *  \details The expression trees are compiled once and for all to a list of instructions operating on
+     *           a vector of registers: identifiers defined by the model are resolved to the register containing
+     *           their value, constants are stored in registers when the tape is built & the other identifiers
+     *           (commands, environment constants...) are inputs which must be set before each evaluation.
+     *           Each variable is evaluated once per call, whatever the number of times it is used.
+     *           Results are identical to those of Node::get_lambda (same operations, in the same order).
+     *  \addtogroup force_models
+     *  \ingroup force_models
+     *  \section ex1 Example
+     *  \snippet force_models/unit_tests/src/maneuvering_compilerTest.cpp maneuvering_compilerTest tape example
+     */
+    class Tape
+    {
+        public:
+            Tape(const std::map<std::string, NodePtr>& nodes, //!< Expression of each variable defined by the model
+                 const std::vector<std::string>& outputs      //!< Identifiers to compute (eg. X, Y, Z, K, M, N)
+                 );
+
+            /**  \brief Identifiers used by the expressions but not defined by the model, in the order expected by set_input
+              */
+            const std::vector<std::string>& get_inputs() const;
+            void set_input(const size_t idx, const double val);
+            void evaluate(const BodyStates& states, const double t);
+
+            /**  \brief Value of outputs[idx] (outputs being the list passed to the constructor), after the last call to evaluate
+              */
+            double get_output(const size_t idx) const;
+
+            size_t append_time() const;
+            size_t append_constant(const double val);
+            size_t append_identifier(const std::string& name);
+            size_t append_unary(const Operation op, const size_t operand);
+            size_t append_binary(const Operation op, const size_t lhs, const size_t rhs);
+            size_t append_state(const StateType state, const size_t operand, const YamlRotation& rot);
+
+        private:
+            Tape();
+            size_t append(const Operation op, const StateType state, const size_t lhs, const size_t rhs);
+            double get_state(const StateType state, const BodyStates& states, const double t, const YamlRotation& rot) const;
+
+            std::map<std::string, NodePtr> nodes;
+            std::map<std::string, size_t> variable_registers;
+            std::set<std::string> variables_being_compiled;
+            std::vector<std::string> inputs;
+            std::vector<size_t> input_registers;
+            std::vector<size_t> output_registers;
+            std::vector<YamlRotation> rotations;
+            std::vector<Instruction> instructions;
+            std::vector<double> registers;
+    };
 }
 
 
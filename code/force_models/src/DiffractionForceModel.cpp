@@ -18,9 +18,12 @@
 
 #include <ssc/interpolation.hpp>
 #include <ssc/text_file_reader.hpp>
+#include <ssc/yaml_parser.hpp>
 
 #include <array>
+#include <cmath>
 #define TWOPI 6.283185307179586232
+#define PI    3.141592653589793116
 
 std::string DiffractionForceModel::model_name() { return "diffraction";}
 
@@ -79,7 +82,9 @@ class DiffractionForceModel::Impl
         H0(data.calculation_point.x,data.calculation_point.y,data.calculation_point.z),
         rao(DiffractionInterpolator(hdb,std::vector<double>(),std::vector<double>(),data.mirror)),
         periods_for_each_direction(),
-        psis()
+        psis(),
+        heading_step(0),
+        rao_cache()
         {
             if (env.w.use_count()>0)
             {
@@ -111,6 +116,13 @@ class DiffractionForceModel::Impl
             {
                 THROW(__PRETTY_FUNCTION__, InvalidInputException, "Force model '" << DiffractionForceModel::model_name << "' needs a wave model, even if it's 'no waves'");
             }
+            if (data.heading_step_for_rao_cache > 0)
+            {
+                // Round the number of bins so that the grid wraps around exactly
+                const size_t nb_of_bins = (size_t)std::ceil(TWOPI/data.heading_step_for_rao_cache - 1E-9);
+                heading_step = TWOPI/(double)nb_of_bins;
+                rao_cache.resize(nb_of_bins);
+            }
             YamlPosition pos;
             pos.frame = DiffractionForceModel::model_name();
             pos.coordinates = data.calculation_point;
@@ -126,44 +138,18 @@ class DiffractionForceModel::Impl
             T.swap();
             const ssc::kinematics::Point position_in_ned_for_the_wave_model = T*ssc::kinematics::Point(body_name,H0);
             ssc::kinematics::Point point_of_application_in_body_frame(body_name,H0);
-            std::array<std::vector<std::vector<double> >, 6 > rao_modules;
-            std::array<std::vector<std::vector<double> >, 6 > rao_phases;
             if (env.w.use_count()>0)
             {
-                const size_t nb_of_spectra = periods_for_each_direction.size();
-                if (not(periods_for_each_direction.empty()))
-                {
-                    // Resize for each degree of freedom
-                    for (size_t k = 0 ; k < 6 ; ++k)
-                    {
-                        rao_modules[k].resize(nb_of_spectra);
-                        rao_phases[k].resize(nb_of_spectra);
-                    }
-                }
+                const RAOs& raos = get_raos(psi);
                 for (size_t degree_of_freedom_idx = 0 ; degree_of_freedom_idx < 6 ; ++degree_of_freedom_idx) // For each degree of freedom (X, Y, Z, K, M, N)
                 {
-                    for (size_t spectrum_idx = 0 ; spectrum_idx < nb_of_spectra ; ++spectrum_idx) // For each directional spectrum
-                    {
-                        const size_t nb_of_period_incidence_pairs = periods_for_each_direction[spectrum_idx].size();
-                        rao_modules[degree_of_freedom_idx][spectrum_idx].resize(nb_of_period_incidence_pairs);
-                        rao_phases[degree_of_freedom_idx][spectrum_idx].resize(nb_of_period_incidence_pairs);
-                        for (size_t omega_beta_idx = 0 ; omega_beta_idx < nb_of_period_incidence_pairs ; ++omega_beta_idx) // For each incidence and each period (omega[i[omega_beta_idx]], beta[j[omega_beta_idx]])
-                        {
-                            // Wave incidence
-                            const double beta = psi - psis.at(spectrum_idx).at(omega_beta_idx);
-                            // Interpolate RAO module for this axis, period and incidence
-                            rao_modules[degree_of_freedom_idx][spectrum_idx][omega_beta_idx] = rao.interpolate_module(degree_of_freedom_idx, periods_for_each_direction[spectrum_idx][omega_beta_idx], beta);
-                            // Interpolate RAO phase for this axis, period and incidence
-                            rao_phases[degree_of_freedom_idx][spectrum_idx][omega_beta_idx] = -rao.interpolate_phase(degree_of_freedom_idx, periods_for_each_direction[spectrum_idx][omega_beta_idx], beta);
-                        }
-                    }
                     try
                     {
                         w((int)degree_of_freedom_idx) = env.w->evaluate_rao(position_in_ned_for_the_wave_model.x(),
                                                         position_in_ned_for_the_wave_model.y(),
                                                         t,
-                                                        rao_modules[degree_of_freedom_idx],
-                                                        rao_phases[degree_of_freedom_idx]);
+                                                        raos.modules[degree_of_freedom_idx],
+                                                        raos.phases[degree_of_freedom_idx]);
                     }
                     catch (const ssc::exception_handling::Exception& e)
                     {
@@ -190,6 +176,91 @@ class DiffractionForceModel::Impl
             return tau_in_body_frame_at_G;
         }
 
+        /**  \brief RAO module & phase for each degree of freedom, each directional spectrum and each (omega, beta) pair
+          */
+        struct RAOs
+        {
+            RAOs() : modules(), phases() {}
+            std::array<std::vector<std::vector<double> >, 6 > modules;
+            std::array<std::vector<std::vector<double> >, 6 > phases;
+        };
+
+        RAOs interpolate_raos(const double psi)
+        {
+            RAOs ret;
+            const size_t nb_of_spectra = periods_for_each_direction.size();
+            for (size_t degree_of_freedom_idx = 0 ; degree_of_freedom_idx < 6 ; ++degree_of_freedom_idx) // For each degree of freedom (X, Y, Z, K, M, N)
+            {
+                ret.modules[degree_of_freedom_idx].resize(nb_of_spectra);
+                ret.phases[degree_of_freedom_idx].resize(nb_of_spectra);
+                for (size_t spectrum_idx = 0 ; spectrum_idx < nb_of_spectra ; ++spectrum_idx) // For each directional spectrum
+                {
+                    const size_t nb_of_period_incidence_pairs = periods_for_each_direction[spectrum_idx].size();
+                    ret.modules[degree_of_freedom_idx][spectrum_idx].resize(nb_of_period_incidence_pairs);
+                    ret.phases[degree_of_freedom_idx][spectrum_idx].resize(nb_of_period_incidence_pairs);
+                    for (size_t omega_beta_idx = 0 ; omega_beta_idx < nb_of_period_incidence_pairs ; ++omega_beta_idx) // For each incidence and each period (omega[i[omega_beta_idx]], beta[j[omega_beta_idx]])
+                    {
+                        // Wave incidence
+                        const double beta = psi - psis.at(spectrum_idx).at(omega_beta_idx);
+                        // Interpolate RAO module for this axis, period and incidence
+                        ret.modules[degree_of_freedom_idx][spectrum_idx][omega_beta_idx] = rao.interpolate_module(degree_of_freedom_idx, periods_for_each_direction[spectrum_idx][omega_beta_idx], beta);
+                        // Interpolate RAO phase for this axis, period and incidence
+                        ret.phases[degree_of_freedom_idx][spectrum_idx][omega_beta_idx] = -rao.interpolate_phase(degree_of_freedom_idx, periods_for_each_direction[spectrum_idx][omega_beta_idx], beta);
+                    }
+                }
+            }
+            return ret;
+        }
+
+        /**  \brief RAO tabulated at heading bin_idx*heading_step, computed the first time they are needed
+          */
+        const RAOs& cached_raos(const size_t bin_idx)
+        {
+            if (not(rao_cache[bin_idx]))
+            {
+                rao_cache[bin_idx].reset(new RAOs(interpolate_raos((double)bin_idx*heading_step)));
+            }
+            return *rao_cache[bin_idx];
+        }
+
+        /**  \brief Linear interpolation between the RAO of the two bins surrounding psi
+          *  \details Phases are blended along the shortest arc, so a 2 pi jump between two bins has no effect.
+          */
+        const RAOs& get_raos(const double psi)
+        {
+            if (rao_cache.empty())
+            {
+                blended_raos = interpolate_raos(psi);
+                return blended_raos;
+            }
+            const size_t nb_of_bins = rao_cache.size();
+            const double x = (psi - TWOPI*std::floor(psi/TWOPI))/heading_step;
+            const size_t i = std::min((size_t)std::floor(x), nb_of_bins-1);
+            const double f = x - (double)i;
+            const RAOs& left = cached_raos(i);
+            const RAOs& right = cached_raos((i+1) % nb_of_bins);
+            blended_raos = left;
+            for (size_t k = 0 ; k < 6 ; ++k)
+            {
+                for (size_t spectrum_idx = 0 ; spectrum_idx < left.modules[k].size() ; ++spectrum_idx)
+                {
+                    const std::vector<double>& module_left = left.modules[k][spectrum_idx];
+                    const std::vector<double>& module_right = right.modules[k][spectrum_idx];
+                    const std::vector<double>& phase_left = left.phases[k][spectrum_idx];
+                    const std::vector<double>& phase_right = right.phases[k][spectrum_idx];
+                    std::vector<double>& module = blended_raos.modules[k][spectrum_idx];
+                    std::vector<double>& phase = blended_raos.phases[k][spectrum_idx];
+                    for (size_t j = 0 ; j < module.size() ; ++j)
+                    {
+                        module[j] = (1-f)*module_left[j] + f*module_right[j];
+                        const double dphi = phase_right[j] - phase_left[j];
+                        phase[j] = phase_left[j] + f*(dphi - TWOPI*std::floor((dphi+PI)/TWOPI));
+                    }
+                }
+            }
+            return blended_raos;
+        }
+
         ssc::kinematics::Vector6d express_aquaplus_wrench_in_xdyn_coordinates(ssc::kinematics::Vector6d v) const
         {
             v(0) *= -1;
@@ -205,6 +276,9 @@ class DiffractionForceModel::Impl
         DiffractionInterpolator rao;
         std::vector<std::vector<double> > periods_for_each_direction;
         std::vector<std::vector<double> > psis;
+        double heading_step;                            //!< Resolution of the RAO cache (in radians), 0 if there is no cache
+        std::vector<TR1(shared_ptr)<RAOs> > rao_cache;  //!< RAO for each heading bin (null until the bin is used)
+        RAOs blended_raos;                              //!< RAO at the current heading (avoids reallocating at each time step)
 
 };
 
@@ -234,5 +308,13 @@ DiffractionForceModel::Input DiffractionForceModel::parse(const std::string& yam
     node["hdb"]                             >> ret.hdb_filename;
     node["calculation point in body frame"] >> ret.calculation_point;
     node["mirror for 180 to 360"]           >> ret.mirror;
+    if (const YAML::Node* step = node.FindValue("heading step for RAO cache"))
+    {
+        ssc::yaml_parser::parse_uv(*step, ret.heading_step_for_rao_cache);
+        if (ret.heading_step_for_rao_cache <= 0)
+        {
+            THROW(__PRETTY_FUNCTION__, InvalidInputException, "In diffraction force model: 'heading step for RAO cache' should be strictly positive, but got " << ret.heading_step_for_rao_cache*180/PI << " deg. Remove this key to interpolate the RAO at each time step.");
+        }
+    }
     return ret;
 }
@@ -12,7 +12,12 @@
 
 std::string FroudeKrylovForceModel::model_name() {return "non-linear Froude-Krylov";}
 
-FroudeKrylovForceModel::FroudeKrylovForceModel(const std::string& body_name_, const EnvironmentAndFrames& env_) : ImmersedSurfaceForceModel(model_name(), body_name_, env_)
+FroudeKrylovForceModel::Workspace::Workspace(const std::string& frame) : average_eta_per_facet(), centres_of_gravity(frame, 0), buffers()
+{
+}
+
+FroudeKrylovForceModel::FroudeKrylovForceModel(const std::string& body_name_, const EnvironmentAndFrames& env_) : ImmersedSurfaceForceModel(model_name(), body_name_, env_),
+        workspace(new Workspace(body_name_))
 {
     if (env.w.use_count()==0)
     {
@@ -27,50 +32,48 @@ std::function<SurfaceForceModel::DF(const FacetIterator &, const size_t, const E
                                    const BodyStates &states,
                                    const double t) const
 {
-    // Compute average elevation for each facet
-    std::vector<double> average_eta_per_facet;
-    for (auto that_facet = begin_facet; that_facet != end_facet; ++that_facet)
+    // Compute average elevation & centre of gravity of each facet
+    const std::vector<double>& all_absolute_wave_elevations = states.intersector->all_absolute_wave_elevations;
+    const size_t nb_of_facets = end_facet - begin_facet;
+    std::vector<double>& average_eta_per_facet = workspace->average_eta_per_facet;
+    ssc::kinematics::PointMatrix& M = workspace->centres_of_gravity;
+    average_eta_per_facet.resize(nb_of_facets);
+    if (M.get_frame() != states.M->get_frame()) M = ssc::kinematics::PointMatrix(states.M->get_frame(), nb_of_facets);
+    if ((size_t)M.m.cols() != nb_of_facets) M.m.resize(3, (int)nb_of_facets);
+    size_t that_facet_index = 0;
+    for (auto that_facet = begin_facet; that_facet != end_facet; ++that_facet, ++that_facet_index)
     {
         double eta_facet = 0;
-        for (auto it = that_facet->vertex_index.begin(); it != that_facet->vertex_index.end(); ++it)
+        for (const auto vertex:that_facet->vertex_index)
         {
-            eta_facet += states.intersector->all_absolute_wave_elevations.at(*it);
+            eta_facet += all_absolute_wave_elevations[vertex];
         }
         if (not(that_facet->vertex_index.empty()))
             eta_facet /= (double)that_facet->vertex_index.size();
-        average_eta_per_facet.push_back(eta_facet);
-    }
-
-    ssc::kinematics::PointMatrix M(states.M->get_frame(), average_eta_per_facet.size());
-    size_t that_facet_index = 0;
-    for (auto that_facet = begin_facet; that_facet != end_facet; ++that_facet)
-    {
+        average_eta_per_facet[that_facet_index] = eta_facet;
         M.m(0, that_facet_index) = that_facet->centre_of_gravity.x();
         M.m(1, that_facet_index) = that_facet->centre_of_gravity.y();
         M.m(2, that_facet_index) = that_facet->centre_of_gravity.z();
-        ++that_facet_index;
     }
     // Compute dynamic pressure for all facets
-    std::vector<double> pdyn;
     try
     {
-        pdyn = env.w->get_dynamic_pressure(env.rho, env.g, M, env.k, average_eta_per_facet, t);
+        env.w->get_dynamic_pressure(env.rho, env.g, M, env.k, average_eta_per_facet, t, workspace->buffers);
     }
     catch (const ssc::exception_handling::Exception& e)
     {
         THROW(__PRETTY_FUNCTION__, ssc::exception_handling::Exception, "This simulation uses the Froude-Krylov force model which uses the dynamic pressures calculated by a wave model. When querying the wave model for these dynamic pressures, the following problem occurred:\n" << e.get_message());
     }
 
-    return [pdyn](const FacetIterator &that_facet,
-                  const size_t that_facet_index,
-                  const EnvironmentAndFrames &env,
-                  const BodyStates &states,
-                  const double t)
+    const TR1(shared_ptr)<Workspace> w = workspace;
+    return [w](const FacetIterator &that_facet,
+               const size_t that_facet_index,
+               const EnvironmentAndFrames &,
+               const BodyStates &,
+               const double)
     {
-        // Calculate facet area and centre of gravity
         const EPoint dS = that_facet->area * that_facet->unit_normal;
-        const ssc::kinematics::Point C(states.M->get_frame(), that_facet->centre_of_gravity);
-        return SurfaceForceModel::DF(-pdyn.at(that_facet_index) * dS, C.v);
+        return SurfaceForceModel::DF(-w->buffers.pdyn[that_facet_index] * dS, that_facet->centre_of_gravity);
     };
 }
 
@@ -9,7 +9,6 @@
 #include "external_data_structures_parsers.hpp"
 #include "ManeuveringForceModel.hpp"
 #include "maneuvering_compiler.hpp"
-#include "maneuvering_DataSource_builder.hpp"
 #include "yaml.h"
 #include "yaml2eigen.hpp"
 #include "InvalidInputException.hpp"
@@ -70,34 +69,41 @@ ManeuveringForceModel::Yaml ManeuveringForceModel::parse(const std::string& yaml
 ManeuveringForceModel::ManeuveringForceModel(const Yaml& data, const std::string& body_name_, const EnvironmentAndFrames& env_) :
         ControllableForceModel(data.name, data.commands, data.frame_of_reference, body_name_, env_),
         m(),
-        ds(new ssc::data_source::DataSource())
+        tape(),
+        command_inputs()
 {
     env.k->add(make_transform(data.frame_of_reference, data.name, env.rot));
     for (auto var2expr:data.var2expr)
     {
         m[var2expr.first] = maneuvering::compile(var2expr.second, env.rot);
     }
-    ds->set("g", env.g);
-    ds->set("nu", env.nu);
-    ds->set("rho", env.rho);
-    maneuvering::build_ds(*ds, m);
+    tape.reset(new maneuvering::Tape(m, {"X", "Y", "Z", "K", "M", "N"}));
+    const std::map<std::string, double> environment_constants = {{"g", env.g}, {"nu", env.nu}, {"rho", env.rho}};
+    const auto& inputs = tape->get_inputs();
+    for (size_t i = 0 ; i < inputs.size() ; ++i)
+    {
+        const auto constant = environment_constants.find(inputs[i]);
+        if (constant != environment_constants.end()) tape->set_input(i, constant->second);
+        else                                         command_inputs.push_back(i);
+    }
 }
 
 ssc::kinematics::Vector6d ManeuveringForceModel::get_force(const BodyStates& states, const double t, const std::map<std::string,double>& commands) const
 {
-    ds->check_in(__PRETTY_FUNCTION__);
-    ds->set("states", states);
-    ds->set("t", t);
-    for (const auto command:commands) ds->set(command.first, command.second);
+    const auto& inputs = tape->get_inputs();
+    for (const size_t i:command_inputs)
+    {
+        const auto command = commands.find(inputs[i]);
+        if (command == commands.end())
+        {
+            THROW(__PRETTY_FUNCTION__, InvalidInputException, "Unable to evaluate maneuvering model '" << get_name() << "': identifier '" << inputs[i] << "' is neither defined in the model, nor a command, nor an environment constant (g, nu or rho).");
+        }
+        tape->set_input(i, command->second);
+    }
+    tape->evaluate(states, t);
 
     ssc::kinematics::Vector6d tau = ssc::kinematics::Vector6d::Zero();
-    tau(0) = ds->get<double>("X");
-    tau(1) = ds->get<double>("Y");
-    tau(2) = ds->get<double>("Z");
-    tau(3) = ds->get<double>("K");
-    tau(4) = ds->get<double>("M");
-    tau(5) = ds->get<double>("N");
-    ds->check_out();
+    for (int i = 0 ; i < 6 ; ++i) tau(i) = tape->get_output((size_t)i);
     return tau;
 }
 
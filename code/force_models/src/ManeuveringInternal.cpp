@@ -7,6 +7,7 @@
 
 
 #include "ManeuveringInternal.hpp"
+#include "maneuvering_compiler.hpp"
 
 using namespace maneuvering;
 
@@ -784,3 +785,150 @@ namespace maneuvering
     }
     void FindTmax::visit(const Constant& ) {}
 }
+
+namespace maneuvering
+{
+    size_t Constant::append_to(Tape& tape) const
+    {
+        return tape.append_constant(val);
+    }
+
+    size_t Cos::append_to(Tape& tape) const
+    {
+        return tape.append_unary(Operation::COS, get_operand()->append_to(tape));
+    }
+
+    size_t Sin::append_to(Tape& tape) const
+    {
+        return tape.append_unary(Operation::SIN, get_operand()->append_to(tape));
+    }
+
+    size_t Abs::append_to(Tape& tape) const
+    {
+        return tape.append_unary(Operation::ABS, get_operand()->append_to(tape));
+    }
+
+    size_t Log::append_to(Tape& tape) const
+    {
+        return tape.append_unary(Operation::LOG, get_operand()->append_to(tape));
+    }
+
+    size_t Exp::append_to(Tape& tape) const
+    {
+        return tape.append_unary(Operation::EXP, get_operand()->append_to(tape));
+    }
+
+    size_t Sqrt::append_to(Tape& tape) const
+    {
+        return tape.append_unary(Operation::SQRT, get_operand()->append_to(tape));
+    }
+
+    size_t Sum::append_to(Tape& tape) const
+    {
+        const size_t lhs = get_lhs()->append_to(tape);
+        const size_t rhs = get_rhs()->append_to(tape);
+        return tape.append_binary(Operation::SUM, lhs, rhs);
+    }
+
+    size_t Pow::append_to(Tape& tape) const
+    {
+        const size_t lhs = get_lhs()->append_to(tape);
+        const size_t rhs = get_rhs()->append_to(tape);
+        return tape.append_binary(Operation::POW, lhs, rhs);
+    }
+
+    size_t Difference::append_to(Tape& tape) const
+    {
+        const size_t lhs = get_lhs()->append_to(tape);
+        const size_t rhs = get_rhs()->append_to(tape);
+        return tape.append_binary(Operation::DIFFERENCE, lhs, rhs);
+    }
+
+    size_t Divide::append_to(Tape& tape) const
+    {
+        const size_t lhs = get_lhs()->append_to(tape);
+        const size_t rhs = get_rhs()->append_to(tape);
+        return tape.append_binary(Operation::DIVIDE, lhs, rhs);
+    }
+
+    size_t Multiply::append_to(Tape& tape) const
+    {
+        const size_t lhs = get_lhs()->append_to(tape);
+        const size_t rhs = get_rhs()->append_to(tape);
+        return tape.append_binary(Operation::MULTIPLY, lhs, rhs);
+    }
+
+    size_t Time::append_to(Tape& tape) const
+    {
+        return tape.append_time();
+    }
+
+    size_t UnknownIdentifier::append_to(Tape& tape) const
+    {
+        return tape.append_identifier(identifier_name);
+    }
+    template <> size_t State<StateType::X>::append_to(Tape& tape) const
+    {
+        return tape.append_state(StateType::X, get_operand()->append_to(tape), rot);
+    }
+    template <> size_t State<StateType::Y>::append_to(Tape& tape) const
+    {
+        return tape.append_state(StateType::Y, get_operand()->append_to(tape), rot);
+    }
+    template <> size_t State<StateType::Z>::append_to(Tape& tape) const
+    {
+        return tape.append_state(StateType::Z, get_operand()->append_to(tape), rot);
+    }
+    template <> size_t State<StateType::U>::append_to(Tape& tape) const
+    {
+        return tape.append_state(StateType::U, get_operand()->append_to(tape), rot);
+    }
+    template <> size_t State<StateType::V>::append_to(Tape& tape) const
+    {
+        return tape.append_state(StateType::V, get_operand()->append_to(tape), rot);
+    }
+    template <> size_t State<StateType::W>::append_to(Tape& tape) const
+    {
+        return tape.append_state(StateType::W, get_operand()->append_to(tape), rot);
+    }
+    template <> size_t State<StateType::P>::append_to(Tape& tape) const
+    {
+        return tape.append_state(StateType::P, get_operand()->append_to(tape), rot);
+    }
+    template <> size_t State<StateType::Q>::append_to(Tape& tape) const
+    {
+        return tape.append_state(StateType::Q, get_operand()->append_to(tape), rot);
+    }
+    template <> size_t State<StateType::R>::append_to(Tape& tape) const
+    {
+        return tape.append_state(StateType::R, get_operand()->append_to(tape), rot);
+    }
+    template <> size_t State<StateType::PHI>::append_to(Tape& tape) const
+    {
+        return tape.append_state(StateType::PHI, get_operand()->append_to(tape), rot);
+    }
+    template <> size_t State<StateType::THETA>::append_to(Tape& tape) const
+    {
+        return tape.append_state(StateType::THETA, get_operand()->append_to(tape), rot);
+    }
+    template <> size_t State<StateType::PSI>::append_to(Tape& tape) const
+    {
+        return tape.append_state(StateType::PSI, get_operand()->append_to(tape), rot);
+    }
+    template <> size_t State<StateType::QR>::append_to(Tape& tape) const
+    {
+        return tape.append_state(StateType::QR, get_operand()->append_to(tape), rot);
+    }
+    template <> size_t State<StateType::QI>::append_to(Tape& tape) const
+    {
+        return tape.append_state(StateType::QI, get_operand()->append_to(tape), rot);
+    }
+    template <> size_t State<StateType::QJ>::append_to(Tape& tape) const
+    {
+        return tape.append_state(StateType::QJ, get_operand()->append_to(tape), rot);
+    }
+    template <> size_t State<StateType::QK>::append_to(Tape& tape) const
+    {
+        return tape.append_state(StateType::QK, get_operand()->append_to(tape), rot);
+    }
+}
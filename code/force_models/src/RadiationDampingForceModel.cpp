@@ -8,10 +8,12 @@
 #include "RadiationDampingForceModel.hpp"
 
 #include "Body.hpp"
+#include "FixedLagConvolution.hpp"
 #include "HDBParser.hpp"
 #include "History.hpp"
 #include "InvalidInputException.hpp"
 #include "RadiationDampingBuilder.hpp"
+#include "RecursiveConvolution.hpp"
 #include "external_data_structures_parsers.hpp"
 
 #include <ssc/macros.hpp>
@@ -93,7 +95,9 @@ class RadiationDampingForceModel::Impl
     public:
         Impl(const TR1(shared_ptr)<HDBParser>& parser, const YamlRadiationDamping& yaml) : hdb{parser}, builder(RadiationDampingBuilder(yaml.type_of_quadrature_for_convolution, yaml.type_of_quadrature_for_cos_transform)), K(),
         omega(parser->get_radiation_damping_angular_frequencies()), taus(), n(yaml.nb_of_points_for_retardation_function_discretization), Tmin(yaml.tau_min), Tmax(yaml.tau_max),
-        H0(yaml.calculation_point_in_body_frame.x,yaml.calculation_point_in_body_frame.y,yaml.calculation_point_in_body_frame.y)
+        H0(yaml.calculation_point_in_body_frame.x,yaml.calculation_point_in_body_frame.y,yaml.calculation_point_in_body_frame.y),
+        use_recursive_convolution(yaml.use_recursive_convolution), recursive_convolutions(),
+        use_streaming_convolution(yaml.streaming_convolution_time_step > 0), streaming_convolutions()
         {
             CSVWriter omega_writer(std::cerr, "omega", omega);
             taus = builder.build_regular_intervals(Tmin,Tmax,n);
@@ -105,12 +109,22 @@ class RadiationDampingForceModel::Impl
                 {
                     const auto Br = get_Br(i,j);
                     K[i][j] = get_K(Br);
+                    if (use_recursive_convolution)
+                    {
+                        recursive_convolutions[i][j].reset(new RecursiveConvolution(K[i][j], Tmin, Tmax, yaml.max_nb_of_exponentials_for_recursive_convolution));
+                    }
                     if (yaml.output_Br_and_K)
                     {
                         omega_writer.add("Br",Br,i+1,j+1);
                         tau_writer.add("K",K[i][j],i+1,j+1);
                     }
                 }
+                if (use_streaming_convolution)
+                {
+                    // The retardation functions of row i are all convolved with the same history:
+                    // a single sampled history (& a single convolution) is enough for the whole row
+                    streaming_convolutions[i].reset(new FixedLagConvolution(std::vector<std::function<double(double)> >(K[i].begin(), K[i].end()), Tmin, Tmax, yaml.streaming_convolution_time_step));
+                }
             }
             if (yaml.output_Br_and_K)
             {
@@ -119,6 +133,35 @@ class RadiationDampingForceModel::Impl
                 std::cerr << std::endl << "Debugging information for retardation functions K:" << std::endl;
                 tau_writer.print();
             }
+            if (use_recursive_convolution)
+            {
+                report_fitting_errors(yaml.output_Br_and_K);
+            }
+        }
+
+        void report_fitting_errors(const bool verbose) const
+        {
+            const double max_acceptable_error = 1E-2;
+            if (verbose)
+            {
+                std::cerr << std::endl << "Relative fitting errors of the retardation functions (recursive convolution):" << std::endl;
+                std::cerr << "K,nb of exponentials,relative error" << std::endl;
+            }
+            for (size_t i = 0 ; i < 6 ; ++i)
+            {
+                for (size_t j = 0 ; j < 6 ; ++j)
+                {
+                    const double err = recursive_convolutions[i][j]->get_relative_fitting_error();
+                    const size_t n = recursive_convolutions[i][j]->get_nb_of_exponentials();
+                    if (verbose) std::cerr << "K_" << i+1 << j+1 << ',' << n << ',' << err << std::endl;
+                    if (err > max_acceptable_error)
+                    {
+                        std::cerr << "Warning: retardation function K_" << i+1 << j+1 << " is approximated by " << n
+                                  << " exponentials with a relative error of " << err*100 << "% in the radiation damping model: "
+                                  << "consider increasing 'max nb of exponentials for recursive convolution' or using a quadrature." << std::endl;
+                    }
+                }
+            }
         }
 
         std::function<double(double)> get_Br(const size_t i, const size_t j) const
@@ -133,14 +176,25 @@ class RadiationDampingForceModel::Impl
 
         double get_convolution_for_axis(const size_t i, const History& his)
         {
+            if (use_streaming_convolution)
+            {
+                return streaming_convolutions[i]->operator()(his);
+            }
             double K_X_dot = 0;
             for (size_t k = 0 ; k < 6 ; ++k)
             {
                 if (his.get_duration() >= Tmin)
                 {
-                    // Integrate up to Tmax if possible, but never exceed the history length
-                    const double co = builder.convolution(his, K[i][k], Tmin, std::min(Tmax, his.get_duration()));
-                    K_X_dot += co;
+                    if (use_recursive_convolution)
+                    {
+                        K_X_dot += recursive_convolutions[i][k]->operator()(his);
+                    }
+                    else
+                    {
+                        // Integrate up to Tmax if possible, but never exceed the history length
+                        const double co = builder.convolution(his, K[i][k], Tmin, std::min(Tmax, his.get_duration()));
+                        K_X_dot += co;
+                    }
                 }
             }
             return K_X_dot;
@@ -176,6 +230,10 @@ class RadiationDampingForceModel::Impl
         double Tmin;
         double Tmax;
         Eigen::Vector3d H0;
+        bool use_recursive_convolution;
+        std::array<std::array<TR1(shared_ptr)<RecursiveConvolution>,6>, 6> recursive_convolutions;
+        bool use_streaming_convolution;
+        std::array<TR1(shared_ptr)<FixedLagConvolution>, 6> streaming_convolutions; //!< One per axis (sum of the row's retardation functions)
 };
 
 
@@ -233,6 +291,26 @@ RadiationDampingForceModel::Input RadiationDampingForceModel::parse(const std::s
     ssc::yaml_parser::parse_uv(node["tau max"], input.tau_max);
     node["output Br and K"] >> input.output_Br_and_K;
     node["calculation point in body frame"] >> input.calculation_point_in_body_frame;
+    if (const YAML::Node* recursive = node.FindValue("recursive convolution"))
+    {
+        *recursive >> input.use_recursive_convolution;
+    }
+    if (const YAML::Node* nb_of_exponentials = node.FindValue("max nb of exponentials for recursive convolution"))
+    {
+        *nb_of_exponentials >> input.max_nb_of_exponentials_for_recursive_convolution;
+    }
+    if (const YAML::Node* time_step = node.FindValue("streaming convolution time step"))
+    {
+        ssc::yaml_parser::parse_uv(*time_step, input.streaming_convolution_time_step);
+        if (not(input.streaming_convolution_time_step > 0))
+        {
+            THROW(__PRETTY_FUNCTION__, InvalidInputException, "In the radiation damping model, 'streaming convolution time step' should be strictly positive, but got " << input.streaming_convolution_time_step << " s");
+        }
+        if (input.use_recursive_convolution)
+        {
+            THROW(__PRETTY_FUNCTION__, InvalidInputException, "In the radiation damping model, 'recursive convolution' & 'streaming convolution time step' cannot be used together: choose one of them");
+        }
+    }
     if (parse_hdb)
     {
         const TR1(shared_ptr)<HDBParser> hdb(new HDBParser(ssc::text_file_reader::TextFileReader(std::vector<std::string>(1,input.hdb_filename)).get_contents()));
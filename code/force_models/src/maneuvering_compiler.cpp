@@ -6,10 +6,13 @@
  */
 
 
+#include "InvalidInputException.hpp"
 #include "ManeuveringInternal.hpp"
 #include "maneuvering_compiler.hpp"
 #include "maneuvering_grammar.hpp"
 
+#define TIME_REGISTER 0
+
 using namespace maneuvering;
 using boost::spirit::ascii::blank;
 
@@ -190,6 +193,150 @@ namespace maneuvering
         node->accept(find_Tmax);
         return find_Tmax.get_Tmax();
     }
-}
 
+    Tape::Tape(const std::map<std::string, NodePtr>& nodes_, const std::vector<std::string>& outputs) :
+            nodes(nodes_),
+            variable_registers(),
+            variables_being_compiled(),
+            inputs(),
+            input_registers(),
+            output_registers(),
+            rotations(),
+            instructions(),
+            registers(1, 0) // TIME_REGISTER
+    {
+        for (const auto output:outputs) output_registers.push_back(append_identifier(output));
+    }
+
+    const std::vector<std::string>& Tape::get_inputs() const
+    {
+        return inputs;
+    }
+
+    void Tape::set_input(const size_t idx, const double val)
+    {
+        registers[input_registers.at(idx)] = val;
+    }
+
+    double Tape::get_output(const size_t idx) const
+    {
+        return registers[output_registers.at(idx)];
+    }
+
+    size_t Tape::append_time() const
+    {
+        return TIME_REGISTER;
+    }
+
+    size_t Tape::append_constant(const double val)
+    {
+        registers.push_back(val);
+        return registers.size()-1;
+    }
+
+    size_t Tape::append_identifier(const std::string& name)
+    {
+        const auto it = variable_registers.find(name);
+        if (it != variable_registers.end()) return it->second;
+        const auto node = nodes.find(name);
+        if (node == nodes.end())
+        {
+            inputs.push_back(name);
+            input_registers.push_back(append_constant(0));
+            variable_registers[name] = input_registers.back();
+            return input_registers.back();
+        }
+        if (variables_being_compiled.count(name))
+        {
+            THROW(__PRETTY_FUNCTION__, InvalidInputException, "Circular dependency in maneuvering model: variable '" << name << "' depends on itself.");
+        }
+        variables_being_compiled.insert(name);
+        const size_t reg = node->second->append_to(*this);
+        variables_being_compiled.erase(name);
+        variable_registers[name] = reg;
+        return reg;
+    }
+
+    size_t Tape::append(const Operation op, const StateType state, const size_t lhs, const size_t rhs)
+    {
+        Instruction instruction;
+        instruction.op = op;
+        instruction.state = state;
+        instruction.out = append_constant(0);
+        instruction.lhs = lhs;
+        instruction.rhs = rhs;
+        instructions.push_back(instruction);
+        return instruction.out;
+    }
+
+    size_t Tape::append_unary(const Operation op, const size_t operand)
+    {
+        return append(op, StateType::X, operand, operand);
+    }
+
+    size_t Tape::append_binary(const Operation op, const size_t lhs, const size_t rhs)
+    {
+        return append(op, StateType::X, lhs, rhs);
+    }
+
+    size_t Tape::append_state(const StateType state, const size_t operand, const YamlRotation& rot)
+    {
+        rotations.push_back(rot);
+        return append(Operation::STATE, state, operand, rotations.size()-1);
+    }
+
+    double Tape::get_state(const StateType state, const BodyStates& states, const double t, const YamlRotation& rot) const
+    {
+        switch(state)
+        {
+            case StateType::X :  return states.x(t);
+            case StateType::Y :  return states.y(t);
+            case StateType::Z :  return states.z(t);
+            case StateType::U :  return states.u(t);
+            case StateType::V :  return states.v(t);
+            case StateType::W :  return states.w(t);
+            case StateType::P :  return states.p(t);
+            case StateType::Q :  return states.q(t);
+            case StateType::R :  return states.r(t);
+            case StateType::QR : return states.qr(t);
+            case StateType::QI : return states.qi(t);
+            case StateType::QJ : return states.qj(t);
+            case StateType::QK : return states.qk(t);
+            case StateType::PHI:
+            case StateType::THETA:
+            case StateType::PSI:
+            {
+                const ssc::kinematics::RotationMatrix R = Eigen::Quaternion<double>(states.qr(t),states.qi(t),states.qj(t),states.qk(t)).matrix();
+                const ssc::kinematics::EulerAngles angles = BodyStates::convert(R, rot);
+                if (state == StateType::PHI)   return angles.phi;
+                if (state == StateType::THETA) return angles.theta;
+                return angles.psi;
+            }
+        }
+        return 0;
+    }
 
+    void Tape::evaluate(const BodyStates& states, const double t)
+    {
+        registers[TIME_REGISTER] = t;
+        double* const r = registers.data();
+        for (const auto& i:instructions)
+        {
+            switch(i.op)
+            {
+                case Operation::COS:        r[i.out] = std::cos(r[i.lhs]);            break;
+                case Operation::SIN:        r[i.out] = std::sin(r[i.lhs]);            break;
+                case Operation::ABS:        r[i.out] = std::abs(r[i.lhs]);            break;
+                case Operation::LOG:        r[i.out] = std::log(r[i.lhs]);            break;
+                case Operation::EXP:        r[i.out] = std::exp(r[i.lhs]);            break;
+                case Operation::SQRT:       r[i.out] = std::sqrt(r[i.lhs]);           break;
+                case Operation::SUM:        r[i.out] = r[i.lhs] + r[i.rhs];           break;
+                case Operation::POW:        r[i.out] = std::pow(r[i.lhs], r[i.rhs]);  break;
+                case Operation::DIFFERENCE: r[i.out] = r[i.lhs] - r[i.rhs];           break;
+                case Operation::DIVIDE:     r[i.out] = r[i.lhs] / r[i.rhs];           break;
+                case Operation::MULTIPLY:   r[i.out] = r[i.lhs] * r[i.rhs];           break;
+                case Operation::STATE:      r[i.out] = get_state(i.state, states, t-r[i.lhs], rotations[i.rhs]); break;
+            }
+        }
+    }
+}
@@ -8,8 +8,13 @@
 
 #include "DiffractionForceModelTest.hpp"
 #include "DiffractionForceModel.hpp"
+#include "InvalidInputException.hpp"
 #include "yaml_data.hpp"
 
+#define _USE_MATH_DEFINES
+#include <cmath>
+#define PI M_PI
+
 DiffractionForceModelTest::DiffractionForceModelTest() : a(ssc::random_data_generator::DataGenerator(545454))
 {
 }
@@ -34,6 +39,19 @@ TEST_F(DiffractionForceModelTest, parser)
     ASSERT_EQ(0, r.calculation_point.y);
     ASSERT_EQ(1.418, r.calculation_point.z);
     ASSERT_TRUE(r.mirror);
+    ASSERT_EQ(0, r.heading_step_for_rao_cache);
+}
+
+TEST_F(DiffractionForceModelTest, can_parse_heading_step_for_rao_cache)
+{
+    const YamlDiffraction r = DiffractionForceModel::parse(test_data::diffraction() + "heading step for RAO cache: {value: 2, unit: deg}\n");
+    ASSERT_DOUBLE_EQ(2*PI/180, r.heading_step_for_rao_cache);
+}
+
+TEST_F(DiffractionForceModelTest, heading_step_for_rao_cache_should_be_strictly_positive)
+{
+    ASSERT_THROW(DiffractionForceModel::parse(test_data::diffraction() + "heading step for RAO cache: {value: 0, unit: deg}\n"), InvalidInputException);
+    ASSERT_THROW(DiffractionForceModel::parse(test_data::diffraction() + "heading step for RAO cache: {value: -1, unit: deg}\n"), InvalidInputException);
 }
 
 
@@ -13,6 +13,8 @@
 #include "TriMeshTestData.hpp"
 #include "MeshIntersector.hpp"
 #include "ExactHydrostaticForceModel.hpp"
+#include "generate_test_ship.hpp"
+#include "ThreadPool.hpp"
 
 #include <ssc/kinematics.hpp>
 
@@ -246,3 +248,47 @@ TEST_F(HydrostaticForceModelTest, potential_energy_half_immersed_cube_exact)
     const double Ep = F.potential_energy(states, x);
     ASSERT_DOUBLE_EQ(-1024*0.5*9.81*0.25, Ep);
 }
+
+ssc::kinematics::Wrench hydrostatic_force_on_test_ship(EnvironmentAndFrames env, const size_t nb_of_threads, const bool exact);
+ssc::kinematics::Wrench hydrostatic_force_on_test_ship(EnvironmentAndFrames env, const size_t nb_of_threads, const bool exact)
+{
+    if (nb_of_threads > 1) env.thread_pool.reset(new ThreadPool(nb_of_threads));
+    BodyStates states = get_body(BODY, test_ship())->get_states();
+    states.g_in_mesh_frame = EPoint(0, 0, env.g);
+    const Matrix3x& nodes = states.intersector->mesh->nodes;
+    std::vector<double> dz((size_t)nodes.cols());
+    // Heeled & trimmed ship, about half of the facets being immersed
+    for (size_t i = 0 ; i < dz.size() ; ++i) dz[i] = nodes(2,(int)i) + 0.1*nodes(1,(int)i) - 0.02*nodes(0,(int)i) + 3;
+    states.intersector->update_intersection_with_free_surface(dz, dz);
+    if (exact) return ExactHydrostaticForceModel(BODY, env)(states, 0);
+    return FastHydrostaticForceModel(BODY, env)(states, 0);
+}
+
+TEST_F(HydrostaticForceModelTest, LONG_splitting_the_facets_between_threads_gives_reproducible_results)
+{
+    const EnvironmentAndFrames env = get_environment_and_frames();
+    for (const bool exact:{false, true})
+    {
+        const ssc::kinematics::Wrench sequential = hydrostatic_force_on_test_ship(env, 1, exact);
+        for (size_t nb_of_threads = 2 ; nb_of_threads <= 4 ; ++nb_of_threads)
+        {
+            const ssc::kinematics::Wrench F1 = hydrostatic_force_on_test_ship(env, nb_of_threads, exact);
+            const ssc::kinematics::Wrench F2 = hydrostatic_force_on_test_ship(env, nb_of_threads, exact);
+            // Same number of threads: exactly the same results
+            ASSERT_EQ(F1.X(), F2.X());
+            ASSERT_EQ(F1.Y(), F2.Y());
+            ASSERT_EQ(F1.Z(), F2.Z());
+            ASSERT_EQ(F1.K(), F2.K());
+            ASSERT_EQ(F1.M(), F2.M());
+            ASSERT_EQ(F1.N(), F2.N());
+            // Different number of threads: same results, up to rounding errors
+            const double eps = 1E-9*std::abs(sequential.Z());
+            ASSERT_NEAR(sequential.X(), F1.X(), eps);
+            ASSERT_NEAR(sequential.Y(), F1.Y(), eps);
+            ASSERT_NEAR(sequential.Z(), F1.Z(), eps);
+            ASSERT_NEAR(sequential.K(), F1.K(), 100*eps);
+            ASSERT_NEAR(sequential.M(), F1.M(), 100*eps);
+            ASSERT_NEAR(sequential.N(), F1.N(), 100*eps);
+        }
+    }
+}
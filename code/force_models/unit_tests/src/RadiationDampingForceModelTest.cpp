@@ -18,6 +18,7 @@
 #include "RadiationDampingForceModel.hpp"
 #include "RadiationDampingForceModelTest.hpp"
 #include "EnvironmentAndFrames.hpp"
+#include "InvalidInputException.hpp"
 #include "yaml_data.hpp"
 
 #define EPS 5E-2
@@ -78,6 +79,28 @@ TEST_F(RadiationDampingForceModelTest, parser)
     ASSERT_DOUBLE_EQ(0.696, r.calculation_point_in_body_frame.x);
     ASSERT_DOUBLE_EQ(0, r.calculation_point_in_body_frame.y);
     ASSERT_DOUBLE_EQ(1.418, r.calculation_point_in_body_frame.z);
+    ASSERT_FALSE(r.use_recursive_convolution);
+    ASSERT_EQ(20, r.max_nb_of_exponentials_for_recursive_convolution);
+}
+
+TEST_F(RadiationDampingForceModelTest, can_parse_recursive_convolution_parameters)
+{
+    const std::string yaml = test_data::radiation_damping()
+                           + "recursive convolution: true\n"
+                           + "max nb of exponentials for recursive convolution: 12\n";
+    const YamlRadiationDamping r = RadiationDampingForceModel::parse(yaml,false).yaml;
+    ASSERT_TRUE(r.use_recursive_convolution);
+    ASSERT_EQ(12, r.max_nb_of_exponentials_for_recursive_convolution);
+}
+
+TEST_F(RadiationDampingForceModelTest, can_parse_streaming_convolution_time_step)
+{
+    const std::string yaml = test_data::radiation_damping()
+                           + "streaming convolution time step: {value: 0.05, unit: s}\n";
+    ASSERT_DOUBLE_EQ(0, RadiationDampingForceModel::parse(test_data::radiation_damping(),false).yaml.streaming_convolution_time_step);
+    ASSERT_DOUBLE_EQ(0.05, RadiationDampingForceModel::parse(yaml,false).yaml.streaming_convolution_time_step);
+    ASSERT_THROW(RadiationDampingForceModel::parse(yaml + "recursive convolution: true\n",false), InvalidInputException);
+    ASSERT_THROW(RadiationDampingForceModel::parse(test_data::radiation_damping() + "streaming convolution time step: {value: 0, unit: s}\n",false), InvalidInputException);
 }
 
 TEST_F(RadiationDampingForceModelTest, example)
@@ -169,3 +192,71 @@ TEST_F(RadiationDampingForceModelTest, force_model_knows_history_length)
     const RadiationDampingForceModel F(input, "", EnvironmentAndFrames());
     ASSERT_DOUBLE_EQ(input.yaml.tau_max, F.get_Tmax());
 }
+
+TEST_F(RadiationDampingForceModelTest, recursive_convolution_gives_the_same_results_as_quadrature)
+{
+    RadiationDampingForceModel::Input input;
+    input.hdb = get_hdb_data();
+    input.yaml = get_yaml_data(false);
+    RadiationDampingForceModel F_quadrature(input, "", EnvironmentAndFrames());
+    input.yaml.use_recursive_convolution = true;
+    RadiationDampingForceModel F_recursive(input, "", EnvironmentAndFrames());
+    BodyStates states(input.yaml.tau_max);
+    // History is shorter than tau max so both methods integrate on the same interval
+    const double dt = 0.05;
+    for (size_t i = 0 ; i < 160 ; ++i)
+    {
+        const double t = dt*(double)i;
+        states.u.record(t, sin(0.7*t));
+        states.v.record(t, cos(0.3*t));
+        states.w.record(t, 0.5*sin(1.2*t));
+        states.p.record(t, 0.1*cos(0.8*t));
+        states.q.record(t, 0.2*sin(0.4*t));
+        states.r.record(t, 1);
+        const auto Frec = F_recursive(states, t);
+        if (i % 20 == 19)
+        {
+            const auto Fquad = F_quadrature(states, t);
+            ASSERT_NEAR(Fquad.X(), Frec.X(), EPS) << "t = " << t;
+            ASSERT_NEAR(Fquad.Y(), Frec.Y(), EPS) << "t = " << t;
+            ASSERT_NEAR(Fquad.Z(), Frec.Z(), EPS) << "t = " << t;
+            ASSERT_NEAR(Fquad.K(), Frec.K(), EPS) << "t = " << t;
+            ASSERT_NEAR(Fquad.M(), Frec.M(), EPS) << "t = " << t;
+            ASSERT_NEAR(Fquad.N(), Frec.N(), EPS) << "t = " << t;
+        }
+    }
+}
+
+TEST_F(RadiationDampingForceModelTest, streaming_convolution_gives_the_same_results_as_quadrature)
+{
+    RadiationDampingForceModel::Input input;
+    input.hdb = get_hdb_data();
+    input.yaml = get_yaml_data(false);
+    RadiationDampingForceModel F_quadrature(input, "", EnvironmentAndFrames());
+    const double dt = 0.05;
+    input.yaml.streaming_convolution_time_step = dt;
+    RadiationDampingForceModel F_streaming(input, "", EnvironmentAndFrames());
+    BodyStates states(input.yaml.tau_max);
+    // History longer than tau max, recorded at each step & at the middle of each step (like a Runge-Kutta solver)
+    for (size_t i = 0 ; i < 480 ; ++i)
+    {
+        const double t = dt/2*(double)i;
+        states.u.record(t, sin(0.7*t));
+        states.v.record(t, cos(0.3*t));
+        states.w.record(t, 0.5*sin(1.2*t));
+        states.p.record(t, 0.1*cos(0.8*t));
+        states.q.record(t, 0.2*sin(0.4*t));
+        states.r.record(t, 1);
+        const auto Fstream = F_streaming(states, t);
+        if (i % 40 == 39)
+        {
+            const auto Fquad = F_quadrature(states, t);
+            ASSERT_NEAR(Fquad.X(), Fstream.X(), EPS) << "t = " << t;
+            ASSERT_NEAR(Fquad.Y(), Fstream.Y(), EPS) << "t = " << t;
+            ASSERT_NEAR(Fquad.Z(), Fstream.Z(), EPS) << "t = " << t;
+            ASSERT_NEAR(Fquad.K(), Fstream.K(), EPS) << "t = " << t;
+            ASSERT_NEAR(Fquad.M(), Fstream.M(), EPS) << "t = " << t;
+            ASSERT_NEAR(Fquad.N(), Fstream.N(), EPS) << "t = " << t;
+        }
+    }
+}
@@ -6,8 +6,12 @@
  */
 
 
+#include "InvalidInputException.hpp"
 #include "maneuvering_compilerTest.hpp"
 #include "maneuvering_compiler.hpp"
+#include "maneuvering_DataSource_builder.hpp"
+#include "ManeuveringForceModel.hpp"
+#include "yaml_data.hpp"
 
 maneuvering_compilerTest::maneuvering_compilerTest() : a(ssc::random_data_generator::DataGenerator(2121545))
 {
@@ -163,3 +167,114 @@ TEST_F(maneuvering_compilerTest, can_get_Tmax)
     EXPECT_DOUBLE_EQ(1E15, maneuvering::get_Tmax(maneuvering::compile("x(t-x(t))", YamlRotation())));
     EXPECT_DOUBLE_EQ(1, maneuvering::get_Tmax(maneuvering::compile("x(t-cos(x(t)))", YamlRotation())));
 }
+
+TEST_F(maneuvering_compilerTest, can_evaluate_a_tape)
+{
+//! [maneuvering_compilerTest tape example]
+    std::map<std::string, maneuvering::NodePtr> nodes;
+    nodes["X"] = maneuvering::compile("2*Y+sqrt(x(t))", YamlRotation());
+    nodes["Y"] = maneuvering::compile("y(t)^2*k", YamlRotation());
+    maneuvering::Tape tape(nodes, {"X", "Y"});
+    BodyStates states;
+    states.x.record(10, 1024);
+    states.y.record(10, 400);
+    tape.set_input(0, 3);
+    tape.evaluate(states, 10);
+//! [maneuvering_compilerTest tape example]
+//! [maneuvering_compilerTest tape expected output]
+    ASSERT_EQ(std::vector<std::string>(1, "k"), tape.get_inputs());
+    ASSERT_DOUBLE_EQ(960032, tape.get_output(0));
+    ASSERT_DOUBLE_EQ(480000, tape.get_output(1));
+//! [maneuvering_compilerTest tape expected output]
+}
+
+TEST_F(maneuvering_compilerTest, outputs_not_defined_by_the_model_are_tape_inputs)
+{
+    std::map<std::string, maneuvering::NodePtr> nodes;
+    nodes["X"] = maneuvering::compile("a*b+a", YamlRotation());
+    maneuvering::Tape tape(nodes, {"X", "Y"});
+    ASSERT_EQ(3, tape.get_inputs().size());
+    ASSERT_EQ("a", tape.get_inputs().at(0));
+    ASSERT_EQ("b", tape.get_inputs().at(1));
+    ASSERT_EQ("Y", tape.get_inputs().at(2));
+    tape.set_input(0, 2);
+    tape.set_input(1, 5);
+    tape.set_input(2, 7);
+    tape.evaluate(BodyStates(), 0);
+    ASSERT_DOUBLE_EQ(12, tape.get_output(0));
+    ASSERT_DOUBLE_EQ(7, tape.get_output(1));
+}
+
+TEST_F(maneuvering_compilerTest, tape_should_detect_circular_dependencies)
+{
+    std::map<std::string, maneuvering::NodePtr> nodes;
+    nodes["X"] = maneuvering::compile("2*Y", YamlRotation());
+    nodes["Y"] = maneuvering::compile("Z+1", YamlRotation());
+    nodes["Z"] = maneuvering::compile("cos(X)", YamlRotation());
+    ASSERT_THROW(maneuvering::Tape(nodes, {"X"}), InvalidInputException);
+}
+
+BodyStates random_states(ssc::random_data_generator::DataGenerator& a);
+BodyStates random_states(ssc::random_data_generator::DataGenerator& a)
+{
+    BodyStates states(20);
+    for (size_t i = 0 ; i <= 12 ; ++i)
+    {
+        const double t = (double)i;
+        states.x.record(t, a.random<double>().between(-10,10));
+        states.y.record(t, a.random<double>().between(-10,10));
+        states.z.record(t, a.random<double>().between(-10,10));
+        states.u.record(t, a.random<double>().between(-10,10));
+        states.v.record(t, a.random<double>().between(-10,10));
+        states.w.record(t, a.random<double>().between(-10,10));
+        states.p.record(t, a.random<double>().between(-10,10));
+        states.q.record(t, a.random<double>().between(-10,10));
+        states.r.record(t, a.random<double>().between(-10,10));
+        states.qr.record(t, a.random<double>().between(-1,1));
+        states.qi.record(t, a.random<double>().between(-1,1));
+        states.qj.record(t, a.random<double>().between(-1,1));
+        states.qk.record(t, a.random<double>().between(-1,1));
+    }
+    return states;
+}
+
+TEST_F(maneuvering_compilerTest, tape_should_give_exactly_the_same_results_as_the_lambdas)
+{
+    YamlRotation rot;
+    rot.order_by = "angle";
+    rot.convention.push_back("z");
+    rot.convention.push_back("y'");
+    rot.convention.push_back("x''");
+    const std::vector<std::string> outputs = {"X", "Y", "Z", "K", "M", "N"};
+    const std::vector<std::string> models = {test_data::maneuvering(),
+                                             test_data::manoeuvring_with_euler_angles_and_quaternions(),
+                                             test_data::man_with_delay()};
+    for (const auto yaml:models)
+    {
+        std::map<std::string, maneuvering::NodePtr> nodes;
+        for (const auto var2expr:ManeuveringForceModel::parse(yaml).var2expr) nodes[var2expr.first] = maneuvering::compile(var2expr.second, rot);
+        maneuvering::Tape tape(nodes, outputs);
+        ssc::data_source::DataSource ds;
+        maneuvering::build_ds(ds, nodes);
+        for (size_t i = 0 ; i < 20 ; ++i)
+        {
+            const BodyStates states = random_states(a);
+            const double t = a.random<double>().between(10,11);
+            ds.check_in(__PRETTY_FUNCTION__);
+            ds.set("states", states);
+            ds.set("t", t);
+            for (size_t j = 0 ; j < tape.get_inputs().size() ; ++j)
+            {
+                const double val = a.random<double>().between(1,10);
+                ds.set(tape.get_inputs()[j], val);
+                tape.set_input(j, val);
+            }
+            tape.evaluate(states, t);
+            for (size_t j = 0 ; j < outputs.size() ; ++j)
+            {
+                ASSERT_EQ(ds.get<double>(outputs[j]), tape.get_output(j)) << "output: " << outputs[j];
+            }
+            ds.check_out();
+        }
+    }
+}
@@ -18,9 +18,11 @@ class GRPCForceModel : public ControllableForceModel
     public:
         struct Input
         {
+            Input();
             std::string url;
             std::string name;
             std::string yaml;
+            double timeout; //!< Maximum duration (in seconds) of each force evaluation on the stream (optional 'timeout' key, 60 s by default)
         };
         GRPCForceModel(const Input& input, const std::string& body_name, const EnvironmentAndFrames& env);
         ssc::kinematics::Vector6d get_force(const BodyStates& states, const double t, const std::map<std::string,double>& commands) const;
@@ -103,7 +103,7 @@ class SurfaceElevationFromGRPC : public SurfaceElevationInterface
                                                              ) const;
 
     private:
-        std::vector<FlatDiscreteDirectionalWaveSpectrum> get_flat_directional_spectra(const double x, const double y, const double t) const;
+        FlatDiscreteDirectionalWaveSpectraPtr get_flat_directional_spectra(const double x, const double y, const double t) const;
         std::vector<DiscreteDirectionalWaveSpectrum> get_directional_spectra(const double x, const double y, const double t) const;
         SurfaceElevationFromGRPC(); // Disabled (private & without implementation)
         class Impl;
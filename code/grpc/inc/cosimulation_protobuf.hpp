@@ -0,0 +1,34 @@
+/*
+ * cosimulation_protobuf.hpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: cady
+ */
+
+#ifndef GRPC_INC_COSIMULATION_PROTOBUF_HPP_
+#define GRPC_INC_COSIMULATION_PROTOBUF_HPP_
+
+#include <string>
+#include <vector>
+
+#include "YamlSimServerInputs.hpp"
+#include "YamlState.hpp"
+
+/**  \brief Binary (protobuf) encoding of xdyn-for-cs's requests & responses
+ *   \details Messages are defined in grpc/cosimulation.proto. They are the binary
+ *            counterpart of decode_YamlSimServerInputs & encode_YamlStates (JSON).
+ *   \section ex1 Example
+ *   \snippet grpc/unit_tests/src/cosimulation_protobufTest.cpp cosimulation_protobufTest example
+ */
+
+YamlSimServerInputs decode_binary_YamlSimServerInputs(const std::string& payload);
+std::string encode_binary_YamlSimServerInputs(const YamlSimServerInputs& inputs);
+
+std::vector<YamlState> decode_binary_YamlStates(const std::string& payload);
+std::string encode_binary_YamlStates(const std::vector<YamlState>& states);
+
+/**  \brief Serialized CosimulationResponse with no states & only the 'error' field set
+  */
+std::string encode_binary_error(const std::string& what);
+
+#endif /* GRPC_INC_COSIMULATION_PROTOBUF_HPP_ */
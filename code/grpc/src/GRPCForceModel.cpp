@@ -5,6 +5,7 @@
  *      Author: cady
  */
 
+#include <chrono>
 #include <memory> // std::make_shared
 #include <vector>
 #include <grpcpp/grpcpp.h>
@@ -20,6 +21,7 @@
 #include "GRPCError.hpp"
 #include "GRPCForceModel.hpp"
 #include "GRPCTypes.hpp"
+#include "InvalidInputException.hpp"
 #include "ToGRPC.hpp"
 #include "FromGRPC.hpp"
 
@@ -150,10 +152,25 @@ class GRPCForceModel::Impl
             , from_grpc(FromGRPC())
             , commands()
             , force_frame()
+            , stream_queue()
+            , stream_context()
+            , stream()
+            , use_stream(true)
         {
             set_parameters(input.yaml, body_name, input.name);
         }
 
+        ~Impl()
+        {
+            close_stream();
+            stream_queue.Shutdown();
+            void* tag = nullptr;
+            bool ok = false;
+            while (stream_queue.Next(&tag, &ok))
+            {
+            }
+        }
+
         GRPCForceModel::Input get_input() const
         {
             return input;
@@ -191,11 +208,15 @@ class GRPCForceModel::Impl
         ssc::kinematics::Vector6d force(const double t, const BodyStates& state, const std::map<std::string,double>& commands, const EnvironmentAndFrames& env, const std::string& instance_name)
         {
             ForceResponse response;
-            grpc::ClientContext context;
             const auto states = to_grpc.from_state(state, max_history_length, env);
             const auto wave_information = get_wave_information(t, state.x(0), state.y(0), state.z(0), env);
-            const grpc::Status status = stub->force(&context, to_grpc.from_force_request(states, commands, wave_information, instance_name), &response);
-            throw_if_invalid_status(input, "force", status);
+            const ForceRequest request = to_grpc.from_force_request(states, commands, wave_information, instance_name);
+            if (not(use_stream and force_on_stream(request, response)))
+            {
+                grpc::ClientContext context;
+                const grpc::Status status = stub->force(&context, request, &response);
+                throw_if_invalid_status(input, "force", status);
+            }
             extra_observations = std::map<std::string,double>(response.extra_observations().begin(),response.extra_observations().end());
             return from_grpc.to_force(response);
         }
@@ -231,6 +252,97 @@ class GRPCForceModel::Impl
             }
             return new WaveInformation();
         }
+
+        /**  \brief Sends the request on the stream (opened on the first call) & waits for the response, for 'input.timeout' seconds at most
+          *  \details The stream is kept open as long as the model exists, so it holds one of the server's workers. The only request
+          *           sent again (with the unary 'force' method) is the one refused because the server does not implement 'force_stream':
+          *           if the server does not answer in time, we cannot know whether it has processed the request, so we throw.
+          *  \returns False if the server does not implement 'force_stream', in which case we switch to the unary 'force' method for good
+          */
+        bool force_on_stream(const ForceRequest& request, ForceResponse& response)
+        {
+            const auto deadline = std::chrono::system_clock::now() + std::chrono::microseconds((long long)(input.timeout*1E6));
+            bool timed_out = false;
+            bool ok = true;
+            if (not(stream))
+            {
+                stream_context.reset(new grpc::ClientContext());
+                stream = stub->PrepareAsyncforce_stream(stream_context.get(), &stream_queue);
+                stream->StartCall(this);
+                ok = wait_for_stream(deadline, timed_out);
+            }
+            if (ok)
+            {
+                stream->Write(request, this);
+                ok = wait_for_stream(deadline, timed_out);
+            }
+            if (ok)
+            {
+                stream->Read(&response, this);
+                ok = wait_for_stream(deadline, timed_out);
+            }
+            if (ok)
+            {
+                return true;
+            }
+            // The stream is broken: the reason is given by the final status
+            const grpc::Status status = finish_stream();
+            if (timed_out)
+            {
+                THROW(__PRETTY_FUNCTION__, GRPCError, "the distant force model '" << input.name << "' (" << input.url << ") did not answer on its stream ('force_stream') within "
+                      << input.timeout << " s. Either this model needs more time (cf. the 'timeout' key in the YAML file), or the server has fewer workers than there are open streams"
+                      << " (each force model using this server keeps one open during the whole simulation)");
+            }
+            if (status.error_code() == grpc::StatusCode::UNIMPLEMENTED)
+            {
+                use_stream = false;
+                return false;
+            }
+            throw_if_invalid_status(input, "force_stream", status);
+            THROW(__PRETTY_FUNCTION__, GRPCError, "the stream to the distant force model '" << input.name << "' (" << input.url << ") was closed by the server without any error");
+            return false;
+        }
+
+        /**  \brief Waits for the completion of the (only) pending operation on the stream
+          *  \returns False if the operation failed or did not complete before the deadline (in which case the stream is cancelled)
+          */
+        bool wait_for_stream(const std::chrono::system_clock::time_point& deadline, bool& timed_out)
+        {
+            void* tag = nullptr;
+            bool ok = false;
+            if (stream_queue.AsyncNext(&tag, &ok, deadline) == grpc::CompletionQueue::GOT_EVENT)
+            {
+                return ok;
+            }
+            timed_out = true;
+            // The pending operation completes (unsuccessfully) once the stream is cancelled
+            stream_context->TryCancel();
+            stream_queue.Next(&tag, &ok);
+            return false;
+        }
+
+        grpc::Status finish_stream()
+        {
+            grpc::Status status;
+            void* tag = nullptr;
+            bool ok = false;
+            stream->Finish(&status, this);
+            stream_queue.Next(&tag, &ok);
+            stream.reset();
+            stream_context.reset();
+            return status;
+        }
+
+        void close_stream()
+        {
+            if (stream)
+            {
+                // Don't wait for the server to end the stream: Finish() would block forever if it doesn't
+                stream_context->TryCancel();
+                finish_stream();
+            }
+        }
+
         GRPCForceModel::Input input;
         std::unique_ptr<Force::Stub> stub;
         std::map<std::string,double> extra_observations;
@@ -241,8 +353,16 @@ class GRPCForceModel::Impl
         FromGRPC from_grpc;
         std::vector<std::string> commands;
         YamlPosition force_frame;
+        grpc::CompletionQueue stream_queue; //!< The stream is asynchronous so that each request can time out without closing the stream
+        std::unique_ptr<grpc::ClientContext> stream_context; //!< Must outlive 'stream'
+        std::unique_ptr<grpc::ClientAsyncReaderWriter<ForceRequest, ForceResponse> > stream; //!< Kept open for the whole simulation, instead of a new RPC at each call
+        bool use_stream; //!< False if the server only implements the unary 'force' method
 };
 
+GRPCForceModel::Input::Input() : url(), name(), yaml(), timeout(60)
+{
+}
+
 std::string GRPCForceModel::model_name() {return "grpc";}
 
 
@@ -255,6 +375,14 @@ GRPCForceModel::Input GRPCForceModel::parse(const std::string& yaml)
     GRPCForceModel::Input ret;
     node["url"] >> ret.url;
     node["name"] >> ret.name;
+    if (const YAML::Node* timeout = node.FindValue("timeout"))
+    {
+        ssc::yaml_parser::parse_uv(*timeout, ret.timeout);
+        if (not(ret.timeout > 0))
+        {
+            THROW(__PRETTY_FUNCTION__, InvalidInputException, "In the gRPC force model '" << ret.name << "', 'timeout' should be strictly positive, but got " << ret.timeout << " s");
+        }
+    }
     YAML::Emitter out;
     out << node;
     ret.yaml = out.c_str();
@@ -389,13 +389,14 @@ ssc::kinematics::PointMatrix SurfaceElevationFromGRPC::orbital_velocity(const do
     return pimpl->orbital_velocities(x, y, z, t);
 }
 
-std::vector<FlatDiscreteDirectionalWaveSpectrum> SurfaceElevationFromGRPC::get_flat_directional_spectra(const double x, const double y, const double t) const
+FlatDiscreteDirectionalWaveSpectraPtr SurfaceElevationFromGRPC::get_flat_directional_spectra(const double x, const double y, const double t) const
 {
-    std::vector<FlatDiscreteDirectionalWaveSpectrum> ret;
+    // The spectra are computed by the gRPC server & may change at each call: they cannot be cached
+    TR1(shared_ptr)<std::vector<FlatDiscreteDirectionalWaveSpectrum> > ret(new std::vector<FlatDiscreteDirectionalWaveSpectrum>());
     const auto spectra = get_directional_spectra(x, y, t);
     for (const auto& spectrum:spectra)
     {
-        ret.push_back(flatten(spectrum));
+        ret->push_back(flatten(spectrum));
     }
     return ret;
 }
@@ -0,0 +1,172 @@
+/*
+ * cosimulation_protobuf.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: cady
+ */
+
+#include "cosimulation_protobuf.hpp"
+#include "cosimulation.pb.h"
+#include "InvalidInputException.hpp"
+
+#include <algorithm> // std::min
+
+void check_sizes(const States& states);
+void check_sizes(const States& states)
+{
+    const int n = states.t_size();
+    if ((states.x_size() != n) or (states.y_size() != n) or (states.z_size() != n)
+     or (states.u_size() != n) or (states.v_size() != n) or (states.w_size() != n)
+     or (states.p_size() != n) or (states.q_size() != n) or (states.r_size() != n)
+     or (states.qr_size() != n) or (states.qi_size() != n) or (states.qj_size() != n) or (states.qk_size() != n))
+    {
+        THROW(__PRETTY_FUNCTION__, InvalidInputException, "All fields of 'states' (t, x, y, z, u, v, w, p, q, r, qr, qi, qj, qk) should have the same size, but 't' has " << n << " values");
+    }
+}
+
+std::vector<YamlState> from_protobuf(const States& states);
+std::vector<YamlState> from_protobuf(const States& states)
+{
+    check_sizes(states);
+    const bool has_angles = (states.phi_size() == states.t_size()) and (states.theta_size() == states.t_size()) and (states.psi_size() == states.t_size());
+    std::vector<YamlState> ret(states.t_size());
+    for (int i = 0 ; i < states.t_size() ; ++i)
+    {
+        ret[i].t = states.t(i);
+        ret[i].x = states.x(i);
+        ret[i].y = states.y(i);
+        ret[i].z = states.z(i);
+        ret[i].u = states.u(i);
+        ret[i].v = states.v(i);
+        ret[i].w = states.w(i);
+        ret[i].p = states.p(i);
+        ret[i].q = states.q(i);
+        ret[i].r = states.r(i);
+        ret[i].qr = states.qr(i);
+        ret[i].qi = states.qi(i);
+        ret[i].qj = states.qj(i);
+        ret[i].qk = states.qk(i);
+        if (has_angles)
+        {
+            ret[i].phi = states.phi(i);
+            ret[i].theta = states.theta(i);
+            ret[i].psi = states.psi(i);
+        }
+    }
+    return ret;
+}
+
+void to_protobuf(const std::vector<YamlState>& states, States& ret);
+void to_protobuf(const std::vector<YamlState>& states, States& ret)
+{
+    const int n = (int)states.size();
+    ret.mutable_t()->Reserve(n);
+    ret.mutable_x()->Reserve(n);
+    ret.mutable_y()->Reserve(n);
+    ret.mutable_z()->Reserve(n);
+    ret.mutable_u()->Reserve(n);
+    ret.mutable_v()->Reserve(n);
+    ret.mutable_w()->Reserve(n);
+    ret.mutable_p()->Reserve(n);
+    ret.mutable_q()->Reserve(n);
+    ret.mutable_r()->Reserve(n);
+    ret.mutable_qr()->Reserve(n);
+    ret.mutable_qi()->Reserve(n);
+    ret.mutable_qj()->Reserve(n);
+    ret.mutable_qk()->Reserve(n);
+    ret.mutable_phi()->Reserve(n);
+    ret.mutable_theta()->Reserve(n);
+    ret.mutable_psi()->Reserve(n);
+    for (const auto& state:states)
+    {
+        ret.add_t(state.t);
+        ret.add_x(state.x);
+        ret.add_y(state.y);
+        ret.add_z(state.z);
+        ret.add_u(state.u);
+        ret.add_v(state.v);
+        ret.add_w(state.w);
+        ret.add_p(state.p);
+        ret.add_q(state.q);
+        ret.add_r(state.r);
+        ret.add_qr(state.qr);
+        ret.add_qi(state.qi);
+        ret.add_qj(state.qj);
+        ret.add_qk(state.qk);
+        ret.add_phi(state.phi);
+        ret.add_theta(state.theta);
+        ret.add_psi(state.psi);
+    }
+}
+
+YamlSimServerInputs decode_binary_YamlSimServerInputs(const std::string& payload)
+{
+    CosimulationRequest request;
+    if (not(request.ParseFromString(payload)))
+    {
+        THROW(__PRETTY_FUNCTION__, InvalidInputException, "Unable to decode the binary message received by xdyn-for-cs: it should be a serialized 'CosimulationRequest' (cf. cosimulation.proto). JSON requests should be sent as text.");
+    }
+    YamlSimServerInputs ret;
+    ret.Dt = request.dt();
+    ret.states = from_protobuf(request.states());
+    for (const auto& command:request.commands())
+    {
+        ret.commands[command.first] = command.second;
+    }
+    ret.session = request.session();
+    ret.close_session = request.close_session();
+    return ret;
+}
+
+std::string encode_binary_YamlSimServerInputs(const YamlSimServerInputs& inputs)
+{
+    CosimulationRequest request;
+    request.set_dt(inputs.Dt);
+    to_protobuf(inputs.states, *request.mutable_states());
+    request.mutable_commands()->insert(inputs.commands.begin(), inputs.commands.end());
+    request.set_session(inputs.session);
+    request.set_close_session(inputs.close_session);
+    return request.SerializeAsString();
+}
+
+std::vector<YamlState> decode_binary_YamlStates(const std::string& payload)
+{
+    CosimulationResponse response;
+    if (not(response.ParseFromString(payload)))
+    {
+        THROW(__PRETTY_FUNCTION__, InvalidInputException, "Unable to decode the binary message: it should be a serialized 'CosimulationResponse' (cf. cosimulation.proto)");
+    }
+    if (not(response.error().empty()))
+    {
+        THROW(__PRETTY_FUNCTION__, InvalidInputException, "xdyn-for-cs returned an error: " << response.error());
+    }
+    std::vector<YamlState> ret = from_protobuf(response.states());
+    const size_t n = std::min(ret.size(), (size_t)response.extra_observations_size());
+    for (size_t i = 0 ; i < n ; ++i)
+    {
+        for (const auto& observation:response.extra_observations((int)i).observations())
+        {
+            ret[i].extra_observations[observation.first] = observation.second;
+        }
+    }
+    return ret;
+}
+
+std::string encode_binary_YamlStates(const std::vector<YamlState>& states)
+{
+    CosimulationResponse response;
+    to_protobuf(states, *response.mutable_states());
+    response.mutable_extra_observations()->Reserve((int)states.size());
+    for (const auto& state:states)
+    {
+        response.add_extra_observations()->mutable_observations()->insert(state.extra_observations.begin(), state.extra_observations.end());
+    }
+    return response.SerializeAsString();
+}
+
+std::string encode_binary_error(const std::string& what)
+{
+    CosimulationResponse response;
+    response.set_error(what);
+    return response.SerializeAsString();
+}
@@ -0,0 +1,24 @@
+/*
+ * cosimulation_protobufTest.hpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: cady
+ */
+
+#ifndef GRPC_UNIT_TESTS_INC_COSIMULATION_PROTOBUFTEST_HPP_
+#define GRPC_UNIT_TESTS_INC_COSIMULATION_PROTOBUFTEST_HPP_
+
+#include "gtest/gtest.h"
+#include <ssc/random_data_generator/DataGenerator.hpp>
+
+class cosimulation_protobufTest : public ::testing::Test
+{
+    protected:
+        cosimulation_protobufTest();
+        virtual ~cosimulation_protobufTest();
+        virtual void SetUp();
+        virtual void TearDown();
+        ssc::random_data_generator::DataGenerator a;
+};
+
+#endif /* GRPC_UNIT_TESTS_INC_COSIMULATION_PROTOBUFTEST_HPP_ */
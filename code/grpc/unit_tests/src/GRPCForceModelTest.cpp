@@ -5,10 +5,192 @@
  *      Author: cady
  */
 
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+#include <grpcpp/grpcpp.h>
+#include "force.pb.h"
+#include "force.grpc.pb.h"
+
+#include "BodyStates.hpp"
+#include "GRPCError.hpp"
 #include "GRPCForceModel.hpp"
 #include "GRPCForceModelTest.hpp"
+#include "InvalidInputException.hpp"
 #include "yaml_data.hpp"
 
+class ForceServicerWithoutStream : public Force::Service
+{
+    public:
+        ForceServicerWithoutStream() : nb_of_force_calls(0)
+        {
+        }
+
+        grpc::Status set_parameters(grpc::ServerContext*, const SetForceParameterRequest*, SetForceParameterResponse* response) override
+        {
+            response->set_frame("body");
+            return grpc::Status::OK;
+        }
+
+        grpc::Status force(grpc::ServerContext*, const ForceRequest*, ForceResponse* response) override
+        {
+            response->set_fx(++nb_of_force_calls);
+            return grpc::Status::OK;
+        }
+
+        std::atomic<int> nb_of_force_calls;
+};
+
+class ForceServicerWithStream : public ForceServicerWithoutStream
+{
+    public:
+        ForceServicerWithStream() : nb_of_streams(0), nb_of_stream_requests(0)
+        {
+        }
+
+        grpc::Status force_stream(grpc::ServerContext*, grpc::ServerReaderWriter<ForceResponse, ForceRequest>* stream) override
+        {
+            ++nb_of_streams;
+            ForceRequest request;
+            while (stream->Read(&request))
+            {
+                ForceResponse response;
+                response.set_fx(++nb_of_stream_requests);
+                stream->Write(response);
+            }
+            return grpc::Status::OK;
+        }
+
+        std::atomic<int> nb_of_streams;
+        std::atomic<int> nb_of_stream_requests;
+};
+
+class ForceServicerWithFailingStream : public ForceServicerWithoutStream
+{
+    public:
+        ForceServicerWithFailingStream(const grpc::StatusCode code_) : code(code_)
+        {
+        }
+
+        grpc::Status force(grpc::ServerContext*, const ForceRequest*, ForceResponse*) override
+        {
+            return grpc::Status(code, "error in force model");
+        }
+
+        grpc::Status force_stream(grpc::ServerContext*, grpc::ServerReaderWriter<ForceResponse, ForceRequest>*) override
+        {
+            return grpc::Status(code, "error in force model");
+        }
+
+    private:
+        ForceServicerWithFailingStream(); // Disabled
+        grpc::StatusCode code;
+};
+
+class ForceServicerNeverClosingStream : public ForceServicerWithoutStream
+{
+    public:
+        grpc::Status force_stream(grpc::ServerContext* context, grpc::ServerReaderWriter<ForceResponse, ForceRequest>* stream) override
+        {
+            ForceRequest request;
+            stream->Read(&request);
+            stream->Write(ForceResponse());
+            // Ignores the end of the client's requests
+            while (not(context->IsCancelled()))
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+            return grpc::Status::OK;
+        }
+};
+
+class ForceServicerNeverAnswering : public ForceServicerWithoutStream
+{
+    public:
+        grpc::Status force_stream(grpc::ServerContext* context, grpc::ServerReaderWriter<ForceResponse, ForceRequest>*) override
+        {
+            // Like a server with no worker left for this stream
+            while (not(context->IsCancelled()))
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+            return grpc::Status::OK;
+        }
+};
+
+class InProcessServer
+{
+    public:
+        InProcessServer(Force::Service& service) : port(0), server()
+        {
+            grpc::ServerBuilder builder;
+            builder.AddListeningPort("localhost:0", grpc::InsecureServerCredentials(), &port);
+            builder.RegisterService(&service);
+            server = builder.BuildAndStart();
+        }
+
+        ~InProcessServer()
+        {
+            server->Shutdown(std::chrono::system_clock::now());
+        }
+
+        GRPCForceModel::Input get_input() const
+        {
+            GRPCForceModel::Input input;
+            input.url = "localhost:" + std::to_string(port);
+            input.name = "model";
+            input.yaml = "model: grpc";
+            return input;
+        }
+
+    private:
+        InProcessServer(); // Disabled
+        int port;
+        std::unique_ptr<grpc::Server> server;
+};
+
+double nb_of_calls_per_second(const GRPCForceModel& model, const BodyStates& states, const size_t nb_of_calls);
+double nb_of_calls_per_second(const GRPCForceModel& model, const BodyStates& states, const size_t nb_of_calls)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0 ; i < nb_of_calls ; ++i)
+    {
+        model.get_force(states, (double)i, {});
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return (double)nb_of_calls/elapsed.count();
+}
+
+EnvironmentAndFrames get_grpc_env();
+EnvironmentAndFrames get_grpc_env()
+{
+    EnvironmentAndFrames env;
+    env.rot = YamlRotation("angle", {"z","y'","x''"});
+    return env;
+}
+
+BodyStates get_grpc_states();
+BodyStates get_grpc_states()
+{
+    BodyStates states;
+    states.x.record(0, 1);
+    states.y.record(0, 2);
+    states.z.record(0, 3);
+    states.u.record(0, 4);
+    states.v.record(0, 5);
+    states.w.record(0, 6);
+    states.p.record(0, 7);
+    states.q.record(0, 8);
+    states.r.record(0, 9);
+    states.qr.record(0, 1);
+    states.qi.record(0, 0);
+    states.qj.record(0, 0);
+    states.qk.record(0, 0);
+    return states;
+}
+
 
 GRPCForceModelTest::GRPCForceModelTest()
 {
@@ -48,3 +230,108 @@ TEST_F(GRPCForceModelTest, can_parse_rest_of_yaml_parameters)
               "url: force-model:9002"
               , input.yaml);
 }
+
+TEST_F(GRPCForceModelTest, can_parse_timeout)
+{
+    ASSERT_DOUBLE_EQ(60, GRPCForceModel::parse(test_data::gRPC_force_model()).timeout);
+    ASSERT_DOUBLE_EQ(2, GRPCForceModel::parse(test_data::gRPC_force_model() + "timeout: {value: 2, unit: s}").timeout);
+}
+
+TEST_F(GRPCForceModelTest, timeout_should_be_strictly_positive)
+{
+    ASSERT_THROW(GRPCForceModel::parse(test_data::gRPC_force_model() + "timeout: {value: 0, unit: s}"), InvalidInputException);
+}
+
+TEST_F(GRPCForceModelTest, should_fall_back_to_the_unary_method_if_the_server_does_not_implement_force_stream)
+{
+    ForceServicerWithoutStream service;
+    const InProcessServer server(service);
+    const GRPCForceModel model(server.get_input(), "body", get_grpc_env());
+    const BodyStates states = get_grpc_states();
+    ASSERT_DOUBLE_EQ(1, model.get_force(states, 0, {})(0));
+    ASSERT_DOUBLE_EQ(2, model.get_force(states, 0, {})(0));
+    ASSERT_DOUBLE_EQ(3, model.get_force(states, 0, {})(0));
+    ASSERT_EQ(3, service.nb_of_force_calls.load());
+}
+
+TEST_F(GRPCForceModelTest, should_send_all_requests_on_a_single_stream)
+{
+    ForceServicerWithStream service;
+    const InProcessServer server(service);
+    const GRPCForceModel model(server.get_input(), "body", get_grpc_env());
+    const BodyStates states = get_grpc_states();
+    ASSERT_DOUBLE_EQ(1, model.get_force(states, 0, {})(0));
+    ASSERT_DOUBLE_EQ(2, model.get_force(states, 0, {})(0));
+    ASSERT_DOUBLE_EQ(3, model.get_force(states, 0, {})(0));
+    ASSERT_EQ(1, service.nb_of_streams.load());
+    ASSERT_EQ(3, service.nb_of_stream_requests.load());
+    ASSERT_EQ(0, service.nb_of_force_calls.load());
+}
+
+TEST_F(GRPCForceModelTest, errors_on_the_stream_should_be_reported_as_GRPCError)
+{
+    ForceServicerWithFailingStream service(grpc::StatusCode::INVALID_ARGUMENT);
+    const InProcessServer server(service);
+    const GRPCForceModel model(server.get_input(), "body", get_grpc_env());
+    ASSERT_THROW(model.get_force(get_grpc_states(), 0, {}), GRPCError);
+}
+
+TEST_F(GRPCForceModelTest, model_not_implementing_force_should_give_the_same_error_on_the_stream_and_on_the_unary_method)
+{
+    ForceServicerWithFailingStream service(grpc::StatusCode::UNIMPLEMENTED);
+    const InProcessServer server(service);
+    const GRPCForceModel model(server.get_input(), "body", get_grpc_env());
+    try
+    {
+        model.get_force(get_grpc_states(), 0, {});
+        FAIL() << "GRPCError expected";
+    }
+    catch (const GRPCError& e)
+    {
+        ASSERT_NE(std::string::npos, std::string(e.what()).find("does not implement gRPC method 'force'"));
+    }
+}
+
+TEST_F(GRPCForceModelTest, model_can_be_destroyed_even_if_the_server_never_closes_the_stream)
+{
+    ForceServicerNeverClosingStream service;
+    const InProcessServer server(service);
+    const auto start = std::chrono::steady_clock::now();
+    {
+        const GRPCForceModel model(server.get_input(), "body", get_grpc_env());
+        model.get_force(get_grpc_states(), 0, {});
+    }
+    // Without cancelling the stream, we would have to wait for its deadline
+    ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+}
+
+TEST_F(GRPCForceModelTest, should_throw_without_sending_the_request_again_if_the_server_does_not_answer_in_time)
+{
+    ForceServicerNeverAnswering service;
+    const InProcessServer server(service);
+    auto input = server.get_input();
+    input.timeout = 0.5;
+    const GRPCForceModel model(input, "body", get_grpc_env());
+    ASSERT_THROW(model.get_force(get_grpc_states(), 0, {}), GRPCError);
+    ASSERT_EQ(0, service.nb_of_force_calls.load());
+}
+
+TEST_F(GRPCForceModelTest, throughput_of_the_stream_and_of_the_unary_method)
+{
+    const size_t n = 1000;
+    const BodyStates states = get_grpc_states();
+    ForceServicerWithoutStream unary_service;
+    ForceServicerWithStream stream_service;
+    const InProcessServer unary_server(unary_service);
+    const InProcessServer stream_server(stream_service);
+    const GRPCForceModel unary_model(unary_server.get_input(), "body", get_grpc_env());
+    const GRPCForceModel stream_model(stream_server.get_input(), "body", get_grpc_env());
+    const double unary_throughput = nb_of_calls_per_second(unary_model, states, n);
+    const double stream_throughput = nb_of_calls_per_second(stream_model, states, n);
+    std::cout << "Force model calls per second on localhost: " << unary_throughput << " with 'force', "
+              << stream_throughput << " with 'force_stream'" << std::endl;
+    // Only the number of calls is checked: the timings depend on the machine
+    ASSERT_EQ((int)n, unary_service.nb_of_force_calls.load());
+    ASSERT_EQ((int)n, stream_service.nb_of_stream_requests.load());
+    ASSERT_EQ(1, stream_service.nb_of_streams.load());
+}
@@ -0,0 +1,108 @@
+/*
+ * cosimulation_protobufTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: cady
+ */
+
+#include "cosimulation_protobuf.hpp"
+#include "cosimulation_protobufTest.hpp"
+#include "InvalidInputException.hpp"
+
+cosimulation_protobufTest::cosimulation_protobufTest() : a(ssc::random_data_generator::DataGenerator(8421))
+{
+}
+
+cosimulation_protobufTest::~cosimulation_protobufTest()
+{
+}
+
+void cosimulation_protobufTest::SetUp()
+{
+}
+
+void cosimulation_protobufTest::TearDown()
+{
+}
+
+YamlState random_state(ssc::random_data_generator::DataGenerator& a, const double t);
+YamlState random_state(ssc::random_data_generator::DataGenerator& a, const double t)
+{
+    YamlState s(t,
+                a.random<double>(), a.random<double>(), a.random<double>(),
+                a.random<double>(), a.random<double>(), a.random<double>(),
+                a.random<double>(), a.random<double>(), a.random<double>(),
+                a.random<double>(), a.random<double>(), a.random<double>(), a.random<double>());
+    s.phi = a.random<double>();
+    s.theta = a.random<double>();
+    s.psi = a.random<double>();
+    return s;
+}
+
+TEST_F(cosimulation_protobufTest, requests_can_be_encoded_and_decoded)
+{
+    //! [cosimulation_protobufTest example]
+    YamlSimServerInputs inputs;
+    inputs.Dt = 0.5;
+    inputs.states.push_back(random_state(a, 0));
+    inputs.states.push_back(random_state(a, 0.1));
+    inputs.commands["PropRudd(rpm)"] = 100;
+    inputs.commands["PropRudd(beta)"] = 0.1;
+    inputs.session = "client 1";
+    inputs.close_session = true;
+    const std::string payload = encode_binary_YamlSimServerInputs(inputs);
+    const YamlSimServerInputs decoded = decode_binary_YamlSimServerInputs(payload);
+    //! [cosimulation_protobufTest example]
+    ASSERT_DOUBLE_EQ(0.5, decoded.Dt);
+    ASSERT_EQ(2, decoded.states.size());
+    for (size_t i = 0 ; i < 2 ; ++i)
+    {
+        ASSERT_EQ(inputs.states[i].t, decoded.states[i].t);
+        ASSERT_EQ(inputs.states[i].x, decoded.states[i].x);
+        ASSERT_EQ(inputs.states[i].y, decoded.states[i].y);
+        ASSERT_EQ(inputs.states[i].z, decoded.states[i].z);
+        ASSERT_EQ(inputs.states[i].u, decoded.states[i].u);
+        ASSERT_EQ(inputs.states[i].v, decoded.states[i].v);
+        ASSERT_EQ(inputs.states[i].w, decoded.states[i].w);
+        ASSERT_EQ(inputs.states[i].p, decoded.states[i].p);
+        ASSERT_EQ(inputs.states[i].q, decoded.states[i].q);
+        ASSERT_EQ(inputs.states[i].r, decoded.states[i].r);
+        ASSERT_EQ(inputs.states[i].qr, decoded.states[i].qr);
+        ASSERT_EQ(inputs.states[i].qi, decoded.states[i].qi);
+        ASSERT_EQ(inputs.states[i].qj, decoded.states[i].qj);
+        ASSERT_EQ(inputs.states[i].qk, decoded.states[i].qk);
+    }
+    ASSERT_EQ(inputs.commands, decoded.commands);
+    ASSERT_EQ("client 1", decoded.session);
+    ASSERT_TRUE(decoded.close_session);
+}
+
+TEST_F(cosimulation_protobufTest, responses_can_be_encoded_and_decoded)
+{
+    std::vector<YamlState> states;
+    for (size_t i = 0 ; i < 3 ; ++i) states.push_back(random_state(a, 0.1*double(i)));
+    states[1].extra_observations["Fx(propeller)"] = 12;
+    const std::vector<YamlState> decoded = decode_binary_YamlStates(encode_binary_YamlStates(states));
+    ASSERT_EQ(3, decoded.size());
+    for (size_t i = 0 ; i < 3 ; ++i)
+    {
+        ASSERT_EQ(states[i], decoded[i]);
+        ASSERT_EQ(states[i].extra_observations, decoded[i].extra_observations);
+    }
+}
+
+TEST_F(cosimulation_protobufTest, errors_are_forwarded_to_the_client)
+{
+    ASSERT_THROW(decode_binary_YamlStates(encode_binary_error("Dt should be greater than 0")), InvalidInputException);
+}
+
+TEST_F(cosimulation_protobufTest, should_throw_if_states_do_not_all_have_the_same_size)
+{
+    YamlSimServerInputs inputs;
+    inputs.Dt = 1;
+    inputs.states.push_back(random_state(a, 0));
+    ASSERT_NO_THROW(decode_binary_YamlSimServerInputs(encode_binary_YamlSimServerInputs(inputs)));
+    // 'states' (field 2) containing a single value for 't' (field 1) & nothing else
+    const std::string payload("\x12\x09\x09\0\0\0\0\0\0\0\0", 11);
+    ASSERT_THROW(decode_binary_YamlSimServerInputs(payload), InvalidInputException);
+}
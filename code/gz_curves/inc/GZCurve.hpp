@@ -8,6 +8,7 @@
 #ifndef GZCURVE_HPP_
 #define GZCURVE_HPP_
 
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -37,6 +38,17 @@ namespace GZ
             TR1(shared_ptr)<Impl> pimpl;
             double theta_eq;
     };
+
+    /**  \brief Computes the righting levers for several heel angles concurrently
+      *  \details The angles are split between the tasks of a ThreadPool. Each task owns a simulator
+      *           (built by make_sim, in the calling thread) & a Curve. Each angle is handled exactly as
+      *           Curve::gz would on a single simulator, so the results do not depend on the number of threads.
+      *  \returns GZ(phi) for each phi, in the same order
+      */
+    std::vector<double> compute_gz(const std::function<Sim()>& make_sim, //!< Builds a new (independent) simulator
+                                   const std::vector<double>& phis,      //!< Heel angles (in radian)
+                                   const size_t nb_of_threads            //!< Number of threads (0: one per core)
+                                   );
 }
 
 #endif /* GZCURVE_HPP_ */
@@ -11,6 +11,8 @@
 #include "gz_newton_raphson.hpp"
 #include "ResultantForceComputer.hpp"
 #include "Sim.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
 #include <cmath>
 #include <sstream>
 
@@ -132,3 +134,30 @@ double GZ::Curve::get_theta_eq() const
 {
     return theta_eq;
 }
+
+size_t get_nb_of_workers(const size_t nb_of_threads, const size_t nb_of_angles);
+size_t get_nb_of_workers(const size_t nb_of_threads, const size_t nb_of_angles)
+{
+    return std::max((size_t)1, std::min(get_nb_of_threads_to_use(nb_of_threads), nb_of_angles));
+}
+
+std::vector<double> GZ::compute_gz(const std::function<Sim()>& make_sim, const std::vector<double>& phis, const size_t nb_of_threads)
+{
+    std::vector<double> ret(phis.size(), 0);
+    if (phis.empty()) return ret;
+    const size_t nb_of_workers = get_nb_of_workers(nb_of_threads, phis.size());
+    // Simulators are built sequentially: only the computations run concurrently
+    std::vector<Sim> sims;
+    for (size_t i = 0 ; i < nb_of_workers ; ++i) sims.push_back(make_sim());
+    // One task per simulator: task k computes angles k, k+nb_of_workers, k+2*nb_of_workers...
+    ThreadPool pool(nb_of_workers);
+    pool.run(nb_of_workers, [&](const size_t k)
+        {
+            const Curve curve(sims[k]);
+            for (size_t i = k ; i < phis.size() ; i += nb_of_workers)
+            {
+                ret[i] = curve.gz(phis[i]);
+            }
+        });
+    return ret;
+}
@@ -163,3 +163,28 @@ TEST_F(GZCurveTest, should_throw_if_ship_is_denser_than_water)
     ASSERT_THROW({GZ::Curve simulate(sim);}, InvalidInputException);
 
 }
+
+TEST_F(GZCurveTest, parallel_sweep_should_give_the_same_results_as_the_sequential_one)
+{
+    const auto make_sim = [](){return GZ::make_sim(test_data::oscillating_cube_example(), test_data::cube());};
+    const std::vector<double> phis = GZ::Curve::get_phi(10*PI/180., 40*PI/180.);
+    const Sim sim = make_sim();
+    const GZ::Curve calculate(sim);
+    std::vector<double> expected;
+    for (auto phi:phis) expected.push_back(calculate.gz(phi));
+    for (size_t nb_of_threads = 1 ; nb_of_threads <= 3 ; ++nb_of_threads)
+    {
+        const std::vector<double> gz = GZ::compute_gz(make_sim, phis, nb_of_threads);
+        ASSERT_EQ(expected.size(), gz.size());
+        for (size_t i = 0 ; i < phis.size() ; ++i)
+        {
+            ASSERT_EQ(expected[i], gz[i]) << "nb_of_threads = " << nb_of_threads << ", phi = " << phis[i];
+        }
+    }
+}
+
+TEST_F(GZCurveTest, parallel_sweep_should_report_exceptions_thrown_by_the_workers)
+{
+    const auto make_sim = [](){return GZ::make_sim(test_data::bug_3004(), test_data::cube());};
+    ASSERT_THROW(GZ::compute_gz(make_sim, GZ::Curve::get_phi(0.1, 0.3), 2), InvalidInputException);
+}
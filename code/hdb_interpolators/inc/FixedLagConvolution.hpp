@@ -0,0 +1,79 @@
+/*
+ * FixedLagConvolution.hpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: cady
+ */
+
+#ifndef FIXEDLAGCONVOLUTION_HPP_
+#define FIXEDLAGCONVOLUTION_HPP_
+
+#include <functional>
+#include <vector>
+
+class History;
+
+/** \brief Computes the convolution of a retardation function with a state history, for fixed-step solvers
+ *  \details The retardation function K is sampled (once and for all, in the constructor) at the lags
+ *           \f$m\cdot dt\f$ between Tmin & Tmax. The state history is sampled at the instants \f$k\cdot dt\f$,
+ *           each instant being read (once) from the History when it is no longer the latest instant in
+ *           the history, & stored in a contiguous buffer. The convolution is then computed by the trapezoidal
+ *           rule, as a dot product between the sampled retardation function & the buffer. If the current
+ *           instant is not a multiple of dt (eg. intermediate steps of Runge-Kutta solvers), the state
+ *           is interpolated linearly between two instants of the buffer (as History does).
+ *           If dt is the solver's time step, the instants \f$k\cdot dt\f$ are in the history & no interpolation
+ *           is needed when sampling the history.
+ *           Like RadiationDampingBuilder::convolution, the integral is truncated at the history's length
+ *           if it is shorter than Tmax.
+ *  \addtogroup hdb_interpolators
+ *  \ingroup hdb_interpolators
+ *  \section ex1 Example
+ *  \snippet hdb_interpolators/unit_tests/src/FixedLagConvolutionTest.cpp FixedLagConvolutionTest example
+ *  \section ex2 Expected output
+ *  \snippet hdb_interpolators/unit_tests/src/FixedLagConvolutionTest.cpp FixedLagConvolutionTest expected output
+ */
+class FixedLagConvolution
+{
+    public:
+        FixedLagConvolution(const std::function<double(double)>& K, //!< Retardation function
+                            const double Tmin,                      //!< Beginning of the convolution (because retardation function may not be defined for T=0)
+                            const double Tmax,                      //!< End of the convolution
+                            const double dt                         //!< Step of the lag grid (should be the solver's time step)
+                            );
+
+        /**  \brief Sum of the convolutions of several retardation functions with the same history
+          *  \details The history is only sampled & stored once & the (linear) convolution is computed
+          *           once, with the sum of the retardation functions.
+          */
+        FixedLagConvolution(const std::vector<std::function<double(double)> >& Ks, //!< Retardation functions
+                            const double Tmin,                                     //!< Beginning of the convolution (because retardation functions may not be defined for T=0)
+                            const double Tmax,                                     //!< End of the convolution
+                            const double dt                                        //!< Step of the lag grid (should be the solver's time step)
+                            );
+
+        /**  \brief Convolution of the retardation function with the history, at the latest instant in the history
+          *  \details Returns zero if the history is shorter than Tmin (like RadiationDampingBuilder::convolution).
+          *           If the history was reset or rewound, it is sampled again from the start.
+          *  \returns \f$\int_{T_{\mbox{min}}}^{T_{\mbox{max}}} K(\tau)h(t-\tau)d\tau\f$
+          */
+        double operator()(const History& h);
+
+    private:
+        FixedLagConvolution();
+        void sample_history(const History& h, const double t);
+        double value_at_lag(const History& h, const long n, const double theta, const long m) const;
+
+        std::function<double(double)> K;
+        double Tmin;
+        double Tmax;
+        double dt;
+        long m0;                         //!< Index of the first lag on the grid (m0*dt >= Tmin)
+        long M;                          //!< Index of the last lag on the grid (M*dt <= Tmax)
+        double K_Tmin;                   //!< K(Tmin)
+        double K_Tmax;                   //!< K(Tmax)
+        std::vector<double> K_lags;      //!< K(m*dt) for 0 <= m <= M (zero for m < m0)
+        std::vector<double> samples;     //!< Values of the history at instants k*dt, k varying from first_index to first_index+samples.size()-1
+        long first_index;                //!< Index of the instant of samples[0]
+};
+
+#endif /* FIXEDLAGCONVOLUTION_HPP_ */
@@ -12,8 +12,10 @@
 #include <sstream>
 #include <vector>
 
-/** \brief
- *  \details
+/** \brief Stores the (t, value) pairs of a state over a sliding time window of length Tmax
+ *  \details The values are kept in a circular buffer: recording a new value &
+ *           forgetting those older than Tmax are O(1) operations & no memory
+ *           is allocated once the buffer holds a full time window.
  *  \addtogroup hdb_interpolators
  *  \ingroup hdb_interpolators
  *  \section ex1 Example
@@ -71,8 +73,14 @@ class History
         std::pair<double,double> operator[](const int index) const;
         friend std::ostream& operator<<(std::ostream& os, const History& h);
 
+        /**  \brief Forgets all recorded values (but keeps the allocated memory)
+          */
         void reset();
 
+        /**  \brief Preallocates memory for at least n values
+          */
+        void reserve(const size_t n);
+
         bool is_empty() const;
 
         std::vector<double> get_values(const double tmax) const;
@@ -93,9 +101,19 @@ class History
         double trapeze(const double xa, const double ya, const double xb, const double yb) const;
         double integrate(const size_t idx) const;
         void check_if_average_can_be_retrieved(const double T) const;
+        const TimeValue& at(const size_t i) const;
+        TimeValue& at(const size_t i);
+        const TimeValue& front() const;
+        const TimeValue& back() const;
+        void push_back(const TimeValue& value);
+        void push_front(const TimeValue& value);
+        void pop_front(const size_t n);
+        void grow();
 
         double Tmax;
-        Container L;
+        Container L;                    //!< Circular buffer: L.size() is the capacity, not the number of recorded values
+        size_t first;                   //!< Index (in L) of the oldest recorded value
+        size_t nb_of_values;            //!< Number of values currently stored in L
         double oldest_recorded_instant;
 
     public:
@@ -0,0 +1,85 @@
+/*
+ * RecursiveConvolution.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: cady
+ */
+
+#ifndef RECURSIVECONVOLUTION_HPP_
+#define RECURSIVECONVOLUTION_HPP_
+
+#include <complex>
+#include <functional>
+#include <vector>
+
+class History;
+
+/** \brief Computes the convolution of a retardation function with a state history in O(1) per time step
+ *  \details The retardation function K is approximated (once and for all, in the constructor) by a sum
+ *           of complex exponentials \f$K(\tau)\simeq\Re\left(\sum_k c_k e^{s_k(\tau-T_{\mbox{min}})}\right)\f$
+ *           using the matrix pencil method. The convolution
+ *           \f$\int_{T_{\mbox{min}}}^{\infty}K(\tau)\dot{X}(t-\tau)d\tau\f$ can then be written
+ *           \f$\Re\left(\sum_k c_k z_k(t-T_{\mbox{min}})\right)\f$, where \f$\dot{z}_k = s_k z_k + \dot{X}\f$.
+ *           Each z_k is updated incrementally (the state history being linearly interpolated between two
+ *           instants) so the cost of a call does not depend on the history length.
+ *           Contrary to RadiationDampingBuilder::convolution, the fitted kernel is integrated beyond Tmax:
+ *           Tmax should be chosen such that K has decayed.
+ *  \addtogroup hdb_interpolators
+ *  \ingroup hdb_interpolators
+ *  \section ex1 Example
+ *  \snippet hdb_interpolators/unit_tests/src/RecursiveConvolutionTest.cpp RecursiveConvolutionTest example
+ *  \section ex2 Expected output
+ *  \snippet hdb_interpolators/unit_tests/src/RecursiveConvolutionTest.cpp RecursiveConvolutionTest expected output
+ */
+class RecursiveConvolution
+{
+    public:
+        RecursiveConvolution(const std::function<double(double)>& K, //!< Retardation function
+                             const double Tmin,                      //!< Beginning of the convolution (because retardation function may not be defined for T=0)
+                             const double Tmax,                      //!< End of the interval on which K is fitted
+                             const size_t max_nb_of_exponentials,    //!< Maximum number of exponentials used to approximate K
+                             const size_t nb_of_samples = 200        //!< Number of (regularly spaced) values of K used for the fit
+                             );
+
+        /**  \brief Convolution of the fitted retardation function with the history, at the latest instant in the history
+          *  \details Returns zero if the history is shorter than Tmin (like RadiationDampingBuilder::convolution).
+          *           Only the samples recorded since the previous call are processed, unless the history
+          *           was reset or overwritten in which case the whole history is taken into account.
+          *  \returns \f$\int_{T_{\mbox{min}}}^{\infty} K(\tau)h(t-\tau)d\tau\f$
+          */
+        double operator()(const History& h);
+
+        /**  \brief Value of the sum of exponentials approximating K
+          */
+        double fitted_kernel(const double tau) const;
+
+        /**  \brief Relative RMS error between K & its approximation on [Tmin,Tmax]
+          */
+        double get_relative_fitting_error() const;
+
+        size_t get_nb_of_exponentials() const;
+
+    private:
+        RecursiveConvolution();
+        typedef std::complex<double> Complex;
+
+        void fit(const std::function<double(double)>& K, const size_t max_nb_of_exponentials, const size_t nb_of_samples);
+        void compute_fitting_error(const std::function<double(double)>& K, const size_t nb_of_samples);
+        bool committed_sample_is_still_in(const History& h, size_t& idx) const;
+        void restart_from(const History& h);
+        void advance(std::vector<Complex>& z, const double t0, const double v0, const double t1, const double v1) const;
+        double output(const std::vector<Complex>& z) const;
+
+        double Tmin;
+        double Tmax;
+        std::vector<Complex> s;                  //!< Poles
+        std::vector<Complex> c;                  //!< Residues
+        double relative_fitting_error;
+        std::vector<Complex> z_committed;        //!< States at instant t_committed (which will not be overwritten in the history)
+        std::vector<Complex> z;                  //!< Scratch states (avoids allocating at each call)
+        double t_committed;
+        double v_committed;
+        bool initialized;
+};
+
+#endif /* RECURSIVECONVOLUTION_HPP_ */
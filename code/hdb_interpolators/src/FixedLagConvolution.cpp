@@ -0,0 +1,141 @@
+/*
+ * FixedLagConvolution.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: cady
+ */
+
+#include <algorithm> // std::min, std::max
+#include <cmath>
+
+#include "FixedLagConvolution.hpp"
+#include "History.hpp"
+#include "InternalErrorException.hpp"
+#include "InvalidInputException.hpp"
+
+std::function<double(double)> sum_of(const std::vector<std::function<double(double)> >& Ks);
+std::function<double(double)> sum_of(const std::vector<std::function<double(double)> >& Ks)
+{
+    return [Ks](const double tau)
+           {
+               double ret = 0;
+               for (const auto& K:Ks) ret += K(tau);
+               return ret;
+           };
+}
+
+FixedLagConvolution::FixedLagConvolution(const std::vector<std::function<double(double)> >& Ks, //!< Retardation functions
+                                         const double Tmin_,                                     //!< Beginning of the convolution (because retardation functions may not be defined for T=0)
+                                         const double Tmax_,                                     //!< End of the convolution
+                                         const double dt_                                        //!< Step of the lag grid (should be the solver's time step)
+                                         ) :
+        FixedLagConvolution(sum_of(Ks), Tmin_, Tmax_, dt_)
+{
+}
+
+FixedLagConvolution::FixedLagConvolution(const std::function<double(double)>& K_, //!< Retardation function
+                                         const double Tmin_,                      //!< Beginning of the convolution (because retardation function may not be defined for T=0)
+                                         const double Tmax_,                      //!< End of the convolution
+                                         const double dt_                         //!< Step of the lag grid (should be the solver's time step)
+                                         ) :
+        K(K_),
+        Tmin(Tmin_),
+        Tmax(Tmax_),
+        dt(dt_),
+        m0(0),
+        M(0),
+        K_Tmin(0),
+        K_Tmax(0),
+        K_lags(),
+        samples(),
+        first_index(0)
+{
+    if (Tmax <= Tmin)
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "Tmax should be greater than Tmin, but got Tmin = " << Tmin << " and Tmax = " << Tmax);
+    }
+    if (not(dt > 0))
+    {
+        THROW(__PRETTY_FUNCTION__, InvalidInputException, "The time step of the streaming convolution should be strictly positive, but got " << dt << " s");
+    }
+    m0 = (long)std::ceil(Tmin/dt - 1E-9);
+    M = (long)std::floor(Tmax/dt + 1E-9);
+    K_Tmin = K(Tmin);
+    K_Tmax = K(Tmax);
+    K_lags.assign((size_t)M+1, 0);
+    for (long m = m0 ; m <= M ; ++m) K_lags[(size_t)m] = K((double)m*dt);
+}
+
+void FixedLagConvolution::sample_history(const History& h, const double t)
+{
+    const double eps = 1E-9*dt;
+    const long next = first_index + (long)samples.size();
+    const long oldest_in_history = (long)std::ceil((t - h.get_duration())/dt - 1E-9);
+    // The history was reset or rewound (only the latest instant in the history can be overwritten)
+    // or it was not sampled for longer than Tmax
+    if (samples.empty() or ((double)(next-1)*dt >= t - eps) or (next < oldest_in_history))
+    {
+        samples.clear();
+        first_index = std::max(oldest_in_history, (long)std::floor(t/dt + 1E-9) - M - 1);
+    }
+    for (long k = first_index + (long)samples.size() ; (double)k*dt < t - eps ; ++k)
+    {
+        samples.push_back(h(t - (double)k*dt));
+    }
+    // Instants older than the largest lag are forgotten: the buffer is compacted when half of it is obsolete,
+    // so it stays contiguous & no memory is allocated once it holds twice the largest lag
+    const long oldest_needed = (long)std::floor(t/dt + 1E-9) - M - 1;
+    const long nb_of_obsolete_samples = oldest_needed - first_index;
+    if ((nb_of_obsolete_samples > 0) and (2*(size_t)nb_of_obsolete_samples >= samples.size()))
+    {
+        samples.erase(samples.begin(), samples.begin() + nb_of_obsolete_samples);
+        first_index = oldest_needed;
+    }
+}
+
+double FixedLagConvolution::value_at_lag(const History& h, const long n, const double theta, const long m) const
+{
+    if (m == 0) return h(0);
+    const size_t j = (size_t)(n - m - first_index);
+    if (theta == 0) return samples[j];
+    return (1-theta)*samples[j] + theta*samples[j+1];
+}
+
+double FixedLagConvolution::operator()(const History& h)
+{
+    if (h.is_empty() or (h.get_duration() < Tmin)) return 0;
+    const double t = h.get_current_time();
+    sample_history(h, t);
+    // Integrate up to Tmax if possible, but never exceed the history length
+    const double U = std::min(Tmax, h.get_duration());
+    const double K_U = (U == Tmax) ? K_Tmax : K(U);
+    // t = (n+theta)*dt, so the state at t - m*dt is interpolated between instants (n-m)*dt & (n-m+1)*dt
+    const long n = (long)std::floor(t/dt + 1E-9);
+    const double theta = (t/dt - (double)n < 1E-9) ? 0 : t/dt - (double)n;
+    const long m1 = std::min((long)std::floor(U/dt + 1E-9), n - first_index);
+    if (m1 < m0)
+    {
+        return 0.5*(U-Tmin)*(K_Tmin*h(Tmin) + K_U*h(U));
+    }
+    // Trapezoidal rule on the lag grid, from m0*dt to m1*dt
+    const long m_start = std::max(m0, 1L);
+    double sum_n = 0;
+    double sum_n_plus_1 = 0;
+    const double* const k = K_lags.data();
+    const double* const s = samples.data() + (n - first_index); // s[-m] is the state at instant (n-m)*dt
+    for (long m = m_start ; m <= m1 ; ++m) sum_n += k[m]*s[-m];
+    if (theta > 0)
+    {
+        for (long m = m_start ; m <= m1 ; ++m) sum_n_plus_1 += k[m]*s[1-m];
+    }
+    double sum = (1-theta)*sum_n + theta*sum_n_plus_1;
+    if (m0 == 0) sum += k[0]*h(0);
+    const double v_m0 = value_at_lag(h, n, theta, m0);
+    const double v_m1 = value_at_lag(h, n, theta, m1);
+    double ret = dt*(sum - 0.5*(k[m0]*v_m0 + k[m1]*v_m1));
+    // Trapezoids between Tmin & the first lag & between the last lag & U
+    const double eps = 1E-9*dt;
+    if ((double)m0*dt - Tmin > eps) ret += 0.5*((double)m0*dt - Tmin)*(K_Tmin*h(Tmin) + k[m0]*v_m0);
+    if (U - (double)m1*dt > eps)    ret += 0.5*(U - (double)m1*dt)*(k[m1]*v_m1 + K_U*h(U));
+    return ret;
+}
@@ -7,6 +7,7 @@
 
 #include "History.hpp"
 #include "InternalErrorException.hpp"
+#include <algorithm> // std::max
 #include <cmath>
 #include <cstdint>
 #include <iterator>
@@ -43,8 +44,12 @@ bool almost_equal(const double a, const double b, const int maxUlpsDiff)
     return false;
 }
 
-History::History(const double Tmax_) : Tmax(Tmax_), L(), oldest_recorded_instant(0)
+#define INITIAL_CAPACITY 16
+
+History::History(const double Tmax_) : Tmax(Tmax_), L(), first(0), nb_of_values(0), oldest_recorded_instant(0)
 {
+    // When Tmax is zero, we never store more than the current value (plus the one being recorded)
+    reserve(Tmax > 0 ? INITIAL_CAPACITY : 2);
 }
 
 double get_tmax(const std::vector<std::pair<double,double> >& L);
@@ -54,10 +59,71 @@ double get_tmax(const std::vector<std::pair<double,double> >& L)
     return L.back().first - L.front().first;
 }
 
-History::History(const Container& L_) : Tmax(get_tmax(L_)), L(L_), oldest_recorded_instant(L.empty()?0:L.front().first)
+History::History(const Container& L_) : Tmax(get_tmax(L_)), L(L_), first(0), nb_of_values(L_.size()), oldest_recorded_instant(L_.empty()?0:L_.front().first)
 {
 }
 
+const History::TimeValue& History::at(const size_t i) const
+{
+    const size_t j = first + i;
+    return L[j < L.size() ? j : j - L.size()];
+}
+
+History::TimeValue& History::at(const size_t i)
+{
+    const size_t j = first + i;
+    return L[j < L.size() ? j : j - L.size()];
+}
+
+const History::TimeValue& History::front() const
+{
+    return L[first];
+}
+
+const History::TimeValue& History::back() const
+{
+    return at(nb_of_values-1);
+}
+
+void History::reserve(const size_t n)
+{
+    if (n <= L.size()) return;
+    Container new_L(n);
+    for (size_t i = 0 ; i < nb_of_values ; ++i)
+    {
+        new_L[i] = at(i);
+    }
+    L.swap(new_L);
+    first = 0;
+}
+
+void History::grow()
+{
+    reserve(std::max((size_t)2, 2*L.size()));
+}
+
+void History::push_back(const TimeValue& value)
+{
+    if (nb_of_values == L.size()) grow();
+    nb_of_values++;
+    at(nb_of_values-1) = value;
+}
+
+void History::push_front(const TimeValue& value)
+{
+    if (nb_of_values == L.size()) grow();
+    first = (first == 0) ? L.size() - 1 : first - 1;
+    nb_of_values++;
+    L[first] = value;
+}
+
+void History::pop_front(const size_t n)
+{
+    first += n;
+    if (first >= L.size()) first -= L.size();
+    nb_of_values -= n;
+}
+
 double History::operator()(double tau //!< How far back in history do we need to go (in seconds)?
                           ) const
 {
@@ -72,7 +138,7 @@ double History::operator()(double tau //!< How far back in history do we need to
         THROW(__PRETTY_FUNCTION__, InternalErrorException,
                 "Requesting value in the future: asked for t-tau with tau = " << tau);
     }
-    if (L.empty())
+    if (is_empty())
     {
         return 0;
     }
@@ -81,7 +147,7 @@ double History::operator()(double tau //!< How far back in history do we need to
 
 double History::get_current_time() const
 {
-    return L.empty() ? oldest_recorded_instant : L.back().first;
+    return is_empty() ? oldest_recorded_instant : back().first;
 }
 
 double History::get_value(const double tau) const
@@ -93,14 +159,14 @@ double History::get_value(const double tau) const
 
 double History::interpolate_value_in_interval(const size_t idx, const double t) const
 {
-    if ((idx == 0) or (idx >= L.size()))
+    if ((idx == 0) or (idx >= nb_of_values))
     {
-        return L[0].second;
+        return front().second;
     }
-    const double tA = L[idx-1].first;
-    const double tB = L[idx].first;
-    const double yA = L[idx-1].second;
-    const double yB = L[idx].second;
+    const double tA = at(idx-1).first;
+    const double tB = at(idx).first;
+    const double yA = at(idx-1).second;
+    const double yB = at(idx).second;
 
     if (std::abs(t-tA) < 1E-12)
     {
@@ -115,7 +181,7 @@ double History::interpolate_value_in_interval(const size_t idx, const double t)
 
 void History::throw_if_already_added(const size_t idx, const double t, const double val) const
 {
-    if ((idx != L.size()) and (L[idx].first == t) and (val != L[idx].second))
+    if ((idx != nb_of_values) and (at(idx).first == t) and (val != at(idx).second))
     {
         THROW(__PRETTY_FUNCTION__, InternalErrorException,
                 "Attempting to insert the same instant in History with different value: t = " << t << " already exists.");
@@ -124,18 +190,18 @@ void History::throw_if_already_added(const size_t idx, const double t, const dou
 
 size_t History::find_braketing_position(const double t) const
 {
-    if (L.empty())return 0;
-    if (L.back().first < t)           return L.size();
-    if (L.front().first >= t)         return 0;
+    if (is_empty())return 0;
+    if (back().first < t)             return nb_of_values;
+    if (front().first >= t)           return 0;
     size_t idx_lower = 0;
-    size_t idx_greater = L.size()-1;
+    size_t idx_greater = nb_of_values-1;
     while (true)
     {
-        if (t==L[idx_lower].first)
+        if (t==at(idx_lower).first)
         {
             return idx_lower;
         }
-        if (t==L[idx_greater].first)
+        if (t==at(idx_greater).first)
         {
             return idx_greater;
         }
@@ -144,7 +210,7 @@ size_t History::find_braketing_position(const double t) const
             return idx_greater;
         }
         const size_t idx_middle = (size_t)std::floor(((double)idx_lower+(double)idx_greater)/2.);
-        const auto middle = L[idx_middle];
+        const auto& middle = at(idx_middle);
         if (t==middle.first)
         {
             return idx_middle;
@@ -158,7 +224,7 @@ size_t History::find_braketing_position(const double t) const
             idx_lower = idx_middle;
         }
     }
-    return L.size();
+    return nb_of_values;
 }
 
 void History::shift_oldest_recorded_instant_if_necessary()
@@ -168,10 +234,10 @@ void History::shift_oldest_recorded_instant_if_necessary()
         oldest_recorded_instant = get_current_time()-Tmax;
         const double vmin = interpolate_value_in_interval(1, oldest_recorded_instant);
         const size_t idx = find_braketing_position(oldest_recorded_instant);
-        L.erase(L.begin(), L.begin() + (long) (idx));
-        if (not(almost_equal(L.front().first, oldest_recorded_instant,32)))
+        pop_front(idx);
+        if (not(almost_equal(front().first, oldest_recorded_instant,32)))
         {
-            L.insert(L.begin(), std::make_pair(oldest_recorded_instant, vmin));
+            push_front(std::make_pair(oldest_recorded_instant, vmin));
         }
     }
 }
@@ -179,19 +245,20 @@ void History::shift_oldest_recorded_instant_if_necessary()
 void History::add_value_to_history(const double t, const double val)
 {
     const size_t idx = find_braketing_position(t);
-    if ((idx != L.size()) and (almost_equal(L[idx].first, t)))
+    if ((idx != nb_of_values) and (almost_equal(at(idx).first, t)))
     {
-        L[idx] = std::make_pair(t, val);
+        at(idx) = std::make_pair(t, val);
     }
     else
     {
-        L.insert(L.begin() + (long) (idx), std::make_pair(t, val));
+        // record() only accepts increasing instants so we can only append
+        push_back(std::make_pair(t, val));
     }
 }
 
 void History::update_oldest_recorded_instant(const double t)
 {
-    if (L.empty()) oldest_recorded_instant = t;
+    if (is_empty()) oldest_recorded_instant = t;
     oldest_recorded_instant = std::min(oldest_recorded_instant, t);
 }
 
@@ -199,13 +266,13 @@ void History::record(double t, //!< Instant corresponding to the value being add
                      const double val //!< Value to add
                     )
 {
-    if (not(L.empty()))
+    if (not(is_empty()))
     {
-        if  (almost_equal(t,L.back().first))
+        if  (almost_equal(t,back().first))
         {
-            t = L.back().first;
+            t = back().first;
         }
-        if (t < L.back().first)
+        if (t < back().first)
         {
             THROW(__PRETTY_FUNCTION__
                  , InternalErrorException
@@ -213,9 +280,9 @@ void History::record(double t, //!< Instant corresponding to the value being add
                    << t
                    <<
                    ", but the latest timestamp in history is "
-                   << L.back().first
+                   << back().first
                    << " (t-thistory.back = "
-                    << t-L.back().first
+                    << t-back().first
                     << ")");
         }
     }
@@ -226,7 +293,7 @@ void History::record(double t, //!< Instant corresponding to the value being add
 
 size_t History::size() const
 {
-    return L.size();
+    return nb_of_values;
 }
 
 double History::get_Tmax() const
@@ -236,18 +303,18 @@ double History::get_Tmax() const
 
 double History::get_duration() const
 {
-    if (L.empty()) return 0;
-    return L.back().first - L.front().first;
+    if (is_empty()) return 0;
+    return back().first - front().first;
 }
 
 std::ostream& operator<<(std::ostream& os, const History& h)
 {
     os << "[";
-    for (size_t i = 0 ; i < h.L.size() -1 ; ++i)
+    for (size_t i = 0 ; i+1 < h.size() ; ++i)
     {
-        os << "(" << h.L.at(i).first << "," << h.L.at(i).second << "), ";
+        os << "(" << h.at(i).first << "," << h.at(i).second << "), ";
     }
-    if (not(h.L.empty())) os << "(" << h.L.back().first << "," << h.L.back().second << ")";
+    if (not(h.is_empty())) os << "(" << h.back().first << "," << h.back().second << ")";
     os << "]";
     return os;
 }
@@ -260,9 +327,9 @@ double History::trapeze(const double xa, const double ya, const double xb, const
 double History::integrate(const size_t idx) const
 {
     double ret = 0;
-    for (size_t i = idx ; i < L.size()-1 ; ++i)
+    for (size_t i = idx ; i < nb_of_values-1 ; ++i)
     {
-        ret += trapeze(L.at(i).first, L.at(i).second, L.at(i+1).first, L.at(i+1).second);
+        ret += trapeze(at(i).first, at(i).second, at(i+1).first, at(i+1).second);
     }
     return ret;
 }
@@ -279,39 +346,40 @@ void History::check_if_average_can_be_retrieved(const double T) const
 
 double History::average(double T) const
 {
-    if (L.empty()) return 0;
-    if (L.size()==1) return L.front().second;
+    if (is_empty()) return 0;
+    if (nb_of_values==1) return front().second;
     check_if_average_can_be_retrieved(T);
     T = std::min(T, get_duration());
     const double t = get_current_time() - T;
     const size_t idx = find_braketing_position(t);
     const double first_value = interpolate_value_in_interval(idx, t);
-    const double integral_of_first_interval = trapeze(t, first_value, L.at(idx).first, L.at(idx).second);
+    const double integral_of_first_interval = trapeze(t, first_value, at(idx).first, at(idx).second);
     const double integral_from_t_to_now = integrate(idx);
-    return  (T!=0) ? (integral_of_first_interval + integral_from_t_to_now)/T : L.back().second;
+    return  (T!=0) ? (integral_of_first_interval + integral_from_t_to_now)/T : back().second;
 }
 
 std::pair<double,double> History::operator[](const int index) const
 {
     if(index>=0)
     {
-        return L[(size_t)index];
+        return at((size_t)index);
     }
     else
     {
-        return L[L.size()+(size_t)index];
+        return at(nb_of_values+(size_t)index);
     }
 }
 
 void History::reset()
 {
-    L.clear();
+    first = 0;
+    nb_of_values = 0;
     oldest_recorded_instant = 0;
 }
 
 bool History::is_empty() const
 {
-    return L.size() == 0;
+    return nb_of_values == 0;
 }
 
 std::vector<double> History::get_values(const double tmax) const
@@ -321,13 +389,13 @@ std::vector<double> History::get_values(const double tmax) const
         return {this->operator()(0)};
     }
     std::vector<double> ret;
-    ret.reserve(L.size());
+    ret.reserve(nb_of_values);
     const double t = get_current_time();
-    for (size_t i = 0 ; i < L.size() ; ++i)
+    for (size_t i = 0 ; i < nb_of_values ; ++i)
     {
-        if (tmax >= t - L[i].first)
+        if (tmax >= t - at(i).first)
         {
-            ret.push_back(L[i].second);
+            ret.push_back(at(i).second);
         }
     }
     return ret;
@@ -341,13 +409,13 @@ std::vector<double> History::get_dates(const double tmax) const
         return {t};
     }
     std::vector<double> ret;
-    ret.reserve(L.size());
+    ret.reserve(nb_of_values);
 
-    for (size_t i = 0 ; i < L.size() ; ++i)
+    for (size_t i = 0 ; i < nb_of_values ; ++i)
     {
-        if (tmax >= t - L[i].first)
+        if (tmax >= t - at(i).first)
         {
-            ret.push_back(L[i].first);
+            ret.push_back(at(i).first);
         }
     }
     return ret;
@@ -0,0 +1,233 @@
+/*
+ * RecursiveConvolution.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: cady
+ */
+
+#include <algorithm> // std::min
+#include <cmath>
+
+#include <Eigen/Dense>
+#include <Eigen/Eigenvalues>
+
+#include "History.hpp"
+#include "InternalErrorException.hpp"
+#include "RecursiveConvolution.hpp"
+
+RecursiveConvolution::RecursiveConvolution(const std::function<double(double)>& K, //!< Retardation function
+                                           const double Tmin_,                     //!< Beginning of the convolution (because retardation function may not be defined for T=0)
+                                           const double Tmax_,                     //!< End of the interval on which K is fitted
+                                           const size_t max_nb_of_exponentials,    //!< Maximum number of exponentials used to approximate K
+                                           const size_t nb_of_samples              //!< Number of (regularly spaced) values of K used for the fit
+                                           ) :
+        Tmin(Tmin_),
+        Tmax(Tmax_),
+        s(),
+        c(),
+        relative_fitting_error(0),
+        z_committed(),
+        z(),
+        t_committed(0),
+        v_committed(0),
+        initialized(false)
+{
+    if (Tmax <= Tmin)
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "Tmax should be greater than Tmin, but got Tmin = " << Tmin << " and Tmax = " << Tmax);
+    }
+    if (nb_of_samples < 4)
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "At least four samples are needed to fit the retardation function, but got nb_of_samples = " << nb_of_samples);
+    }
+    fit(K, max_nb_of_exponentials, nb_of_samples);
+    compute_fitting_error(K, nb_of_samples);
+    z_committed.resize(s.size());
+    z.resize(s.size());
+}
+
+void RecursiveConvolution::fit(const std::function<double(double)>& K, const size_t max_nb_of_exponentials, const size_t nb_of_samples)
+{
+    const size_t M = nb_of_samples;
+    const double dt = (Tmax-Tmin)/((double)M-1);
+    Eigen::VectorXd y(M);
+    for (size_t i = 0 ; i < M ; ++i) y(i) = K(Tmin + (double)i*dt);
+    if (y.norm() == 0) return;
+
+    // Matrix pencil method: the right singular vectors of the Hankel matrix built from the samples
+    // are shift-invariant & the shift operator's eigenvalues are exp(s_k*dt)
+    const size_t L = M/2;
+    Eigen::MatrixXd Y(M-L, L+1);
+    for (size_t i = 0 ; i < M-L ; ++i)
+        for (size_t j = 0 ; j <= L ; ++j)
+            Y(i,j) = y(i+j);
+    const Eigen::JacobiSVD<Eigen::MatrixXd> svd(Y, Eigen::ComputeThinV);
+    const Eigen::VectorXd sigma = svd.singularValues();
+    size_t P = 0;
+    while ((P < (size_t)sigma.size()) and (P < max_nb_of_exponentials) and (sigma(P) > 1E-10*sigma(0))) P++;
+    if (P == 0) return;
+    const Eigen::MatrixXd V = svd.matrixV().leftCols(P);
+    const Eigen::MatrixXd V1 = V.topRows(L);
+    const Eigen::MatrixXd V2 = V.bottomRows(L);
+    const Eigen::MatrixXd Phi = V1.jacobiSvd(Eigen::ComputeThinU | Eigen::ComputeThinV).solve(V2);
+    const Eigen::VectorXcd poles = Eigen::EigenSolver<Eigen::MatrixXd>(Phi, false).eigenvalues();
+
+    // Retardation functions decay: unstable poles (which can appear when K is noisy) are pulled back
+    // so that exp(s*(Tmax-Tmin)) = exp(-1)
+    const double max_modulus = std::exp(-dt/(Tmax-Tmin));
+    Eigen::MatrixXcd A(M, P);
+    s.resize(P);
+    for (size_t k = 0 ; k < P ; ++k)
+    {
+        Complex zk = poles(k);
+        if (std::abs(zk) >= 1) zk *= max_modulus/std::abs(zk);
+        if (std::abs(zk) < 1E-300) zk = 1E-300;
+        s[k] = std::log(zk)/dt;
+        Complex zk_pow_i = 1;
+        for (size_t i = 0 ; i < M ; ++i)
+        {
+            A(i,k) = zk_pow_i;
+            zk_pow_i *= zk;
+        }
+    }
+    // Residues are obtained by least-squares
+    const Eigen::VectorXcd residues = A.colPivHouseholderQr().solve(y.cast<Complex>());
+    c.resize(P);
+    for (size_t k = 0 ; k < P ; ++k) c[k] = residues(k);
+}
+
+double RecursiveConvolution::fitted_kernel(const double tau) const
+{
+    Complex ret = 0;
+    for (size_t k = 0 ; k < s.size() ; ++k) ret += c[k]*std::exp(s[k]*(tau-Tmin));
+    return ret.real();
+}
+
+void RecursiveConvolution::compute_fitting_error(const std::function<double(double)>& K, const size_t nb_of_samples)
+{
+    // Twice as many points as for the fit, to also check the values in between
+    const size_t n = 2*nb_of_samples-1;
+    double sum_of_squared_errors = 0;
+    double sum_of_squares = 0;
+    for (size_t i = 0 ; i < n ; ++i)
+    {
+        const double tau = Tmin + (Tmax-Tmin)*(double)i/((double)n-1);
+        const double k = K(tau);
+        const double err = k - fitted_kernel(tau);
+        sum_of_squared_errors += err*err;
+        sum_of_squares += k*k;
+    }
+    relative_fitting_error = (sum_of_squares > 0) ? std::sqrt(sum_of_squared_errors/sum_of_squares) : 0;
+}
+
+double RecursiveConvolution::get_relative_fitting_error() const
+{
+    return relative_fitting_error;
+}
+
+size_t RecursiveConvolution::get_nb_of_exponentials() const
+{
+    return s.size();
+}
+
+#define N_SERIES 8
+void RecursiveConvolution::advance(std::vector<Complex>& z_, const double t0, const double v0, const double t1, const double v1) const
+{
+    // Exact integration of dz/dt = s*z + v between t0 & t1, v being linear between (t0,v0) & (t1,v1):
+    // z(t1) = exp(s*dt)*z(t0) + dt*(phi1-phi2)*v0 + dt*phi2*v1
+    // with phi1 = (exp(x)-1)/x & phi2 = (exp(x)-1-x)/x^2 (x=s*dt)
+    const double dt = t1-t0;
+    if (dt <= 0) return;
+    for (size_t k = 0 ; k < s.size() ; ++k)
+    {
+        const Complex x = s[k]*dt;
+        const Complex E = std::exp(x);
+        Complex phi1, phi2;
+        if (std::abs(x) < 1E-2)
+        {
+            // Taylor series, to avoid cancellation errors
+            phi1 = 0;
+            phi2 = 0;
+            Complex xn = 1;
+            double factorial = 1;
+            for (size_t n = 0 ; n < N_SERIES ; ++n)
+            {
+                factorial *= (double)(n+1);
+                phi1 += xn/factorial;
+                phi2 += xn/(factorial*(double)(n+2));
+                xn *= x;
+            }
+        }
+        else
+        {
+            phi1 = (E-1.)/x;
+            phi2 = (E-1.-x)/(x*x);
+        }
+        z_[k] = E*z_[k] + dt*((phi1-phi2)*v0 + phi2*v1);
+    }
+}
+
+double RecursiveConvolution::output(const std::vector<Complex>& z_) const
+{
+    Complex ret = 0;
+    for (size_t k = 0 ; k < s.size() ; ++k) ret += c[k]*z_[k];
+    return ret.real();
+}
+
+bool RecursiveConvolution::committed_sample_is_still_in(const History& h, size_t& idx) const
+{
+    // The committed sample is usually very close to the end of the history
+    for (size_t i = h.size() ; i > 0 ; --i)
+    {
+        const auto sample = h[(int)i-1];
+        if (sample.first <= t_committed)
+        {
+            idx = i-1;
+            return (sample.first == t_committed) and (sample.second == v_committed);
+        }
+    }
+    return false;
+}
+
+void RecursiveConvolution::restart_from(const History& h)
+{
+    std::fill(z_committed.begin(), z_committed.end(), Complex(0));
+    t_committed = h[0].first;
+    v_committed = h[0].second;
+    initialized = true;
+}
+
+double RecursiveConvolution::operator()(const History& h)
+{
+    if (s.empty() or h.is_empty()) return 0;
+    size_t idx = 0;
+    if (not(initialized) or not(committed_sample_is_still_in(h, idx)))
+    {
+        restart_from(h);
+        idx = 0;
+    }
+    // The state history is (t-Tmin)-delayed
+    const double t = h.get_current_time() - Tmin;
+    // Only the latest sample in the history can be overwritten: all previous ones can be committed
+    const size_t n = h.size();
+    for (++idx ; (idx+1 < n) and (h[(int)idx].first <= t) ; ++idx)
+    {
+        const auto sample = h[(int)idx];
+        advance(z_committed, t_committed, v_committed, sample.first, sample.second);
+        t_committed = sample.first;
+        v_committed = sample.second;
+    }
+    if (h.get_duration() < Tmin) return 0;
+    z = z_committed;
+    double t0 = t_committed;
+    double v0 = v_committed;
+    for ( ; (idx < n) and (h[(int)idx].first < t) ; ++idx)
+    {
+        const auto sample = h[(int)idx];
+        advance(z, t0, v0, sample.first, sample.second);
+        t0 = sample.first;
+        v0 = sample.second;
+    }
+    advance(z, t0, v0, t, h(Tmin));
+    return output(z);
+}
@@ -0,0 +1,25 @@
+/*
+ * FixedLagConvolutionTest.hpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: cady
+ */
+
+
+#ifndef FIXEDLAGCONVOLUTIONTEST_HPP_
+#define FIXEDLAGCONVOLUTIONTEST_HPP_
+
+#include "gtest/gtest.h"
+#include <ssc/random_data_generator/DataGenerator.hpp>
+
+class FixedLagConvolutionTest : public ::testing::Test
+{
+    protected:
+        FixedLagConvolutionTest();
+        virtual ~FixedLagConvolutionTest();
+        virtual void SetUp();
+        virtual void TearDown();
+        ssc::random_data_generator::DataGenerator a;
+};
+
+#endif  /* FIXEDLAGCONVOLUTIONTEST_HPP_ */
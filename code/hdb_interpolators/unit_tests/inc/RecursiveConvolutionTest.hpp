@@ -0,0 +1,25 @@
+/*
+ * RecursiveConvolutionTest.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: cady
+ */
+
+
+#ifndef RECURSIVECONVOLUTIONTEST_HPP_
+#define RECURSIVECONVOLUTIONTEST_HPP_
+
+#include "gtest/gtest.h"
+#include <ssc/random_data_generator/DataGenerator.hpp>
+
+class RecursiveConvolutionTest : public ::testing::Test
+{
+    protected:
+        RecursiveConvolutionTest();
+        virtual ~RecursiveConvolutionTest();
+        virtual void SetUp();
+        virtual void TearDown();
+        ssc::random_data_generator::DataGenerator a;
+};
+
+#endif  /* RECURSIVECONVOLUTIONTEST_HPP_ */
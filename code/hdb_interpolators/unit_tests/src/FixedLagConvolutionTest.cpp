@@ -0,0 +1,140 @@
+/*
+ * FixedLagConvolutionTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: cady
+ */
+
+#include "hdb_data.hpp"
+#include "hdb_test.hpp"
+#include "FixedLagConvolution.hpp"
+#include "FixedLagConvolutionTest.hpp"
+#include "History.hpp"
+#include "InvalidInputException.hpp"
+#include "RadiationDampingBuilder.hpp"
+
+#define _USE_MATH_DEFINE
+#include <cmath>
+#define PI M_PI
+
+FixedLagConvolutionTest::FixedLagConvolutionTest() : a(ssc::random_data_generator::DataGenerator(87122))
+{
+}
+
+FixedLagConvolutionTest::~FixedLagConvolutionTest()
+{
+}
+
+void FixedLagConvolutionTest::SetUp()
+{
+}
+
+void FixedLagConvolutionTest::TearDown()
+{
+}
+
+double fixed_lag_velocity(const double t);
+double fixed_lag_velocity(const double t)
+{
+    return sin(0.7*t) + 0.3*cos(1.9*t);
+}
+
+TEST_F(FixedLagConvolutionTest, example)
+{
+//! [FixedLagConvolutionTest example]
+    const double Tmin = 0.2;
+    const double Tmax = 20;
+    const double dt = 0.05;
+    FixedLagConvolution convolution(test_data::analytical_K, Tmin, Tmax, dt);
+    History h(Tmax);
+    for (size_t i = 0 ; i <= 1000 ; ++i)
+    {
+        h.record(dt*(double)i, fixed_lag_velocity(dt*(double)i));
+        convolution(h);
+    }
+//! [FixedLagConvolutionTest example]
+//! [FixedLagConvolutionTest expected output]
+    RadiationDampingBuilder builder(TypeOfQuadrature::GAUSS_KRONROD, TypeOfQuadrature::GAUSS_KRONROD);
+    ASSERT_NEAR(builder.convolution(h, test_data::analytical_K, Tmin, Tmax), convolution(h), 1E-2);
+//! [FixedLagConvolutionTest expected output]
+}
+
+TEST_F(FixedLagConvolutionTest, should_match_quadrature_at_intermediate_instants_for_several_tau_max)
+{
+    RadiationDampingBuilder builder(TypeOfQuadrature::GAUSS_KRONROD, TypeOfQuadrature::GAUSS_KRONROD);
+    const double dt = 0.05;
+    for (const double Tmax:{5., 20., 60.})
+    {
+        FixedLagConvolution convolution(test_data::analytical_K, 0.2, Tmax, dt);
+        History h(Tmax);
+        for (size_t i = 0 ; i < 3000 ; ++i)
+        {
+            // Instants of a Runge-Kutta solver (the middle of each step is recorded twice)
+            for (const double t:{dt*(double)i, dt*((double)i+0.5), dt*((double)i+0.5)})
+            {
+                h.record(t, fixed_lag_velocity(t));
+                const double streamed = convolution(h);
+                if (i % 250 == 249)
+                {
+                    ASSERT_NEAR(builder.convolution(h, test_data::analytical_K, 0.2, std::min(Tmax, h.get_duration())), streamed, 1E-2) << "Tmax = " << Tmax << ", t = " << t;
+                }
+            }
+        }
+    }
+}
+
+TEST_F(FixedLagConvolutionTest, is_exact_for_a_constant_kernel_and_a_linear_state)
+{
+    const double Tmin = 0.13;
+    const double Tmax = 3.07;
+    FixedLagConvolution convolution([](const double){return 1.;}, Tmin, Tmax, 0.1);
+    History h(10);
+    for (size_t i = 0 ; i < 200 ; ++i)
+    {
+        // Not all instants are on the lag grid
+        const double t = 0.1*(double)i + 0.03*(double)(i%3);
+        h.record(t, 2*t+1);
+        const double U = std::min(Tmax, h.get_duration());
+        const double expected = (h.get_duration() < Tmin) ? 0 : (2*t+1)*(U-Tmin) - (U*U-Tmin*Tmin);
+        ASSERT_NEAR(expected, convolution(h), 1E-10) << "t = " << t;
+    }
+}
+
+TEST_F(FixedLagConvolutionTest, history_can_be_reset)
+{
+    FixedLagConvolution convolution(test_data::analytical_K, 0.2, 10, 0.1);
+    History h(10);
+    for (size_t i = 0 ; i <= 200 ; ++i) h.record(0.1*(double)i, fixed_lag_velocity(0.1*(double)i));
+    const double expected = convolution(h);
+    h.reset();
+    for (size_t i = 0 ; i <= 100 ; ++i) h.record(0.1*(double)i, 1);
+    convolution(h);
+    h.reset();
+    for (size_t i = 0 ; i <= 200 ; ++i) h.record(0.1*(double)i, fixed_lag_velocity(0.1*(double)i));
+    ASSERT_NEAR(expected, convolution(h), 1E-12);
+}
+
+TEST_F(FixedLagConvolutionTest, time_step_should_be_strictly_positive)
+{
+    ASSERT_THROW(FixedLagConvolution(test_data::analytical_K, 0.2, 10, 0), InvalidInputException);
+    ASSERT_THROW(FixedLagConvolution(test_data::analytical_K, 0.2, 10, -0.1), InvalidInputException);
+}
+
+TEST_F(FixedLagConvolutionTest, several_kernels_share_the_same_sampled_history)
+{
+    const std::function<double(double)> K1 = test_data::analytical_K;
+    const std::function<double(double)> K2 = [](const double tau){return exp(-tau)*cos(2*tau);};
+    const double dt = 0.05;
+    FixedLagConvolution convolution1(K1, 0.2, 10, dt);
+    FixedLagConvolution convolution2(K2, 0.2, 10, dt);
+    FixedLagConvolution convolution12({K1, K2}, 0.2, 10, dt);
+    History h(10);
+    for (size_t i = 0 ; i < 500 ; ++i)
+    {
+        for (const double t:{dt*(double)i, dt*((double)i+0.5)})
+        {
+            h.record(t, fixed_lag_velocity(t));
+            ASSERT_NEAR(convolution1(h) + convolution2(h), convolution12(h), 1E-10) << "t = " << t;
+        }
+    }
+}
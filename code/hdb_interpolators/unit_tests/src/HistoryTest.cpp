@@ -6,7 +6,10 @@
  */
 
 #include <algorithm>    // std::transform
+#include <cmath>
 #include <numeric>      // std::partial_sum
+#include <utility>
+#include <vector>
 
 #include "History.hpp"
 #include "HistoryTest.hpp"
@@ -380,3 +383,185 @@ TEST_F(HistoryTest, can_get_list_of_values)
         }
     }
 }
+
+TEST_F(HistoryTest, values_are_still_correct_once_the_circular_buffer_has_wrapped_around)
+{
+    History h(2);
+    for (size_t i = 0 ; i <= 1000 ; ++i)
+    {
+        h.record(0.5*(double)i, (double)i);
+    }
+    ASSERT_EQ(5, h.size());
+    ASSERT_DOUBLE_EQ(1000, h(0));
+    ASSERT_DOUBLE_EQ(999, h(0.5));
+    ASSERT_DOUBLE_EQ(997, h(1.5));
+    ASSERT_DOUBLE_EQ(996.5, h(1.75));
+    ASSERT_DOUBLE_EQ(996, h(2));
+    ASSERT_DOUBLE_EQ(998, h.average(2));
+    ASSERT_DOUBLE_EQ(996, h[0].second);
+    ASSERT_DOUBLE_EQ(1000, h[-1].second);
+}
+
+TEST_F(HistoryTest, reset_history_can_be_recorded_again)
+{
+    History h(1);
+    for (size_t i = 0 ; i < 100 ; ++i) h.record(0.1*(double)i, (double)i);
+    h.reset();
+    ASSERT_TRUE(h.is_empty());
+    h.record(3, 4);
+    h.record(4, 6);
+    ASSERT_EQ(2, h.size());
+    ASSERT_DOUBLE_EQ(5, h(0.5));
+}
+
+bool almost_equal(const double a, const double b, const int maxUlpsDiff); // Defined in History.cpp
+
+/** \brief Previous implementation of History (samples stored in a std::vector, the oldest ones erased from its front)
+ *  \details Only used as a reference, to check the circular buffer gives the same results.
+ */
+class VectorHistory
+{
+    public:
+        VectorHistory(const double Tmax_) : Tmax(Tmax_), L(), oldest_recorded_instant(0)
+        {
+        }
+
+        double operator()(double tau) const
+        {
+            if (std::abs(tau-Tmax)<1E-12) tau = Tmax;
+            if (tau>Tmax) return 0;
+            if (L.empty()) return 0;
+            const double t = get_current_time()-tau;
+            return interpolate_value_in_interval(find_braketing_position(t), t);
+        }
+
+        double average(double T) const
+        {
+            if (L.empty()) return 0;
+            if (L.size()==1) return L.front().second;
+            T = std::min(T, L.back().first - L.front().first);
+            const double t = get_current_time() - T;
+            const size_t idx = find_braketing_position(t);
+            const double first_value = interpolate_value_in_interval(idx, t);
+            double integral = 0;
+            for (size_t i = idx ; i < L.size()-1 ; ++i) integral += trapeze(L[i].first, L[i].second, L[i+1].first, L[i+1].second);
+            return (T!=0) ? (trapeze(t, first_value, L[idx].first, L[idx].second) + integral)/T : L.back().second;
+        }
+
+        void record(double t, const double val)
+        {
+            if (not(L.empty()) and almost_equal(t, L.back().first, 4)) t = L.back().first;
+            if (L.empty()) oldest_recorded_instant = t;
+            oldest_recorded_instant = std::min(oldest_recorded_instant, t);
+            const size_t idx = find_braketing_position(t);
+            if ((idx != L.size()) and (almost_equal(L[idx].first, t, 4))) L[idx] = std::make_pair(t, val);
+            else                                                          L.insert(L.begin() + (long) (idx), std::make_pair(t, val));
+            if (get_current_time() - oldest_recorded_instant >= Tmax)
+            {
+                oldest_recorded_instant = get_current_time()-Tmax;
+                const double vmin = interpolate_value_in_interval(1, oldest_recorded_instant);
+                L.erase(L.begin(), L.begin() + (long) (find_braketing_position(oldest_recorded_instant)));
+                if (not(almost_equal(L.front().first, oldest_recorded_instant, 32))) L.insert(L.begin(), std::make_pair(oldest_recorded_instant, vmin));
+            }
+        }
+
+        void reset()
+        {
+            L.clear();
+            oldest_recorded_instant = 0;
+        }
+
+        std::vector<std::pair<double,double> > get_samples() const
+        {
+            return L;
+        }
+
+    private:
+        VectorHistory(); // Disabled
+
+        double get_current_time() const
+        {
+            return L.empty() ? oldest_recorded_instant : L.back().first;
+        }
+
+        double trapeze(const double xa, const double ya, const double xb, const double yb) const
+        {
+            return (xb-xa)*(ya+yb)/2.;
+        }
+
+        double interpolate_value_in_interval(const size_t idx, const double t) const
+        {
+            if ((idx == 0) or (idx >= L.size())) return L[0].second;
+            const double tA = L[idx-1].first;
+            const double tB = L[idx].first;
+            const double yA = L[idx-1].second;
+            const double yB = L[idx].second;
+            if (std::abs(t-tA) < 1E-12) return yA;
+            if (std::abs(t-tB) < 1E-12) return yB;
+            return (t-tA)/(tB-tA)*(yB-yA) + yA;
+        }
+
+        size_t find_braketing_position(const double t) const
+        {
+            if (L.empty())            return 0;
+            if (L.back().first < t)   return L.size();
+            if (L.front().first >= t) return 0;
+            size_t idx_lower = 0;
+            size_t idx_greater = L.size()-1;
+            while (true)
+            {
+                if (t==L[idx_lower].first)         return idx_lower;
+                if (t==L[idx_greater].first)       return idx_greater;
+                if (idx_greater<=idx_lower+1)      return idx_greater;
+                const size_t idx_middle = (size_t)std::floor(((double)idx_lower+(double)idx_greater)/2.);
+                if (t==L[idx_middle].first)        return idx_middle;
+                if (t < L[idx_middle].first) idx_greater = idx_middle;
+                else                         idx_lower = idx_middle;
+            }
+            return L.size();
+        }
+
+        double Tmax;
+        std::vector<std::pair<double,double> > L;
+        double oldest_recorded_instant;
+};
+
+TEST_F(HistoryTest, circular_buffer_should_give_the_same_results_as_the_previous_implementation)
+{
+    for (size_t k = 0 ; k < 20 ; ++k)
+    {
+        // Tmax = 0 keeps a single value, small Tmax make the buffer wrap around & evict at each step
+        const double Tmax = (k == 0) ? 0 : a.random<double>().between(0.1, 5);
+        History h(Tmax);
+        VectorHistory reference(Tmax);
+        double t = a.random<double>().between(-10, 10);
+        for (size_t i = 0 ; i < 500 ; ++i)
+        {
+            if (i == 250)
+            {
+                h.reset();
+                reference.reset();
+            }
+            const double val = a.random<double>().between(-100, 100);
+            // Sometimes record the same instant twice (the value is then replaced)
+            if (a.random<double>().between(0, 1) < 0.8) t += a.random<double>().between(1E-3, Tmax > 0 ? Tmax/3 : 1);
+            h.record(t, val);
+            reference.record(t, val);
+            const auto samples = reference.get_samples();
+            ASSERT_EQ(samples.size(), h.size());
+            for (size_t j = 0 ; j < samples.size() ; ++j)
+            {
+                ASSERT_EQ(samples[j].first, h[(int)j].first);
+                ASSERT_EQ(samples[j].second, h[(int)j].second);
+            }
+            for (size_t j = 0 ; j < 10 ; ++j)
+            {
+                const double tau = a.random<double>().between(0, 1.2*Tmax+0.1);
+                ASSERT_EQ(reference(tau), h(tau)) << "tau = " << tau;
+                const double T = a.random<double>().between(0, 1.5*Tmax+0.1);
+                ASSERT_EQ(reference.average(T), h.average(T)) << "T = " << T;
+            }
+            ASSERT_EQ(reference(Tmax), h(Tmax));
+        }
+    }
+}
@@ -0,0 +1,138 @@
+/*
+ * RecursiveConvolutionTest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: cady
+ */
+
+#include "hdb_data.hpp"
+#include "hdb_test.hpp"
+#include "History.hpp"
+#include "RadiationDampingBuilder.hpp"
+#include "RecursiveConvolution.hpp"
+#include "RecursiveConvolutionTest.hpp"
+
+#define _USE_MATH_DEFINE
+#include <cmath>
+#define PI M_PI
+
+#define EPS (1E-10)
+
+RecursiveConvolutionTest::RecursiveConvolutionTest() : a(ssc::random_data_generator::DataGenerator(8712))
+{
+}
+
+RecursiveConvolutionTest::~RecursiveConvolutionTest()
+{
+}
+
+void RecursiveConvolutionTest::SetUp()
+{
+}
+
+void RecursiveConvolutionTest::TearDown()
+{
+}
+
+double velocity(const double t);
+double velocity(const double t)
+{
+    return sin(0.7*t) + 0.3*cos(1.9*t);
+}
+
+TEST_F(RecursiveConvolutionTest, example)
+{
+//! [RecursiveConvolutionTest example]
+    const double Tmin = 0.2;
+    const double Tmax = 60;
+    RecursiveConvolution convolution(test_data::analytical_K, Tmin, Tmax, 20);
+    History h(Tmax);
+    for (size_t i = 0 ; i <= 1000 ; ++i)
+    {
+        h.record(0.01*(double)i, velocity(0.01*(double)i));
+        convolution(h);
+    }
+//! [RecursiveConvolutionTest example]
+//! [RecursiveConvolutionTest expected output]
+    RadiationDampingBuilder builder(TypeOfQuadrature::GAUSS_KRONROD, TypeOfQuadrature::GAUSS_KRONROD);
+    ASSERT_NEAR(builder.convolution(h, test_data::analytical_K, Tmin, h.get_duration()), convolution(h), 1E-2);
+//! [RecursiveConvolutionTest expected output]
+}
+
+TEST_F(RecursiveConvolutionTest, a_damped_cosine_is_fitted_exactly_by_two_exponentials)
+{
+    const RecursiveConvolution convolution(test_data::analytical_K, 0.2, 10, 20);
+    ASSERT_EQ(2, convolution.get_nb_of_exponentials());
+    ASSERT_LT(convolution.get_relative_fitting_error(), 1E-8);
+    for (size_t i = 0 ; i < 100 ; ++i)
+    {
+        const double tau = a.random<double>().between(0.2, 10);
+        ASSERT_NEAR(test_data::analytical_K(tau), convolution.fitted_kernel(tau), 1E-8) << "tau = " << tau;
+    }
+}
+
+TEST_F(RecursiveConvolutionTest, can_fit_interpolated_retardation_function)
+{
+    const auto K = get_interpolated_K();
+    const RecursiveConvolution convolution(K, 2*PI/30, 10, 20);
+    ASSERT_LT(convolution.get_relative_fitting_error(), 1E-2);
+}
+
+TEST_F(RecursiveConvolutionTest, convolution_of_a_zero_retardation_function_is_zero)
+{
+    RecursiveConvolution convolution([](const double){return 0;}, 0.2, 10, 20);
+    ASSERT_EQ(0, convolution.get_nb_of_exponentials());
+    History h(10);
+    h.record(0, 1);
+    h.record(10, 1);
+    ASSERT_EQ(0, convolution(h));
+}
+
+TEST_F(RecursiveConvolutionTest, convolution_is_zero_if_history_is_shorter_than_Tmin)
+{
+    RecursiveConvolution convolution(test_data::analytical_K, 0.2, 10, 20);
+    History h(10);
+    h.record(0, 1);
+    h.record(0.1, 1);
+    ASSERT_EQ(0, convolution(h));
+}
+
+TEST_F(RecursiveConvolutionTest, overwriting_latest_value_in_history_gives_same_result_as_fresh_computation)
+{
+    const double Tmin = 0.2;
+    const double Tmax = 30;
+    RecursiveConvolution convolution(test_data::analytical_K, Tmin, Tmax, 20);
+    History h(Tmax);
+    const double dt = 0.05;
+    for (size_t i = 0 ; i < 400 ; ++i)
+    {
+        // Same pattern as a Runge-Kutta 4 solver: intermediate instant is overwritten
+        const double t = dt*(double)i;
+        h.record(t, velocity(t));
+        const double val = convolution(h);
+        ASSERT_NEAR(RecursiveConvolution(test_data::analytical_K, Tmin, Tmax, 20)(h), val, 1E-9) << "t = " << t;
+        h.record(t+dt/2, a.random<double>().between(-1,1));
+        convolution(h);
+        h.record(t+dt/2, velocity(t+dt/2));
+        convolution(h);
+    }
+}
+
+TEST_F(RecursiveConvolutionTest, restarts_when_history_is_reset)
+{
+    const double Tmin = 0.2;
+    const double Tmax = 30;
+    RecursiveConvolution convolution(test_data::analytical_K, Tmin, Tmax, 20);
+    History h(Tmax);
+    for (size_t i = 0 ; i < 100 ; ++i)
+    {
+        h.record(0.1*(double)i, velocity(0.1*(double)i));
+        convolution(h);
+    }
+    h.reset();
+    for (size_t i = 0 ; i < 30 ; ++i)
+    {
+        h.record(20+0.1*(double)i, 1);
+    }
+    ASSERT_NEAR(RecursiveConvolution(test_data::analytical_K, Tmin, Tmax, 20)(h), convolution(h), EPS);
+}
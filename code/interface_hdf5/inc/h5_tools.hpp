@@ -56,6 +56,50 @@ namespace H5_Tools
             const H5::H5File& file, const std::string& datasetName,
             const H5::DataType& datasetType, const H5::DataSpace& space);
 
+    /**
+     * \brief creates a dataset with a given creation property list (eg. to
+     *        set the chunk size or enable compression), if not existing.
+     *        Else, this function throws an exception
+     * \param[in] file HDF5 file descriptor
+     * \param[in] datasetName Location of the dataset. May contain /,
+     *                        indicating groups
+     * \param[in] datasetType dataset type
+     * \param[in] space dataset space
+     * \param[in] cparms dataset creation properties
+     * \return the dataset descriptor
+     */
+    H5::DataSet createDataSet(
+            const H5::H5File& file, const std::string& datasetName,
+            const H5::DataType& datasetType, const H5::DataSpace& space,
+            const H5::DSetCreatPropList& cparms);
+
+    /**
+     * \brief creates a one-dimensional, empty & extendible dataset, stored in
+     *        chunks of chunk_size values & optionally compressed
+     * \param[in] file HDF5 file descriptor
+     * \param[in] datasetName Location of the dataset. May contain /,
+     *                        indicating groups
+     * \param[in] datasetType dataset type
+     * \param[in] chunk_size Number of values in each chunk
+     * \param[in] compression_level Deflate level (0 for no compression, up to 9)
+     * \return the dataset descriptor
+     */
+    H5::DataSet createChunked1DDataSet(
+            const H5::H5File& file, const std::string& datasetName,
+            const H5::DataType& datasetType, const hsize_t chunk_size,
+            const int compression_level = 0);
+
+    /**
+     * \brief appends values at the end of a one-dimensional, extendible dataset
+     * \param[in] dataset Dataset to extend
+     * \param[in] datasetType type of the values in memory
+     * \param[in] values Pointer to the first value to append
+     * \param[in] n Number of values to append
+     */
+    void append1D(
+            H5::DataSet& dataset, const H5::DataType& datasetType,
+            const void* values, const hsize_t n);
+
     /**
      * \brief open an existing data set
      * \param[in] file HDF5 file descriptor
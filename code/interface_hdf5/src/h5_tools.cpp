@@ -143,6 +143,16 @@ H5::DataSet H5_Tools::createDataSet(
     H5::DSetCreatPropList cparms;
     cparms.setChunk(nDims, chunk_dims);
     delete [] chunk_dims;
+    return createDataSet(file, datasetName, datasetType, space, cparms);
+}
+
+H5::DataSet H5_Tools::createDataSet(
+        const H5::H5File& file,
+        const std::string& datasetName,
+        const H5::DataType& datasetType,
+        const H5::DataSpace& space,
+        const H5::DSetCreatPropList& cparms)
+{
     createMissingGroups(file, datasetName);
     if (H5_Tools::doesDataSetExist(file, datasetName))
     {
@@ -154,6 +164,51 @@ H5::DataSet H5_Tools::createDataSet(
     }
 }
 
+H5::DataSet H5_Tools::createChunked1DDataSet(
+        const H5::H5File& file,
+        const std::string& datasetName,
+        const H5::DataType& datasetType,
+        const hsize_t chunk_size,
+        const int compression_level)
+{
+    if (chunk_size == 0)
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "Chunk size of dataset '" << datasetName << "' should be strictly positive");
+    }
+    if ((compression_level < 0) or (compression_level > 9))
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "Compression level of dataset '" << datasetName << "' should be between 0 and 9, but got " << compression_level);
+    }
+    const hsize_t chunk_dims[1] = {chunk_size};
+    H5::DSetCreatPropList cparms;
+    cparms.setChunk(1, chunk_dims);
+    if (compression_level > 0) cparms.setDeflate((unsigned int)compression_level);
+    return createDataSet(file, datasetName, datasetType, createDataSpace1DEmptyUnlimited(), cparms);
+}
+
+void H5_Tools::append1D(
+        H5::DataSet& dataset,
+        const H5::DataType& datasetType,
+        const void* values,
+        const hsize_t n)
+{
+    if (n == 0) return;
+    H5::DataSpace dataspace = dataset.getSpace();
+    hsize_t size[1] = {(hsize_t)0};
+    if (dataspace.getSimpleExtentDims(size)!=1)
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "Rank mismatch -> Should be one, not " << dataspace.getSimpleExtentNdims());
+    }
+    const hsize_t offset[1] = {size[0]};
+    const hsize_t count[1] = {n};
+    size[0] += n;
+    dataset.extend(size);
+    H5::DataSpace fspace = dataset.getSpace();
+    fspace.selectHyperslab(H5S_SELECT_SET, count, offset);
+    const H5::DataSpace mspace(1, count);
+    dataset.write(values, datasetType, mspace, fspace);
+}
+
 H5::DataSet H5_Tools::openDataSet(
         const H5::H5File& file, const std::string& datasetName)
 {
@@ -76,6 +76,9 @@ public:
     Matrix3x all_nodes;                                         //!< Coordinates of all vertices in mesh, including dynamic ones added for free surface intersection
     size_t total_number_of_nodes;                               //!< Total number of nodes used, including dynamic ones
     double orientation_factor;                                  //!< -1 if the facet is orientation clockwise, +1 otherwise
+
+private:
+    std::vector<Facet> spare_facets;                            //!< Dynamic facets removed by reset_dynamic_data, reused by create_facet_from_edges to avoid allocating
 };
 
 typedef TR1(shared_ptr)<Mesh> MeshPtr;
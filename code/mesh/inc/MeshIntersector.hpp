@@ -41,6 +41,19 @@ class FacetIterator
             return not(rhs != *this);
         }
 
+        FacetIterator operator+(const size_t n) const
+        {
+            std::vector<size_t>::const_iterator there = here+(long)n;
+            return FacetIterator(begin, there);
+        }
+
+        /**  \brief Number of facets between rhs & *this (rhs being before *this)
+          */
+        size_t operator-(const FacetIterator& rhs) const
+        {
+            return (size_t)(here-rhs.here);
+        }
+
     private:
         VectorOfFacet::const_iterator begin;
         std::vector<size_t>::const_iterator here;
@@ -194,7 +207,7 @@ class MeshIntersector
         std::vector<size_t> index_of_emerged_facets;                //!< All emerged facets, including the ones dynamically created by split
         std::vector<size_t> index_of_immersed_facets;               //!< All immersed facets, including the ones dynamically created by split
         std::vector<size_t> index_of_facets_exactly_on_the_surface; //!< All facets exactly on the surface (z==0 for all points), including the ones dynamically created by split
-        std::set<size_t>    index_of_edges_exactly_on_surface;      //!< Edges exactly on free surface (either generated or static)
+        std::vector<size_t> index_of_edges_exactly_on_surface;      //!< Edges exactly on free surface (either generated or static), sorted & without duplicates
 
         friend class ImmersedFacetIterator;
         friend class EmergedFacetIterator;
@@ -244,16 +257,11 @@ class MeshIntersector
         /**
          * \brief Iterate on each edge to find intersection with free surface
          */
-        void find_intersection_with_free_surface(
-                std::vector<size_t>& split_edges,
-                std::vector<int>& edges_immersion_status,
-                std::vector<bool>& facet_crosses_free_surface);
+        void find_intersection_with_free_surface();
         /**
          * \brief Iterate on each facet to classify and/or split
          */
-        void classify_or_split(const std::vector<size_t>& split_edges,
-                               const std::vector<bool>& facet_crosses_free_surface,
-                               std::vector<int>& edges_immersion_status);
+        void classify_or_split();
 
         /**
          * \brief Classify facet based on immersion status
@@ -267,6 +275,13 @@ class MeshIntersector
 
         void build_closing_edge();
         bool need_to_update_closing_facet;
+
+        // Scratch buffers, kept between calls to update_intersection_with_free_surface to avoid allocating
+        std::vector<bool> facet_crosses_free_surface; //!< For each static facet, true if it touches or crosses the free surface
+        std::vector<int> edges_immersion_status;      //!< Immersion status of each edge (including the dynamically added ones)
+        std::vector<size_t> split_edges;              //!< For each static edge that is split, index of the first of the two edges replacing it
+        std::vector<size_t> emerged_edges;            //!< Oriented edges of the emerged part of the facet being split
+        std::vector<size_t> immersed_edges;           //!< Oriented edges of the immersed part of the facet being split
 };
 
 typedef TR1(shared_ptr)<MeshIntersector> MeshIntersectorPtr;
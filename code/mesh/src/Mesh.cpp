@@ -1,4 +1,4 @@
-#include <map>
+#include <utility> // std::move
 
 #include "Mesh.hpp"
 #include "mesh_manipulations.hpp"
@@ -14,7 +14,8 @@ Mesh::Mesh():
     nb_of_static_facets(),
     all_nodes(),
     total_number_of_nodes(),
-    orientation_factor(1)
+    orientation_factor(1),
+    spare_facets()
 {
 }
 
@@ -36,6 +37,7 @@ Mesh::Mesh(
 ,all_nodes(3,nb_of_static_nodes+nb_of_static_edges)
 ,total_number_of_nodes(nb_of_static_nodes)
 ,orientation_factor(clockwise ? -1 : 1)
+,spare_facets()
 {
     Matrix3x room_for_dynamic_vertices(3,all_nodes.cols()-nodes.cols());
     room_for_dynamic_vertices.fill(0);
@@ -47,28 +49,43 @@ void Mesh::reset_dynamic_data()
     total_number_of_nodes = nb_of_static_nodes;
     edges[0].erase( edges[0].begin() + (int)nb_of_static_edges , edges[0].end());
     edges[1].erase( edges[1].begin() + (int)nb_of_static_edges , edges[1].end());
+    // Dynamic facets are kept aside so create_facet_from_edges can reuse their vertex lists
+    for (size_t i = nb_of_static_facets ; i < facets.size() ; ++i) spare_facets.push_back(std::move(facets[i]));
     facets.erase( facets.begin() + (int)nb_of_static_facets , facets.end());
 }
 
 size_t Mesh::create_facet_from_edges(const std::vector<size_t>& oriented_edge_list,const EPoint &unit_normal)
 {
+    Facet facet;
+    if (not(spare_facets.empty()))
+    {
+        facet = std::move(spare_facets.back());
+        spare_facets.pop_back();
+    }
+    std::vector<size_t>& vertex_list = facet.vertex_index;
     size_t n=oriented_edge_list.size();
-    std::vector<size_t> vertex_list(n,0);
-    std::map<size_t, bool> vertex_inserted;
+    vertex_list.assign(n,0);
     size_t nb_of_vertices = 0;
     for( size_t ei=0;ei<oriented_edge_list.size();ei++)
     {
         size_t vertex_index = second_vertex_of_oriented_edge(oriented_edge_list[ei]); // Note: use second vertex rather than first for compatibility with existing tests
-        if (not(vertex_inserted[vertex_index]))
+        bool vertex_inserted = false;
+        for (size_t ej = 0 ; ej < ei ; ++ej)
+        {
+            if (second_vertex_of_oriented_edge(oriented_edge_list[ej]) == vertex_index) vertex_inserted = true;
+        }
+        if (not(vertex_inserted))
         {
             vertex_list[ei]=vertex_index;
-            vertex_inserted[vertex_index] = true;
             nb_of_vertices++;
         }
     }
     vertex_list.resize(nb_of_vertices);
+    facet.unit_normal = unit_normal;
+    facet.centre_of_gravity = ::centre_of_gravity(all_nodes,vertex_list);
+    facet.area = ::area(all_nodes,vertex_list);
     size_t facet_index = facets.size();
-    facets.push_back(Facet(vertex_list,unit_normal,::centre_of_gravity(all_nodes,vertex_list),::area(all_nodes,vertex_list)));
+    facets.push_back(std::move(facet));
     return facet_index;
 }
 
@@ -26,6 +26,11 @@ MeshIntersector::MeshIntersector(const VectorOfVectorOfPoints& mesh_, const bool
 ,index_of_facets_exactly_on_the_surface()
 ,index_of_edges_exactly_on_surface()
 ,need_to_update_closing_facet(true)
+,facet_crosses_free_surface()
+,edges_immersion_status()
+,split_edges()
+,emerged_edges()
+,immersed_edges()
 {}
 
 MeshIntersector::MeshIntersector(const MeshPtr mesh_)
@@ -38,12 +43,14 @@ MeshIntersector::MeshIntersector(const MeshPtr mesh_)
         ,index_of_facets_exactly_on_the_surface()
         ,index_of_edges_exactly_on_surface()
         ,need_to_update_closing_facet(true)
+        ,facet_crosses_free_surface()
+        ,edges_immersion_status()
+        ,split_edges()
+        ,emerged_edges()
+        ,immersed_edges()
 {}
 
-void MeshIntersector::find_intersection_with_free_surface(
-        std::vector<size_t>& split_edges,
-        std::vector<int>& edges_immersion_status,
-        std::vector<bool>& facet_crosses_free_surface)
+void MeshIntersector::find_intersection_with_free_surface()
 {
     for (size_t edge_index = 0; edge_index < mesh->nb_of_static_edges; ++edge_index)
     {
@@ -67,10 +74,7 @@ void MeshIntersector::find_intersection_with_free_surface(
     }
 }
 
-void MeshIntersector::classify_or_split(
-        const std::vector<size_t>& split_edges,
-        const std::vector<bool>& facet_crosses_free_surface,
-        std::vector<int>& edges_immersion_status)
+void MeshIntersector::classify_or_split()
 {
     // Iterate on each facet to classify and/or split
     for (size_t facet_index = 0 ; facet_index < mesh->nb_of_static_facets ; ++facet_index)
@@ -117,6 +121,7 @@ void MeshIntersector::update_intersection_with_free_surface(const std::vector<do
         const std::vector<double>& absolute_wave_elevations  //!< z coordinate in NED frame of the free surface for each point in mesh
         )
 {
+    // All containers keep their capacity from one call to the next: no heap allocation in steady state
     all_relative_immersions = relative_immersions;
     if (std::any_of(relative_immersions.begin(),relative_immersions.end(), [](const double x){return std::isnan(x);}))
     {
@@ -124,11 +129,13 @@ void MeshIntersector::update_intersection_with_free_surface(const std::vector<do
     }
     all_absolute_wave_elevations = absolute_wave_elevations;
     reset_dynamic_members();
-    std::vector<bool> facet_crosses_free_surface(mesh->nb_of_static_facets,false);
-    std::vector<int> edges_immersion_status(mesh->nb_of_static_edges,0); // the immersion status of each edge
-    std::vector<size_t > split_edges(mesh->nb_of_static_edges,0);  //!< a table indicating the index of replacing edge for each edge that is split (there are two consecutive edges per split edge, the table only gives the first one)
-    find_intersection_with_free_surface(split_edges, edges_immersion_status, facet_crosses_free_surface);
-    classify_or_split(split_edges, facet_crosses_free_surface, edges_immersion_status);
+    facet_crosses_free_surface.assign(mesh->nb_of_static_facets,false);
+    edges_immersion_status.assign(mesh->nb_of_static_edges,0);
+    split_edges.assign(mesh->nb_of_static_edges,0);
+    find_intersection_with_free_surface();
+    classify_or_split();
+    std::sort(index_of_edges_exactly_on_surface.begin(), index_of_edges_exactly_on_surface.end());
+    index_of_edges_exactly_on_surface.erase(std::unique(index_of_edges_exactly_on_surface.begin(), index_of_edges_exactly_on_surface.end()), index_of_edges_exactly_on_surface.end());
     all_absolute_immersions.resize(all_absolute_wave_elevations.size());
     for (size_t i = 0 ; i < all_absolute_wave_elevations.size() ; ++i)
     {
@@ -145,7 +152,7 @@ void MeshIntersector::build_closing_edge()
         all_edges_as_pairs.push_back(std::make_pair(mesh->edges.at(0).at(idx), mesh->edges.at(1).at(idx)));
     }
     if (index_of_edges_exactly_on_surface.empty()) return;
-    const auto ll = ClosingFacetComputer::group_connected_edges(all_edges_as_pairs, std::vector<size_t>(index_of_edges_exactly_on_surface.begin(),index_of_edges_exactly_on_surface.end()));
+    const auto ll = ClosingFacetComputer::group_connected_edges(all_edges_as_pairs, index_of_edges_exactly_on_surface);
     for (const auto l:ll)
     {
         const ClosingFacetComputer c(&mesh->all_nodes, all_edges_as_pairs, l);
@@ -172,9 +179,9 @@ void MeshIntersector::split_partially_immersed_facet_and_classify(
         const std::vector<size_t>& split_edges          //!< replacement map for split edges
         )
 {
-    const std::vector<size_t> oriented_edges_of_this_facet = mesh->oriented_edges_per_facet[facet_index];
-    std::vector<size_t> emerged_edges;
-    std::vector<size_t> immersed_edges;
+    const std::vector<size_t>& oriented_edges_of_this_facet = mesh->oriented_edges_per_facet[facet_index];
+    emerged_edges.clear();
+    immersed_edges.clear();
     int status=-1;
     size_t first_emerged  = 0;
     size_t first_immersed = 0;
@@ -187,7 +194,7 @@ void MeshIntersector::split_partially_immersed_facet_and_classify(
         {
             emerged_edges.push_back(oriented_edge);
             immersed_edges.push_back(oriented_edge);
-            index_of_edges_exactly_on_surface.insert(edge_index);
+            index_of_edges_exactly_on_surface.push_back(edge_index);
             if(status==3) first_emerged = emerged_edges.size();
             if(status==0) first_immersed = immersed_edges.size();
         }
@@ -242,7 +249,7 @@ void MeshIntersector::split_partially_immersed_facet_and_classify(
             mesh->first_vertex_of_oriented_edge( emerged_edges[ first_emerged]));
     const bool closing_edge_is_a_point = mesh->edges[0][closing_edge_index] == mesh->edges[1][closing_edge_index];
     if (not(closing_edge_is_a_point))
-        index_of_edges_exactly_on_surface.insert(closing_edge_index);
+        index_of_edges_exactly_on_surface.push_back(closing_edge_index);
     immersed_edges.insert(immersed_edges.begin() + (long)first_immersed, Mesh::convert_index_to_oriented_edge_id(closing_edge_index,true));
     emerged_edges.insert( emerged_edges.begin()  + (long)first_emerged,  Mesh::convert_index_to_oriented_edge_id(closing_edge_index,false));
 
@@ -0,0 +1,58 @@
+/*
+ * MeshIntersectorAllocationTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: cady
+ */
+
+// Counts the heap allocations to check the intersection does not allocate once it has been warmed up.
+// Global operator new is replaced for the whole binary: this test is therefore built as a separate
+// executable (run_allocation_tests) instead of being part of run_all_tests.
+
+#include "gtest/gtest.h"
+#include "MeshIntersector.hpp"
+#include "TriMeshTestData.hpp"
+
+#include <cstdlib> // std::malloc, std::free
+#include <new>     // std::bad_alloc
+
+static bool count_allocations = false;
+static size_t nb_of_allocations = 0;
+
+void* operator new(size_t size)
+{
+    if (count_allocations) nb_of_allocations++;
+    void* p = std::malloc(size ? size : 1);
+    if (not(p)) throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+std::vector<double> get_U_immersions(const double z0);
+std::vector<double> get_U_immersions(const double z0)
+{
+    return std::vector<double>({z0, z0, z0-1,  z0-1, z0-2, z0-2,  z0, z0-1, z0,  z0-1, z0-2, z0-2,  z0,  z0, z0-1, z0-1,  z0-2, z0-2, z0,  z0-1,z0, z0-1, z0-2, z0-2});
+}
+
+TEST(MeshIntersectorAllocationTest, updating_the_intersection_does_not_allocate_once_warmed_up)
+{
+    MeshIntersector intersector(U(),false);
+    const std::vector<double> z0s = {-3, -1.5, -0.7, 0, 0.3, 1, 1.5, 2, 2.5, 5};
+    // First pass: containers reach their final capacity
+    for (const auto z0:z0s)
+    {
+        const std::vector<double> dz = get_U_immersions(z0);
+        intersector.update_intersection_with_free_surface(dz,dz);
+    }
+    std::vector<std::vector<double> > dzs;
+    for (const auto z0:z0s) dzs.push_back(get_U_immersions(z0));
+    nb_of_allocations = 0;
+    count_allocations = true;
+    for (const auto& dz:dzs) intersector.update_intersection_with_free_surface(dz,dz);
+    count_allocations = false;
+    ASSERT_EQ(0, nb_of_allocations);
+}
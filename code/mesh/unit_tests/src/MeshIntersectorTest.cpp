@@ -1096,3 +1096,16 @@ TEST_F(MeshIntersectorTest, unit_normal_of_facets_on_surface_is_properly_compute
     ASSERT_EQ(1, facets_on_surface.size());
     check_vector(facets_on_surface.at(0).unit_normal, 0, 0, -1);
 }
+
+TEST_F(MeshIntersectorTest, indices_of_edges_exactly_on_surface_are_sorted_and_unique)
+{
+    MeshIntersector intersector(U(),false);
+    const std::vector<double> dz = get_U_immersions(1);
+    intersector.update_intersection_with_free_surface(dz,dz);
+    const std::vector<size_t>& idx = intersector.index_of_edges_exactly_on_surface;
+    ASSERT_FALSE(idx.empty());
+    for (size_t i = 1 ; i < idx.size() ; ++i)
+    {
+        ASSERT_LT(idx[i-1], idx[i]);
+    }
+}
@@ -25,8 +25,8 @@ class DictObserver : public Observer
         using Observer::get_serializer;
         using Observer::get_initializer;
 
-        std::function<void()> get_serializer(const double val, const DataAddressing& address);
-        std::function<void()> get_initializer(const double val, const DataAddressing& address);
+        std::function<void()> get_serializer(const double& val, const DataAddressing& address);
+        std::function<void()> get_initializer(const double& val, const DataAddressing& address);
 
         std::function<void()> get_serializer(const SurfaceElevationGrid& val, const DataAddressing& address);
         std::function<void()> get_initializer(const SurfaceElevationGrid& val, const DataAddressing& address);
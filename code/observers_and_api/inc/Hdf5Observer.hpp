@@ -21,7 +21,20 @@ class Hdf5WaveObserver;
 class Hdf5Observer : public Observer
 {
     public:
-        Hdf5Observer(const std::string& filename, const std::vector<std::string>& data);
+        /**  \brief Scalar outputs are buffered in memory & written by blocks of chunk_size values
+          *  \details Datasets use a chunked layout (chunk_size values per chunk), compressed with deflate
+          *           if compression_level is strictly positive (up to 9). Buffered values are written
+          *           when the observer is destroyed, including when the simulation is interrupted by an exception.
+          */
+        Hdf5Observer(const std::string& filename,
+                     const std::vector<std::string>& data,
+                     const size_t chunk_size = 1000,
+                     const int compression_level = 0);
+        ~Hdf5Observer();
+
+        /**  \brief Writes all buffered values to the file
+          */
+        void flush();
         void write_before_simulation(const std::vector<DiscreteDirectionalWaveSpectrum>& val, const DataAddressing& address);
         void write_before_simulation(const std::vector<FlatDiscreteDirectionalWaveSpectrum>& val, const DataAddressing& address);
     private:
@@ -32,18 +45,23 @@ class Hdf5Observer : public Observer
         using Observer::get_serializer;
         using Observer::get_initializer;
 
-        std::function<void()> get_serializer(const double val, const DataAddressing& address);
-        std::function<void()> get_initializer(const double val, const DataAddressing& address);
+        std::function<void()> get_serializer(const double& val, const DataAddressing& address);
+        std::function<void()> get_initializer(const double& val, const DataAddressing& address);
 
         std::function<void()> get_serializer(const SurfaceElevationGrid& val, const DataAddressing& address);
         std::function<void()> get_initializer(const SurfaceElevationGrid& val, const DataAddressing& address);
 
+        void flush(const std::string& name);
+
         H5::H5File h5File;
         std::string basename;
         std::map<std::string, std::string > name2address;
         std::map<std::string, H5::DataSet> name2dataset;
         std::map<std::string, H5::DataType> name2datatype;
         std::map<std::string, H5::DataSpace> name2dataspace;
+        std::map<std::string, std::vector<double> > name2buffer;
+        size_t chunk_size;
+        int compression_level;
 
         TR1(shared_ptr)<Hdf5WaveObserver> wave_serializer;
 };
@@ -2,8 +2,10 @@
 #define OBSERVERS_AND_API_INC_HISTORYPARSER_HPP_
 
 #include <string>
+#include <vector>
 #include "SimServerInputs.hpp"
 
 SimServerInputs parse_SimServerInputs(const std::string& json, const double max_history_length);
+std::vector<SimServerInputs> parse_SimServerInputs_batch(const std::string& json, const double max_history_length);
 
 #endif /* OBSERVERS_AND_API_INC_HISTORYPARSER_HPP_ */
@@ -22,8 +22,8 @@ class MapObserver : public Observer
     private:
         using Observer::get_serializer;
         using Observer::get_initializer;
-        std::function<void()> get_serializer(const double val, const DataAddressing& address);
-        std::function<void()> get_initializer(const double val, const DataAddressing& address);
+        std::function<void()> get_serializer(const double& val, const DataAddressing& address);
+        std::function<void()> get_initializer(const double& val, const DataAddressing& address);
         void flush_after_initialization();
         void flush_after_write();
         void flush_value_during_write();
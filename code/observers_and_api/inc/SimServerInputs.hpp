@@ -24,6 +24,11 @@ struct SimServerInputs
     State state_history_except_last_point;
     State full_state_history;
     std::map<std::string, double> commands;
+    std::string session;
+    bool close_session;
+    bool jacobian;
+    double state_perturbation;
+    double command_perturbation;
     private: SimServerInputs(); // Disabled
 };
 
@@ -0,0 +1,82 @@
+/*
+ * SimServerPool.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: cady
+ */
+
+#ifndef OBSERVERS_AND_API_INC_SIMSERVERPOOL_HPP_
+#define OBSERVERS_AND_API_INC_SIMSERVERPOOL_HPP_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ssc/macros.hpp>
+#include TR1INC(memory)
+
+#include "XdynForCS.hpp"
+
+/** \brief Fixed-size pool of worker threads, each owning its own SimServer
+ *  \details Used by the co-simulation server to process requests from several clients
+ *           concurrently. Each request contains either the full state history or the name
+ *           of a session (whose history is kept by a SimSessions object shared by all the
+ *           workers), so any worker can process any request (whichever client sent it).
+ *           Jobs are started in the order in which they were posted, but may complete in a
+ *           different order.
+ *  \addtogroup observers_and_api
+ *  \ingroup observers_and_api
+ *  \section ex1 Example
+ *  \snippet observers_and_api/unit_tests/src/SimServerPoolTest.cpp SimServerPoolTest example
+ */
+class SimServerPool
+{
+    public:
+        typedef std::function<void(SimServer&)> Job;
+
+        SimServerPool(const std::string& yaml_model,
+                      const std::string& solver,
+                      const double dt,
+                      const size_t nb_of_threads,                           //!< Number of workers (& SimServer instances). If zero, use the number of cores
+                      const SessionLimits& session_limits = SessionLimits() //!< Idle timeout & maximum number of the co-simulation sessions
+                      );
+
+        /**  \brief Waits for all posted jobs to complete & stops the workers (unless stop was called before)
+          */
+        ~SimServerPool();
+
+        /**  \brief Drops the jobs that have not started yet, waits for the running ones & stops the workers
+          *  \details Should be called before destroying whatever the jobs use (e.g. the websocket
+          *           server they reply to). Jobs posted afterwards are ignored.
+          */
+        void stop();
+
+        /**  \brief Queues a job: returns immediately
+          *  \details Exceptions thrown by the job are not caught by the pool: the job should handle them.
+          */
+        void post(const Job& job);
+
+        size_t get_nb_of_threads() const;
+
+    private:
+        SimServerPool(); // Disabled
+        SimServerPool(const SimServerPool&); // Disabled
+        SimServerPool& operator=(const SimServerPool&); // Disabled
+
+        void work(SimServer& server);
+        void join_workers();
+
+        TR1(shared_ptr)<SimSessions> sessions;
+        std::vector<TR1(shared_ptr)<SimServer> > servers;
+        std::deque<Job> jobs;
+        std::mutex mutex;
+        std::condition_variable job_available;
+        bool stopping;
+        std::vector<std::thread> workers;
+};
+
+#endif /* OBSERVERS_AND_API_INC_SIMSERVERPOOL_HPP_ */
@@ -0,0 +1,97 @@
+/*
+ * SimSessions.hpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: cady
+ */
+
+#ifndef OBSERVERS_AND_API_INC_SIMSESSIONS_HPP_
+#define OBSERVERS_AND_API_INC_SIMSESSIONS_HPP_
+
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <ssc/macros.hpp>
+#include TR1INC(memory)
+
+#include "GeometricTypes3d.hpp"
+#include "YamlState.hpp"
+
+class ConfBuilder;
+struct SimServerInputs;
+
+/** \brief Bounds the resources used by the co-simulation sessions of a server
+ *  \details Clients may disconnect without closing their session: idle sessions are
+ *           forgotten after a while & the number of open sessions is bounded.
+ */
+struct SessionLimits
+{
+    SessionLimits();
+    double idle_timeout;       //!< A session which has not received any request for that long (in seconds) is forgotten
+    size_t max_nb_of_sessions; //!< Opening a new session beyond that number is an error
+};
+
+/** \brief Co-simulation sessions: each session keeps its own simulator (& hence its state history) between requests
+ *  \details A client opens a session by sending a request with a new session name (& the state
+ *           history, if the models need one). Its following requests only need to contain the
+ *           newest state samples: they are appended to the history built by the server during the
+ *           previous steps, so the size of the requests (& the time spent parsing them) does not
+ *           depend on the history length. The session is forgotten after a request with
+ *           'close_session' set to true, or when it has been idle for longer than the timeout
+ *           in SessionLimits (its next request then starts a new session). Sessions are
+ *           only identified by their name (any client knowing it can use the session), so
+ *           clients should use names which can't be guessed. Sessions are thread-safe: they can be shared by the
+ *           workers of a SimServerPool (the requests of a given session are processed one at a time).
+ *  \addtogroup observers_and_api
+ *  \ingroup observers_and_api
+ *  \section ex1 Example
+ *  \snippet observers_and_api/unit_tests/src/XdynForCSTest.cpp XdynForCSTest session example
+ */
+class SimSessions
+{
+    public:
+        SimSessions(const std::string& yaml_model,
+                    const std::string& solver,
+                    const double dt,
+                    const SessionLimits& limits = SessionLimits());
+
+        SimSessions(const std::string& yaml_model,
+                    const VectorOfVectorOfPoints& mesh,
+                    const std::string& solver,
+                    const double dt,
+                    const SessionLimits& limits = SessionLimits());
+
+        /**  \brief Runs one step of the session named in 'input' (which is created if necessary)
+          *  \details Throws an InvalidInputException if the session has to be created but the
+          *           maximum number of sessions is already open.
+          */
+        std::vector<YamlState> play_one_step(const SimServerInputs& input);
+
+        /**  \brief Number of sessions currently open
+          */
+        size_t size() const;
+
+    private:
+        SimSessions(); // Disabled
+        SimSessions(const SimSessions&); // Disabled
+        SimSessions& operator=(const SimSessions&); // Disabled
+
+        struct Session;
+        typedef TR1(shared_ptr)<Session> SessionPtr;
+        SessionPtr get_session(const std::string& name);
+        void release_session(const std::string& name, const SessionPtr& session, const bool close);
+        void forget_idle_sessions();
+        void throw_if_too_many_sessions() const;
+
+        std::function<ConfBuilder*()> build_conf; //!< Each session needs its own Sim (Sim's copies share their bodies & forces)
+        const std::string solver;
+        const double dt;
+        const SessionLimits limits;
+        std::map<std::string, SessionPtr> sessions;
+        mutable std::mutex mutex; //!< Protects 'sessions' (each session has its own mutex)
+};
+
+#endif /* OBSERVERS_AND_API_INC_SIMSESSIONS_HPP_ */
@@ -15,10 +15,19 @@ class SimStepper
 {
     public:
         SimStepper(const ConfBuilder& builder, const std::string& solver, const double dt);
+        /**  \brief Simulates from the last state in 'input', discarding the previous history
+          */
         std::vector<YamlState> step(const SimServerInputs& input, double Dt);
 
+        /**  \brief Simulates from the last state in 'input', which is appended to the history
+          *         built by the previous calls (instead of replacing it)
+          *  \details Used for the co-simulation sessions: clients only send the newest state
+          *            samples, so the request's size does not depend on the history length.
+          */
+        std::vector<YamlState> step_keeping_history(const SimServerInputs& input, double Dt);
 
     private:
+        std::vector<YamlState> simulate_and_convert(const double tstart, const double Dt);
         Sim sim;
         const std::string solver;
         const double dt;
@@ -23,8 +23,8 @@ class TsvObserver : public Observer
         using Observer::get_serializer;
         using Observer::get_initializer;
 
-        std::function<void()> get_serializer(const double val, const DataAddressing& address);
-        std::function<void()> get_initializer(const double val, const DataAddressing& address);
+        std::function<void()> get_serializer(const double& val, const DataAddressing& address);
+        std::function<void()> get_initializer(const double& val, const DataAddressing& address);
 };
 
 #endif /* TSVOBSERVER_HPP_ */
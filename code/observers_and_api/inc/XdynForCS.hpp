@@ -3,6 +3,7 @@
 
 #include "ConfBuilder.hpp"
 #include "SimStepper.hpp"
+#include "SimSessions.hpp"
 #include "HistoryParser.hpp"
 
 class SimServer
@@ -17,13 +18,30 @@ class SimServer
                   const std::string& solver,
                   const double dt);
 
+        /**  \brief Same as SimServer(yaml_model, solver, dt), but the sessions are shared with other servers (e.g. those of a SimServerPool)
+          */
+        SimServer(const std::string& yaml_model,
+                  const std::string& solver,
+                  const double dt,
+                  const TR1(shared_ptr)<SimSessions>& sessions);
+
+        /**  \brief Runs one step
+          *  \details If the request has a 'session' key, the step is run by that session's
+          *           simulator (which keeps the history between requests). Otherwise, the
+          *           request should contain the whole state history.
+          */
         std::vector<YamlState> play_one_step(const std::string& raw_yaml);
 
+        /**  \brief Same as play_one_step(raw_yaml), for requests which have already been decoded (e.g. from protobuf)
+          */
+        std::vector<YamlState> play_one_step(const YamlSimServerInputs& inputs);
+
     private :
         SimServer();
         ConfBuilder builder;
         const double dt;
         SimStepper stepper;
+        TR1(shared_ptr)<SimSessions> sessions;
 };
 
 #endif /* OBSERVERS_AND_API_INC_SIMSERVER_HPP_ */
@@ -8,21 +8,66 @@
 #ifndef OBSERVERS_AND_API_INC_XDYNFORME_HPP_
 #define OBSERVERS_AND_API_INC_XDYNFORME_HPP_
 
+#include <map>
 #include <string>
+#include <vector>
+
+#include <ssc/macros.hpp>
+#include TR1INC(memory)
 
 #include "ConfBuilder.hpp"
 #include "HistoryParser.hpp"
 
+class ThreadPool;
+
+/**  \brief Jacobian of the state derivatives returned by XdynForME::calculate_jacobian
+ */
+struct DxDtJacobian
+{
+    DxDtJacobian();
+    std::vector<StateType> wrt_states;             //!< wrt_states[i][j] = d(dX_i/dt)/dX_j, X being (x,y,z,u,v,w,p,q,r,qr,qi,qj,qk)
+    std::map<std::string, StateType> wrt_commands; //!< wrt_commands[c][i] = d(dX_i/dt)/dc, for each command c in the request
+};
+
 class XdynForME
 {
     public :
         XdynForME(const std::string& yaml_model);
+
+        /**  \brief Same as XdynForME(yaml_model), but batches are evaluated by several threads
+          *  \details Each thread has its own simulator (all built by the constructor).
+          */
+        XdynForME(const std::string& yaml_model,
+                  const size_t nb_of_threads //!< Number of threads (& simulators) evaluating batches. If zero, use the number of cores
+                  );
+
         StateType calculate_dx_dt(const SimServerInputs& raw_yaml);
+
+        /**  \brief Evaluates the derivatives of several independent (t, states, commands) inputs
+          *  \details Equivalent to calling calculate_dx_dt for each input, but the evaluations
+          *           are shared between the simulators (& threads). The output is in the same
+          *           order as the input.
+          *  \snippet observers_and_api/unit_tests/src/XdynForMETest.cpp XdynForMETest batch example
+          */
+        std::vector<StateType> calculate_dx_dt(const std::vector<SimServerInputs>& inputs);
+
+        /**  \brief Jacobian of calculate_dx_dt with respect to the states & the commands, by central finite differences
+          *  \details All evaluations are done by the same simulator, whose history is only set once.
+          *           The perturbation of each state (or command) v is
+          *           server_inputs.state_perturbation*max(1,|v|) (or command_perturbation*max(1,|v|)).
+          *           The quaternion is perturbed component by component (without normalization).
+          *  \snippet observers_and_api/unit_tests/src/XdynForMETest.cpp XdynForMETest jacobian example
+          */
+        DxDtJacobian calculate_jacobian(const SimServerInputs& server_inputs);
+
         double get_Tmax() const;
+        size_t get_nb_of_threads() const;
 
     private :
         XdynForME();
         ConfBuilder builder;
+        std::vector<TR1(shared_ptr)<ConfBuilder> > other_builders; //!< One per extra thread
+        TR1(shared_ptr)<ThreadPool> thread_pool;                   //!< Only used if there are several threads. Started once, by the constructor
 };
 
 
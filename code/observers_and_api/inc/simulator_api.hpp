@@ -13,6 +13,7 @@
 struct YamlSimulatorInput;
 
 Sim get_system(const std::string& yaml, const double t0);
+Sim get_system(const std::string& yaml, const double t0, const size_t nb_of_threads /*!< For the facet loop of the surface force models (0: one per core) */);
 Sim get_system(const std::string& yaml, const std::string& mesh, const double t0);
 Sim get_system(const std::string& yaml, const std::map<std::string, VectorOfVectorOfPoints>& meshes, const double t0);
 Sim get_system(const std::string& yaml, const VectorOfVectorOfPoints& mesh, const double t0);
@@ -25,12 +25,12 @@ CsvObserver::~CsvObserver()
     if (output_to_file) delete(&os);
 }
 
-std::function<void()> CsvObserver::get_serializer(const double val, const DataAddressing&)
+std::function<void()> CsvObserver::get_serializer(const double& val, const DataAddressing&)
 {
-    return [this,val](){os << val;};
+    return [this,&val](){os << val;};
 }
 
-std::function<void()> CsvObserver::get_initializer(const double, const DataAddressing& address)
+std::function<void()> CsvObserver::get_initializer(const double&, const DataAddressing& address)
 {
     return [this,address](){std::string title = address.name;boost::replace_all(title, ",", " ");os << title;};
 }
@@ -31,9 +31,9 @@ DictObserver::~DictObserver()
 {
 }
 
-std::function<void()> DictObserver::get_serializer(const double val, const DataAddressing& d)
+std::function<void()> DictObserver::get_serializer(const double& val, const DataAddressing& d)
 {
-    return [this,d,val]()
+    return [this,d,&val]()
                       {
                         DictMapKeyVar j = extractKeyVarFromString(d.name);
                         if (not j.first.empty())
@@ -50,7 +50,7 @@ std::function<void()> DictObserver::get_serializer(const double val, const DataA
                       };
 }
 
-std::function<void()> DictObserver::get_initializer(const double, const DataAddressing&)
+std::function<void()> DictObserver::get_initializer(const double&, const DataAddressing&)
 {
     return [this](){};
 }
@@ -8,6 +8,7 @@
 
 #include "Hdf5WaveObserver.hpp"
 #include "InternalErrorException.hpp"
+#include "InvalidInputException.hpp"
 #include "Hdf5WaveSpectrumObserver.hpp"
 
 Hdf5Addressing::Hdf5Addressing(
@@ -20,7 +21,9 @@ Hdf5Addressing::Hdf5Addressing(
 
 Hdf5Observer::Hdf5Observer(
         const std::string& filename,
-        const std::vector<std::string>& d) :
+        const std::vector<std::string>& d,
+        const size_t chunk_size_,
+        const int compression_level_) :
             Observer(d),
             h5File(H5_Tools::openEmptyHdf5File(filename)),
             basename("outputs"),
@@ -28,38 +31,66 @@ Hdf5Observer::Hdf5Observer(
             name2dataset(),
             name2datatype(),
             name2dataspace(),
+            name2buffer(),
+            chunk_size(chunk_size_),
+            compression_level(compression_level_),
             wave_serializer()
 {
+    if (chunk_size == 0)
+    {
+        THROW(__PRETTY_FUNCTION__, InvalidInputException, "In the 'output' section of the YAML file, 'chunk size' should be strictly positive (for file '" << filename << "')");
+    }
+    if ((compression_level < 0) or (compression_level > 9))
+    {
+        THROW(__PRETTY_FUNCTION__, InvalidInputException, "In the 'output' section of the YAML file, 'compression level' should be between 0 (no compression) and 9, but got " << compression_level << " (for file '" << filename << "')");
+    }
     h5_writeFileDescription(h5File);
     exportMatLabScripts(h5File, filename, basename, "/scripts/MatLab");
     exportPythonScripts(h5File, filename, basename, "/scripts/Python");
 }
 
-std::function<void()> Hdf5Observer::get_serializer(const double val, const DataAddressing& addressing)
+Hdf5Observer::~Hdf5Observer()
 {
-    return [this,val,addressing]()
+    // Destructor is also called during stack unwinding, in which case we still
+    // want to save what was computed before the exception, but must not throw
+    try
+    {
+        flush();
+    }
+    catch (...)
+    {
+    }
+}
+
+void Hdf5Observer::flush()
+{
+    for (auto it = name2buffer.begin() ; it != name2buffer.end() ; ++it)
+    {
+        flush(it->first);
+    }
+    h5File.flush(H5F_SCOPE_LOCAL);
+}
+
+void Hdf5Observer::flush(const std::string& name)
+{
+    std::vector<double>& buffer = name2buffer[name];
+    if (buffer.empty()) return;
+    H5_Tools::append1D(name2dataset[name], name2datatype[name], buffer.data(), (hsize_t)buffer.size());
+    buffer.clear();
+}
+
+std::function<void()> Hdf5Observer::get_serializer(const double& val, const DataAddressing& addressing)
+{
+    std::vector<double>& buffer = name2buffer[addressing.name];
+    const std::string name = addressing.name;
+    return [this,&val,&buffer,name]()
            {
-                H5::DataSet dataset = name2dataset[addressing.name];
-                H5::DataSpace dataspace = dataset.getSpace();
-                hsize_t offset[1] = {(hsize_t)0};
-                hsize_t size[1] = {(hsize_t)0};
-                if (dataspace.getSimpleExtentDims(size)!=1)
-                {
-                    std::stringstream ss;
-                    ss << "Rank mismatch -> Should be one, not " << dataspace.getSimpleExtentNdims();
-                    THROW(__PRETTY_FUNCTION__, InternalErrorException, ss.str());
-                }
-                const hsize_t dims[1] = {(hsize_t)1};
-                offset[0] = size[0];
-                size[0] += 1;
-                dataset.extend(size);
-                H5::DataSpace fspace = dataset.getSpace();
-                fspace.selectHyperslab(H5S_SELECT_SET, dims, offset);
-                dataset.write(&val, name2datatype[addressing.name], H5_Tools::createDataSpace1DUnlimited(), fspace);
+                buffer.push_back(val);
+                if (buffer.size() >= chunk_size) flush(name);
            };
 }
 
-std::function<void()> Hdf5Observer::get_initializer(const double , const DataAddressing& addressing)
+std::function<void()> Hdf5Observer::get_initializer(const double& , const DataAddressing& addressing)
 {
     return [this,addressing]()
            {
@@ -67,10 +98,11 @@ std::function<void()> Hdf5Observer::get_initializer(const double , const DataAdd
                 name2datatype[addressing.name] = H5::DataType(H5::PredType::NATIVE_DOUBLE);
                 name2dataspace[addressing.name] = H5_Tools::createDataSpace1DEmptyUnlimited();
                 name2dataset[addressing.name] =
-                        H5_Tools::createDataSet(h5File,
-                                                name2address[addressing.name],
-                                                name2datatype[addressing.name],
-                                                name2dataspace[addressing.name]);
+                        H5_Tools::createChunked1DDataSet(h5File,
+                                                         name2address[addressing.name],
+                                                         name2datatype[addressing.name],
+                                                         (hsize_t)chunk_size,
+                                                         compression_level);
            };
 }
 
@@ -90,3 +90,13 @@ SimServerInputs parse_SimServerInputs(const std::string& json, const double max_
     const YamlSimServerInputs yaml_inputs = decode_YamlSimServerInputs(json);
     return SimServerInputs(yaml_inputs, max_history_length);
 }
+
+std::vector<SimServerInputs> parse_SimServerInputs_batch(const std::string& json, const double max_history_length)
+{
+    std::vector<SimServerInputs> ret;
+    for (const auto& yaml_inputs:decode_YamlSimServerInputs_batch(json))
+    {
+        ret.push_back(SimServerInputs(yaml_inputs, max_history_length));
+    }
+    return ret;
+}
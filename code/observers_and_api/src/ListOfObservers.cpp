@@ -19,8 +19,8 @@ ListOfObservers::ListOfObservers(const std::vector<YamlOutput>& yaml) : observer
     for (auto output:yaml)
     {
         if (output.format == "csv")  observers.push_back(ObserverPtr(new CsvObserver(output.filename,output.data)));
-        if (output.format == "h5")   observers.push_back(ObserverPtr(new Hdf5Observer(output.filename,output.data)));
-        if (output.format == "hdf5") observers.push_back(ObserverPtr(new Hdf5Observer(output.filename,output.data)));
+        if (output.format == "h5")   observers.push_back(ObserverPtr(new Hdf5Observer(output.filename,output.data,output.chunk_size,output.compression_level)));
+        if (output.format == "hdf5") observers.push_back(ObserverPtr(new Hdf5Observer(output.filename,output.data,output.chunk_size,output.compression_level)));
         if (output.format == "tsv")  observers.push_back(ObserverPtr(new TsvObserver(output.filename,output.data)));
         if (output.format == "map")  observers.push_back(ObserverPtr(new MapObserver(output.data)));
         if (output.format == "json") observers.push_back(ObserverPtr(new JsonObserver(output.filename,output.data)));
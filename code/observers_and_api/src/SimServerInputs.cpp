@@ -35,6 +35,11 @@ SimServerInputs::SimServerInputs(const YamlSimServerInputs& server_inputs, const
     , state_history_except_last_point(max_history_length)
     , full_state_history(max_history_length)
     , commands(server_inputs.commands)
+    , session(server_inputs.session)
+    , close_session(server_inputs.close_session)
+    , jacobian(server_inputs.jacobian)
+    , state_perturbation(server_inputs.state_perturbation)
+    , command_perturbation(server_inputs.command_perturbation)
 {
     if (not(server_inputs.states.empty()))
     {
@@ -69,5 +74,10 @@ SimServerInputs::SimServerInputs(const double Dt_)
     , state_history_except_last_point(Dt_)
     , full_state_history(Dt_)
     , commands({})
+    , session()
+    , close_session(false)
+    , jacobian(false)
+    , state_perturbation(1E-6)
+    , command_perturbation(1E-6)
 {
 }
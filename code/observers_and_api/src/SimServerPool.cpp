@@ -0,0 +1,92 @@
+/*
+ * SimServerPool.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: cady
+ */
+
+#include "SimServerPool.hpp"
+#include "ThreadPool.hpp"
+
+SimServerPool::SimServerPool(const std::string& yaml_model, const std::string& solver, const double dt, const size_t nb_of_threads, const SessionLimits& session_limits) :
+        sessions(new SimSessions(yaml_model, solver, dt, session_limits)),
+        servers(),
+        jobs(),
+        mutex(),
+        job_available(),
+        stopping(false),
+        workers()
+{
+    const size_t n = get_nb_of_threads_to_use(nb_of_threads);
+    // All servers are built before starting the workers: if the YAML is invalid, nothing needs to be stopped
+    for (size_t i = 0 ; i < n ; ++i)
+    {
+        servers.push_back(TR1(shared_ptr)<SimServer>(new SimServer(yaml_model, solver, dt, sessions)));
+    }
+    for (size_t i = 0 ; i < n ; ++i)
+    {
+        SimServer& server = *servers[i];
+        workers.push_back(std::thread([this, &server](){work(server);}));
+    }
+}
+
+SimServerPool::~SimServerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    join_workers();
+}
+
+void SimServerPool::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        jobs.clear();
+        stopping = true;
+    }
+    join_workers();
+}
+
+void SimServerPool::join_workers()
+{
+    job_available.notify_all();
+    for (auto& worker:workers)
+    {
+        if (worker.joinable()) worker.join();
+    }
+}
+
+void SimServerPool::post(const Job& job)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (stopping) return;
+        jobs.push_back(job);
+    }
+    job_available.notify_one();
+}
+
+size_t SimServerPool::get_nb_of_threads() const
+{
+    return workers.size();
+}
+
+void SimServerPool::work(SimServer& server)
+{
+    while (true)
+    {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            // Workers sleep (instead of polling) until there is something to do
+            job_available.wait(lock, [this](){return stopping or not(jobs.empty());});
+            // Remaining jobs are processed before stopping (stop() removes them)
+            if (jobs.empty()) return;
+            job = jobs.front();
+            jobs.pop_front();
+        }
+        job(server);
+    }
+}
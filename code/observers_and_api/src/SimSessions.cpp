@@ -0,0 +1,146 @@
+/*
+ * SimSessions.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: cady
+ */
+
+#include <chrono>
+
+#include "ConfBuilder.hpp"
+#include "InvalidInputException.hpp"
+#include "SimServerInputs.hpp"
+#include "SimSessions.hpp"
+#include "SimStepper.hpp"
+
+SessionLimits::SessionLimits() : idle_timeout(600), max_nb_of_sessions(100)
+{
+}
+
+struct SimSessions::Session
+{
+    Session(const ConfBuilder& builder, const std::string& solver, const double dt) : mutex(), stepper(builder, solver, dt), started(false), last_use(std::chrono::steady_clock::now()), nb_of_requests_in_progress(0)
+    {
+    }
+    std::mutex mutex;                                //!< A session's requests are processed one at a time
+    SimStepper stepper;                              //!< Keeps the history between the requests
+    bool started;                                    //!< False until the first request has been processed: its history replaces the initial one
+    std::chrono::steady_clock::time_point last_use;  //!< End of the latest request (protected by SimSessions::mutex)
+    size_t nb_of_requests_in_progress;               //!< A session is never considered idle while it is in use (protected by SimSessions::mutex)
+};
+
+SimSessions::SimSessions(const std::string& yaml_model, const std::string& solver_, const double dt_, const SessionLimits& limits_) :
+        build_conf([yaml_model](){return new ConfBuilder(yaml_model);}),
+        solver(solver_),
+        dt(dt_),
+        limits(limits_),
+        sessions(),
+        mutex()
+{
+}
+
+SimSessions::SimSessions(const std::string& yaml_model, const VectorOfVectorOfPoints& mesh, const std::string& solver_, const double dt_, const SessionLimits& limits_) :
+        build_conf([yaml_model, mesh](){return new ConfBuilder(yaml_model, mesh);}),
+        solver(solver_),
+        dt(dt_),
+        limits(limits_),
+        sessions(),
+        mutex()
+{
+}
+
+void SimSessions::forget_idle_sessions()
+{
+    const auto now = std::chrono::steady_clock::now();
+    for (auto it = sessions.begin() ; it != sessions.end() ; )
+    {
+        const double idle_time = std::chrono::duration<double>(now - it->second->last_use).count();
+        if ((it->second->nb_of_requests_in_progress == 0) and (idle_time > limits.idle_timeout))
+        {
+            it = sessions.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void SimSessions::throw_if_too_many_sessions() const
+{
+    if (sessions.size() >= limits.max_nb_of_sessions)
+    {
+        THROW(__PRETTY_FUNCTION__, InvalidInputException, "Cannot open a new co-simulation session: the server already has " << sessions.size()
+              << " open sessions, which is the maximum. Close the sessions which are no longer needed (using 'close_session') or wait for idle sessions to expire (after "
+              << limits.idle_timeout << " s).");
+    }
+}
+
+SimSessions::SessionPtr SimSessions::get_session(const std::string& name)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        forget_idle_sessions();
+        const auto it = sessions.find(name);
+        if (it != sessions.end())
+        {
+            it->second->nb_of_requests_in_progress++;
+            return it->second;
+        }
+        throw_if_too_many_sessions();
+    }
+    // Built without holding the lock, so the other sessions are not blocked while we parse the YAML model
+    const TR1(shared_ptr)<ConfBuilder> builder(build_conf());
+    const SessionPtr session(new Session(*builder, solver, dt));
+    std::lock_guard<std::mutex> lock(mutex);
+    // If the same client sent two requests concurrently, the first session to be inserted wins
+    const auto it = sessions.find(name);
+    if (it != sessions.end())
+    {
+        it->second->nb_of_requests_in_progress++;
+        return it->second;
+    }
+    throw_if_too_many_sessions();
+    session->nb_of_requests_in_progress++;
+    sessions.insert(std::make_pair(name, session));
+    return session;
+}
+
+void SimSessions::release_session(const std::string& name, const SessionPtr& session, const bool close)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    session->nb_of_requests_in_progress--;
+    session->last_use = std::chrono::steady_clock::now();
+    const auto it = sessions.find(name);
+    // Another request of the same session may already have closed it (& a new session may have been opened with the same name)
+    if (close and (it != sessions.end()) and (it->second == session))
+    {
+        sessions.erase(it);
+    }
+}
+
+std::vector<YamlState> SimSessions::play_one_step(const SimServerInputs& input)
+{
+    const SessionPtr session = get_session(input.session);
+    std::vector<YamlState> ret;
+    try
+    {
+        std::lock_guard<std::mutex> lock(session->mutex);
+        ret = session->started ? session->stepper.step_keeping_history(input, input.Dt)
+                               : session->stepper.step(input, input.Dt);
+        session->started = true;
+    }
+    catch (...)
+    {
+        release_session(input.session, session, false);
+        throw;
+    }
+    release_session(input.session, session, input.close_session);
+    return ret;
+}
+
+size_t SimSessions::size() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return sessions.size();
+}
@@ -40,12 +40,11 @@ YamlState convert_without_angles(const Res& res)
 std::function<YamlState(const Res&)> convert_with_angles(const BodyPtr& body);
 std::function<YamlState(const Res&)> convert_with_angles(const BodyPtr& body)
 {
-    return [&body](const Res& res)
+    // The body's history is left untouched: it is kept between the steps of a co-simulation session
+    return [body](const Res& res)
             {
                 YamlState ret = convert_without_angles(res);
-                const State new_state(ret,0);
-                body->set_states_history(new_state);
-                const auto angles = body->get_states().get_angles();
+                const auto angles = body->get_angles(res.x, body->get_states().convention);
                 ret.phi = angles.phi;
                 ret.theta = angles.theta;
                 ret.psi = angles.psi;
@@ -55,11 +54,23 @@ std::function<YamlState(const Res&)> convert_with_angles(const BodyPtr& body)
 
 std::vector<YamlState> SimStepper::step(const SimServerInputs& infos, double Dt)
 {
-    const double tstart = infos.t;
     const std::vector<State>states = {infos.full_state_history};
     sim.reset_history();
     sim.set_bodystates(states);
     sim.set_command_listener(infos.commands);
+    return simulate_and_convert(infos.t, Dt);
+}
+
+std::vector<YamlState> SimStepper::step_keeping_history(const SimServerInputs& infos, double Dt)
+{
+    const std::vector<State>states = {infos.full_state_history};
+    sim.append_to_bodystates(states);
+    sim.set_command_listener(infos.commands);
+    return simulate_and_convert(infos.t, Dt);
+}
+
+std::vector<YamlState> SimStepper::simulate_and_convert(const double tstart, const double Dt)
+{
     std::vector<Res> results;
     if(solver == "euler")
     {
@@ -24,12 +24,12 @@ TsvObserver::~TsvObserver()
     if (output_to_file) delete(&os);
 }
 
-std::function<void()> TsvObserver::get_serializer(const double val, const DataAddressing&)
+std::function<void()> TsvObserver::get_serializer(const double& val, const DataAddressing&)
 {
-    return [this,val](){os << val;};
+    return [this,&val](){os << val;};
 }
 
-std::function<void()> TsvObserver::get_initializer(const double, const DataAddressing& address)
+std::function<void()> TsvObserver::get_initializer(const double&, const DataAddressing& address)
 {
     return [this,address](){length_of_title_line+=(size_t)std::max((int)address.name.size(),WIDTH)+1;os << std::setw(WIDTH) << address.name;};
 }
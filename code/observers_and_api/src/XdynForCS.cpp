@@ -1,11 +1,12 @@
 #include "XdynForCS.hpp"
-#include "HistoryParser.hpp"
 #include "SimServerInputs.hpp"
+#include "parse_history.hpp"
 
 SimServer::SimServer(const std::string& yaml_model, const std::string& solver, const double dt)
     : builder(yaml_model)
     , dt(dt)
     , stepper(builder, solver, dt)
+    , sessions(new SimSessions(yaml_model, solver, dt))
 {
 }
 
@@ -16,16 +17,37 @@ SimServer::SimServer(const std::string& yaml_model,
 : builder(yaml_model, mesh)
 , dt(dt)
 , stepper(builder, solver, dt)
+, sessions(new SimSessions(yaml_model, mesh, solver, dt))
+{
+}
+
+SimServer::SimServer(const std::string& yaml_model,
+                  const std::string& solver,
+                  const double dt,
+                  const TR1(shared_ptr)<SimSessions>& sessions_)
+: builder(yaml_model)
+, dt(dt)
+, stepper(builder, solver, dt)
+, sessions(sessions_)
 {
 }
 
 
 std::vector<YamlState> SimServer::play_one_step(const std::string& raw_yaml)
 {
-    SimServerInputs simstepperinfo = parse_SimServerInputs(raw_yaml, builder.Tmax);
+    return play_one_step(decode_YamlSimServerInputs(raw_yaml));
+}
+
+std::vector<YamlState> SimServer::play_one_step(const YamlSimServerInputs& inputs)
+{
+    SimServerInputs simstepperinfo(inputs, builder.Tmax);
     if (simstepperinfo.Dt <= 0)
     {
         THROW(__PRETTY_FUNCTION__, InvalidInputException, "Dt should be greater than 0 but got Dt = " << simstepperinfo.Dt);
     }
+    if (not(simstepperinfo.session.empty()))
+    {
+        return sessions->play_one_step(simstepperinfo);
+    }
     return stepper.step(simstepperinfo, simstepperinfo.Dt);
 }
@@ -5,28 +5,134 @@
  *      Author: cady
  */
 
+#include <algorithm> // std::min
+#include <cmath>
 
+#include "InvalidInputException.hpp"
 #include "SimServerInputs.hpp"
+#include "ThreadPool.hpp"
 #include "XdynForME.hpp"
 
-XdynForME::XdynForME(const std::string& yaml_model) :builder(yaml_model)
+DxDtJacobian::DxDtJacobian() : wrt_states(), wrt_commands()
 {
 }
 
+XdynForME::XdynForME(const std::string& yaml_model) : builder(yaml_model), other_builders(), thread_pool()
+{
+}
+
+XdynForME::XdynForME(const std::string& yaml_model, const size_t nb_of_threads) : builder(yaml_model), other_builders(), thread_pool()
+{
+    // Sim copies share their implementation, so each thread needs a simulator of its own
+    for (size_t i = 1 ; i < get_nb_of_threads_to_use(nb_of_threads) ; ++i)
+    {
+        other_builders.push_back(TR1(shared_ptr)<ConfBuilder>(new ConfBuilder(yaml_model)));
+    }
+    if (not(other_builders.empty())) thread_pool.reset(new ThreadPool(get_nb_of_threads()));
+}
+
 double XdynForME::get_Tmax() const
 {
     return builder.Tmax;
 }
 
-StateType XdynForME::calculate_dx_dt(const SimServerInputs& server_inputs)
+size_t XdynForME::get_nb_of_threads() const
+{
+    return 1 + other_builders.size();
+}
+
+StateType calculate_dx_dt(Sim& sim, const SimServerInputs& server_inputs);
+StateType calculate_dx_dt(Sim& sim, const SimServerInputs& server_inputs)
 {
     const double t = server_inputs.t;
     const std::vector<State>states(1, server_inputs.state_history_except_last_point);
-    builder.sim.set_bodystates(states);
-    builder.sim.set_command_listener(server_inputs.commands);
+    sim.set_bodystates(states);
+    sim.set_command_listener(server_inputs.commands);
 
     StateType dx_dt(13, 0);
-    builder.sim.dx_dt(server_inputs.state_at_t, dx_dt, t);
+    sim.dx_dt(server_inputs.state_at_t, dx_dt, t);
 
     return dx_dt;
 }
+
+StateType XdynForME::calculate_dx_dt(const SimServerInputs& server_inputs)
+{
+    return ::calculate_dx_dt(builder.sim, server_inputs);
+}
+
+std::vector<StateType> XdynForME::calculate_dx_dt(const std::vector<SimServerInputs>& inputs)
+{
+    std::vector<StateType> ret(inputs.size());
+    const size_t nb_of_workers = std::min(get_nb_of_threads(), inputs.size());
+    if (nb_of_workers <= 1)
+    {
+        for (size_t i = 0 ; i < inputs.size() ; ++i) ret[i] = ::calculate_dx_dt(builder.sim, inputs[i]);
+        return ret;
+    }
+    // One task per simulator: task k evaluates inputs k, k+nb_of_workers, k+2*nb_of_workers...
+    thread_pool->run(nb_of_workers, [&](const size_t k)
+        {
+            Sim& sim = k ? other_builders[k-1]->sim : builder.sim;
+            for (size_t i = k ; i < inputs.size() ; i += nb_of_workers)
+            {
+                ret[i] = ::calculate_dx_dt(sim, inputs[i]);
+            }
+        });
+    return ret;
+}
+
+double perturbation(const double relative_perturbation, const double value);
+double perturbation(const double relative_perturbation, const double value)
+{
+    return relative_perturbation*std::max(1., std::abs(value));
+}
+
+DxDtJacobian XdynForME::calculate_jacobian(const SimServerInputs& server_inputs)
+{
+    if (not(server_inputs.state_perturbation > 0) or not(server_inputs.command_perturbation > 0))
+    {
+        THROW(__PRETTY_FUNCTION__, InvalidInputException, "The perturbations used to compute the Jacobian should be strictly positive, but got state_perturbation = "
+              << server_inputs.state_perturbation << " & command_perturbation = " << server_inputs.command_perturbation);
+    }
+    Sim& sim = builder.sim;
+    const double t = server_inputs.t;
+    sim.set_bodystates(std::vector<State>(1, server_inputs.state_history_except_last_point));
+    std::map<std::string, double> commands = server_inputs.commands;
+    sim.set_command_listener(commands);
+
+    const size_t n = server_inputs.state_at_t.size();
+    StateType x = server_inputs.state_at_t;
+    StateType dx_dt_plus(n, 0);
+    StateType dx_dt_minus(n, 0);
+    DxDtJacobian ret;
+    ret.wrt_states.assign(n, StateType(n, 0));
+    // The history is only set once: each evaluation at t replaces the previous one in the body's history
+    for (size_t j = 0 ; j < n ; ++j)
+    {
+        const double xj = x[j];
+        const double h = perturbation(server_inputs.state_perturbation, xj);
+        x[j] = xj + h;
+        sim.dx_dt(x, dx_dt_plus, t);
+        x[j] = xj - h;
+        sim.dx_dt(x, dx_dt_minus, t);
+        x[j] = xj;
+        for (size_t i = 0 ; i < n ; ++i) ret.wrt_states[i][j] = (dx_dt_plus[i] - dx_dt_minus[i])/(2*h);
+    }
+    for (auto& command:commands)
+    {
+        const double c = command.second;
+        const double h = perturbation(server_inputs.command_perturbation, c);
+        command.second = c + h;
+        sim.set_command_listener(commands);
+        sim.dx_dt(x, dx_dt_plus, t);
+        command.second = c - h;
+        sim.set_command_listener(commands);
+        sim.dx_dt(x, dx_dt_minus, t);
+        command.second = c;
+        sim.set_command_listener(commands);
+        StateType& column = ret.wrt_commands[command.first];
+        column.resize(n);
+        for (size_t i = 0 ; i < n ; ++i) column[i] = (dx_dt_plus[i] - dx_dt_minus[i])/(2*h);
+    }
+    return ret;
+}
@@ -134,6 +134,13 @@ Sim get_system(const std::string& yaml, const double t0)
     return get_system(input, t0);
 }
 
+Sim get_system(const std::string& yaml, const double t0, const size_t nb_of_threads)
+{
+    const auto input = SimulatorYamlParser(yaml).parse();
+    const ssc::data_source::DataSource command_listener = make_command_listener(input.commands);
+    return get_builder(input, t0, command_listener).set_nb_of_threads(nb_of_threads).build();
+}
+
 Sim get_system(const std::string& yaml, const std::string& mesh, const double t0)
 {
     const auto input = SimulatorYamlParser(yaml).parse();
@@ -0,0 +1,24 @@
+/*
+ * SimServerPoolTest.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: cady
+ */
+
+#ifndef OBSERVERS_AND_API_UNIT_TESTS_INC_SIMSERVERPOOLTEST_HPP_
+#define OBSERVERS_AND_API_UNIT_TESTS_INC_SIMSERVERPOOLTEST_HPP_
+
+#include "gtest/gtest.h"
+#include <ssc/random_data_generator/DataGenerator.hpp>
+
+class SimServerPoolTest : public ::testing::Test
+{
+    protected:
+        SimServerPoolTest();
+        virtual ~SimServerPoolTest();
+        virtual void SetUp();
+        virtual void TearDown();
+        ssc::random_data_generator::DataGenerator a;
+};
+
+#endif  /* OBSERVERS_AND_API_UNIT_TESTS_INC_SIMSERVERPOOLTEST_HPP_ */
@@ -998,6 +998,59 @@ TEST_F(ForceTests, bug_3210_interpolation_with_non_zero_psi_in_incidence_no_inte
     ASSERT_DOUBLE_EQ(-module[5]*sin(-phase[5]), tau.N()); // Z is down for X-DYN and up for AQUA+
 }
 
+std::vector<double> wrench_components(const ssc::kinematics::Wrench& tau);
+std::vector<double> wrench_components(const ssc::kinematics::Wrench& tau)
+{
+    return std::vector<double>{tau.X(), tau.Y(), tau.Z(), tau.K(), tau.M(), tau.N()};
+}
+
+TEST_F(ForceTests, diffraction_rao_cache_should_be_close_to_exact_interpolation)
+{
+    const YamlModel waves = get_regular_wave(20, 2, 3.7);
+    const std::string conf = get_diffraction_conf(1,2,3);
+    const DiffractionForceModel F_exact = get_diffraction_force_model(waves, conf, test_data::test_ship_hdb());
+    const DiffractionForceModel F_cached = get_diffraction_force_model(waves, conf + "heading step for RAO cache: {value: 1, unit: deg}\n", test_data::test_ship_hdb());
+    std::vector<std::vector<double> > exact, cached;
+    std::vector<double> max_abs(6, 0);
+    for (double psi = -180 ; psi < 540 ; psi += 7.3)
+    {
+        const auto states = get_whole_body_state_with_psi_equal_to(psi);
+        const double t = psi/100;
+        exact.push_back(wrench_components(F_exact(states, t)));
+        cached.push_back(wrench_components(F_cached(states, t)));
+        for (size_t k = 0 ; k < 6 ; ++k) max_abs[k] = std::max(max_abs[k], std::abs(exact.back()[k]));
+    }
+    // Error of the linear interpolation between two 1 deg bins, relative to the amplitude of each component
+    const double relative_error = 1E-3;
+    for (size_t i = 0 ; i < exact.size() ; ++i)
+    {
+        for (size_t k = 0 ; k < 6 ; ++k)
+        {
+            ASSERT_NEAR(exact[i][k], cached[i][k], relative_error*max_abs[k]) << "i = " << i << ", k = " << k;
+        }
+    }
+}
+
+TEST_F(ForceTests, diffraction_rao_cache_should_be_exact_on_the_heading_grid)
+{
+    const YamlModel waves = get_regular_wave(20, 2, 3.7);
+    const std::string conf = get_diffraction_conf(1,2,3);
+    const DiffractionForceModel F_exact = get_diffraction_force_model(waves, conf, test_data::test_ship_hdb());
+    const DiffractionForceModel F_cached = get_diffraction_force_model(waves, conf + "heading step for RAO cache: {value: 5, unit: deg}\n", test_data::test_ship_hdb());
+    for (double psi = 0 ; psi < 360 ; psi += 25)
+    {
+        const auto states = get_whole_body_state_with_psi_equal_to(psi);
+        const std::vector<double> exact = wrench_components(F_exact(states, 0));
+        const std::vector<double> cached = wrench_components(F_cached(states, 0));
+        double max_abs = 0;
+        for (size_t k = 0 ; k < 6 ; ++k) max_abs = std::max(max_abs, std::abs(exact[k]));
+        for (size_t k = 0 ; k < 6 ; ++k)
+        {
+            ASSERT_NEAR(exact[k], cached[k], 1E-9*max_abs) << "psi = " << psi << ", k = " << k;
+        }
+    }
+}
+
 TEST_F(ForceTests, bug_3239_reference_frame_is_incorrect)
 {
     const double propagation_angle_in_ned_frame_in_degrees = 180;
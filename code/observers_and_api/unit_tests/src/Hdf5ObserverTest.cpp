@@ -4,6 +4,8 @@
 #include "Hdf5ObserverTest.hpp"
 #include "ListOfObservers.hpp"
 #include "simulator_api.hpp"
+#include "h5_tools.hpp"
+#include "InvalidInputException.hpp"
 
 Hdf5ObserverTest::Hdf5ObserverTest() : a(ssc::random_data_generator::DataGenerator(546545))
 {
@@ -47,3 +49,40 @@ TEST_F(Hdf5ObserverTest, LONG_should_be_able_to_create_an_observer_with_wave_out
         }
     }
 }
+
+TEST_F(Hdf5ObserverTest, buffered_values_should_all_be_written_to_file)
+{
+    const double dt = 1E-1;
+    const double tend = 10;
+    const std::string filename = "buffered_values_should_all_be_written_to_file.h5";
+    auto sys = get_system(test_data::falling_ball_example(), 0);
+    const std::vector<std::string> data({"t", "z(ball)"});
+    // 101 values: several full chunks & one partial chunk, only written when the observer is destroyed
+    const size_t chunk_size = 7;
+    {
+        Hdf5Observer observer(filename, data, chunk_size, 4);
+        ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, 0, tend, dt, observer);
+    }
+    std::vector<double> t;
+    std::vector<double> z;
+    H5_Tools::read(filename, "/outputs/t", t);
+    H5_Tools::read(filename, "/outputs/states/ball/Z", z);
+    ASSERT_EQ(101, t.size());
+    ASSERT_EQ(101, z.size());
+    for (size_t i = 0 ; i < t.size() ; ++i)
+    {
+        ASSERT_NEAR(dt*(double)i, t[i], 1E-10) << "i = " << i;
+    }
+    ASSERT_LT(z.front(), z.back());
+    EXPECT_EQ(0,remove(filename.c_str()));
+}
+
+TEST_F(Hdf5ObserverTest, should_throw_if_chunk_size_or_compression_level_are_invalid)
+{
+    const std::string filename = "should_throw_if_chunk_size_or_compression_level_are_invalid.h5";
+    const std::vector<std::string> data(1, "t");
+    ASSERT_THROW(Hdf5Observer(filename, data, 0, 0), InvalidInputException);
+    ASSERT_THROW(Hdf5Observer(filename, data, 10, -1), InvalidInputException);
+    ASSERT_THROW(Hdf5Observer(filename, data, 10, 10), InvalidInputException);
+    EXPECT_EQ(0,remove(filename.c_str()));
+}
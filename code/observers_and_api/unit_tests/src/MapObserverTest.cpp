@@ -107,3 +107,37 @@ TEST_F(MapObserverTest, blocked_state_force_residuals_should_appear)
     ASSERT_NEAR(0, m["My(blocked states,body 1,body 1)"].back(), 1E-6);
     ASSERT_NEAR(0, m["Mz(blocked states,body 1,body 1)"].back(), 1E-6);
 }
+
+TEST_F(MapObserverTest, variables_with_the_same_name_should_share_the_same_handle)
+{
+    const DataAddressing a1(std::vector<std::string>{"states","ball","X"},"x(ball)");
+    const DataAddressing a2(std::vector<std::string>{"foo"},"x(ball)");
+    const DataAddressing b(std::vector<std::string>{"states","ball","Y"},"y(ball)");
+    ASSERT_EQ(a1.id, a2.id);
+    ASSERT_NE(a1.id, b.id);
+}
+
+TEST_F(MapObserverTest, each_observer_should_get_the_values_of_the_variables_it_requested)
+{
+    const double dt = 0.1;
+    const double tend = 1;
+    auto sys = get_system(test_data::falling_ball_example(), 0);
+    auto observers = ListOfObservers({observe({"z(ball)","t"}).get().front(),
+                                      observe({"Fz(gravity,ball,NED)","w(ball)","z(ball)"}).get().front()});
+    ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, 0, tend, dt, observers);
+    const auto m1 = static_cast<MapObserver*>(observers.get().at(0).get())->get();
+    const auto m2 = static_cast<MapObserver*>(observers.get().at(1).get())->get();
+    ASSERT_EQ(2, m1.size());
+    ASSERT_EQ(3, m2.size());
+    const auto t = m1.at("t");
+    const auto z = m1.at("z(ball)");
+    const auto w = m2.at("w(ball)");
+    ASSERT_EQ(11, t.size());
+    ASSERT_EQ(z, m2.at("z(ball)"));
+    for (size_t i = 0 ; i < t.size() ; ++i)
+    {
+        ASSERT_NEAR(dt*(double)i, t[i], EPS);
+        ASSERT_LT(0, m2.at("Fz(gravity,ball,NED)")[i]);
+        if (i>0) ASSERT_NEAR(z[i-1]+dt*w[i-1], z[i], EPS);
+    }
+}
@@ -0,0 +1,82 @@
+/*
+ * SimServerPoolTest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: cady
+ */
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "yaml_data.hpp"
+#include "SimServerPool.hpp"
+#include "SimServerPoolTest.hpp"
+
+SimServerPoolTest::SimServerPoolTest() : a(ssc::random_data_generator::DataGenerator(87542))
+{
+}
+
+SimServerPoolTest::~SimServerPoolTest()
+{
+}
+
+void SimServerPoolTest::SetUp()
+{
+}
+
+void SimServerPoolTest::TearDown()
+{
+}
+
+TEST_F(SimServerPoolTest, example)
+{
+//! [SimServerPoolTest example]
+    const std::string yaml_model = test_data::falling_ball_example();
+    const std::string input = test_data::complete_yaml_message_for_falling_ball();
+    const size_t nb_of_requests = 20;
+    std::vector<std::vector<YamlState> > outputs(nb_of_requests);
+    {
+        SimServerPool pool(yaml_model, "euler", 1.0, 4);
+        ASSERT_EQ(4, pool.get_nb_of_threads());
+        for (size_t i = 0 ; i < nb_of_requests ; ++i)
+        {
+            pool.post([i, &input, &outputs](SimServer& server){outputs[i] = server.play_one_step(input);});
+        }
+    } // Pool's destructor waits for all jobs to complete
+//! [SimServerPoolTest example]
+    SimServer sim_server(yaml_model, "euler", 1.0);
+    const std::vector<YamlState> expected = sim_server.play_one_step(input);
+    ASSERT_EQ(11, expected.size());
+    for (size_t i = 0 ; i < nb_of_requests ; ++i)
+    {
+        ASSERT_EQ(expected.size(), outputs[i].size());
+        for (size_t j = 0 ; j < expected.size() ; ++j)
+        {
+            ASSERT_EQ(expected[j].t, outputs[i][j].t);
+            ASSERT_EQ(expected[j].z, outputs[i][j].z);
+            ASSERT_EQ(expected[j].w, outputs[i][j].w);
+        }
+    }
+}
+
+TEST_F(SimServerPoolTest, should_use_at_least_one_thread)
+{
+    SimServerPool pool(test_data::falling_ball_example(), "euler", 1.0, 0);
+    ASSERT_LE(1, pool.get_nb_of_threads());
+}
+
+TEST_F(SimServerPoolTest, stop_should_drop_the_jobs_that_have_not_started)
+{
+    std::atomic<size_t> nb_of_jobs_done(0);
+    SimServerPool pool(test_data::falling_ball_example(), "euler", 1.0, 1);
+    pool.post([](SimServer&){std::this_thread::sleep_for(std::chrono::milliseconds(200));});
+    for (size_t i = 0 ; i < 10 ; ++i)
+    {
+        pool.post([&nb_of_jobs_done](SimServer&){nb_of_jobs_done++;});
+    }
+    pool.stop();
+    ASSERT_EQ(0, nb_of_jobs_done);
+    pool.post([&nb_of_jobs_done](SimServer&){nb_of_jobs_done++;});
+    ASSERT_EQ(0, nb_of_jobs_done);
+}
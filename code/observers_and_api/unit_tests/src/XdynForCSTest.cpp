@@ -1,5 +1,11 @@
 #include "yaml_data.hpp"
 #include <ssc/macros.hpp>
+#include <chrono>
+#include <iomanip> // std::setprecision
+#include <sstream>
+#include <thread>
+
+#include "InvalidInputException.hpp"
 
 #include "TriMeshTestData.hpp"
 #include "XdynForCS.hpp"
@@ -80,3 +86,83 @@ TEST_F(XdynForCSTest, can_get_extra_observations)
         ASSERT_NE(output.extra_observations.find("GZ(cube)"), output.extra_observations.end());
     }
 }
+
+std::string falling_ball_request(const YamlState& s, const double Dt, const std::string& session, const bool close_session);
+std::string falling_ball_request(const YamlState& s, const double Dt, const std::string& session, const bool close_session)
+{
+    std::stringstream ss;
+    ss << std::setprecision(17)
+       << "{\"Dt\": " << Dt << ", \"session\": \"" << session << "\", \"close_session\": " << (close_session ? "true" : "false") << ", "
+       << "\"states\": [{\"t\": " << s.t << ", \"x\": " << s.x << ", \"y\": " << s.y << ", \"z\": " << s.z
+       << ", \"u\": " << s.u << ", \"v\": " << s.v << ", \"w\": " << s.w << ", \"p\": " << s.p << ", \"q\": " << s.q << ", \"r\": " << s.r
+       << ", \"qr\": " << s.qr << ", \"qi\": " << s.qi << ", \"qj\": " << s.qj << ", \"qk\": " << s.qk << "}]}";
+    return ss.str();
+}
+
+TEST_F(XdynForCSTest, sessions_only_need_the_newest_state)
+{
+//! [XdynForCSTest session example]
+    SimServer sim_server(test_data::falling_ball_example(), "euler", 1.0);
+    const YamlState s0(0, 4, 8, 12, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0);
+    const std::vector<YamlState> first_half = sim_server.play_one_step(falling_ball_request(s0, 5, "client 1", false));
+    // The server kept the history: the client only sends its last state
+    const std::vector<YamlState> second_half = sim_server.play_one_step(falling_ball_request(first_half.back(), 5, "client 1", true));
+//! [XdynForCSTest session example]
+    const std::vector<YamlState> expected = sim_server.play_one_step(test_data::complete_yaml_message_for_falling_ball());
+    ASSERT_EQ(6, first_half.size());
+    ASSERT_EQ(6, second_half.size());
+    ASSERT_NEAR(10, second_half.back().t, EPS);
+    ASSERT_NEAR(expected.back().x, second_half.back().x, EPS);
+    ASSERT_NEAR(expected.back().z, second_half.back().z, EPS);
+    ASSERT_NEAR(expected.back().u, second_half.back().u, EPS);
+    ASSERT_NEAR(expected.back().w, second_half.back().w, EPS);
+}
+
+TEST_F(XdynForCSTest, sessions_should_not_go_back_in_time)
+{
+    SimServer sim_server(test_data::falling_ball_example(), "euler", 1.0);
+    const YamlState s0(0, 4, 8, 12, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0);
+    sim_server.play_one_step(falling_ball_request(s0, 5, "client 1", false));
+    ASSERT_THROW(sim_server.play_one_step(falling_ball_request(s0, 5, "client 1", false)), InvalidInputException);
+    // Other sessions are independent
+    ASSERT_NO_THROW(sim_server.play_one_step(falling_ball_request(s0, 5, "client 2", false)));
+}
+
+TEST_F(XdynForCSTest, closed_sessions_are_forgotten)
+{
+    SimServer sim_server(test_data::falling_ball_example(), "euler", 1.0);
+    const YamlState s0(0, 4, 8, 12, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0);
+    sim_server.play_one_step(falling_ball_request(s0, 5, "client 1", true));
+    ASSERT_NO_THROW(sim_server.play_one_step(falling_ball_request(s0, 5, "client 1", false)));
+}
+
+TEST_F(XdynForCSTest, number_of_sessions_is_bounded)
+{
+    SessionLimits limits;
+    limits.max_nb_of_sessions = 2;
+    const TR1(shared_ptr)<SimSessions> sessions(new SimSessions(test_data::falling_ball_example(), "euler", 1.0, limits));
+    SimServer sim_server(test_data::falling_ball_example(), "euler", 1.0, sessions);
+    const YamlState s0(0, 4, 8, 12, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0);
+    const std::vector<YamlState> client_1 = sim_server.play_one_step(falling_ball_request(s0, 5, "client 1", false));
+    sim_server.play_one_step(falling_ball_request(s0, 5, "client 2", false));
+    ASSERT_THROW(sim_server.play_one_step(falling_ball_request(s0, 5, "client 3", false)), InvalidInputException);
+    // Open sessions can still be used
+    sim_server.play_one_step(falling_ball_request(client_1.back(), 1, "client 1", true));
+    ASSERT_EQ(1, sessions->size());
+    ASSERT_NO_THROW(sim_server.play_one_step(falling_ball_request(s0, 5, "client 3", false)));
+}
+
+TEST_F(XdynForCSTest, idle_sessions_are_forgotten)
+{
+    SessionLimits limits;
+    limits.idle_timeout = 0.05;
+    const TR1(shared_ptr)<SimSessions> sessions(new SimSessions(test_data::falling_ball_example(), "euler", 1.0, limits));
+    SimServer sim_server(test_data::falling_ball_example(), "euler", 1.0, sessions);
+    const YamlState s0(0, 4, 8, 12, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0);
+    sim_server.play_one_step(falling_ball_request(s0, 5, "client 1", false));
+    ASSERT_EQ(1, sessions->size());
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    // Session 'client 1' has expired: this request starts a new session (so it may go back in time)
+    ASSERT_NO_THROW(sim_server.play_one_step(falling_ball_request(s0, 5, "client 1", false)));
+    ASSERT_EQ(1, sessions->size());
+}
@@ -11,8 +11,13 @@
 
 #include "XdynForME.hpp"
 #include "XdynForMETest.hpp"
+#include "InvalidInputException.hpp"
 #define EPS 1E-8
 #include <ssc/macros.hpp>
+
+#include <iomanip> // std::setprecision
+#include <sstream>
+
 XdynForMETest::XdynForMETest() : a(ssc::random_data_generator::DataGenerator(123456789))
 {
 }
@@ -154,3 +159,161 @@ TEST_F(XdynForMETest, complete_test_with_commands_and_delay_just_test_quaternion
     EXPECT_NEAR(dqj_dt,          dx_dt[11], EPS);
     EXPECT_NEAR(dqk_dt,          dx_dt[12], EPS);
 }
+
+std::string falling_ball_request(const double t, const double u, const double v, const double w);
+std::string falling_ball_request(const double t, const double u, const double v, const double w)
+{
+    std::stringstream ss;
+    ss << std::setprecision(17)
+       << "{\"states\": [{\"t\": " << t << ", \"x\": 4, \"y\": 8, \"z\": 12, \"u\": " << u << ", \"v\": " << v << ", \"w\": " << w
+       << ", \"p\": 0, \"q\": 0, \"r\": 0, \"qr\": 1, \"qi\": 0, \"qj\": 0, \"qk\": 0}]}";
+    return ss.str();
+}
+
+TEST_F(XdynForMETest, batch_gives_the_same_results_as_single_requests)
+{
+    const std::string yaml = test_data::falling_ball_example();
+    XdynForME sequential(yaml);
+    //! [XdynForMETest batch example]
+    XdynForME parallel(yaml, 3);
+    std::stringstream batch;
+    batch << "[";
+    for (size_t i = 0 ; i < 10 ; ++i)
+    {
+        batch << (i ? "," : "") << falling_ball_request(0.1*double(i), double(i), -double(i), 2*double(i));
+    }
+    batch << "]";
+    const std::vector<SimServerInputs> inputs = parse_SimServerInputs_batch(batch.str(), parallel.get_Tmax());
+    const std::vector<StateType> dx_dts = parallel.calculate_dx_dt(inputs);
+    //! [XdynForMETest batch example]
+    ASSERT_EQ(3, parallel.get_nb_of_threads());
+    ASSERT_EQ(10, dx_dts.size());
+    for (size_t i = 0 ; i < 10 ; ++i)
+    {
+        const StateType expected = sequential.calculate_dx_dt(inputs[i]);
+        ASSERT_EQ(13, dx_dts[i].size());
+        ASSERT_NEAR(double(i), dx_dts[i][0], EPS);
+        ASSERT_NEAR(-double(i), dx_dts[i][1], EPS);
+        ASSERT_NEAR(2*double(i), dx_dts[i][2], EPS);
+        for (size_t j = 0 ; j < 13 ; ++j)
+        {
+            ASSERT_DOUBLE_EQ(expected[j], dx_dts[i][j]) << "batch element " << i << ", derivative " << j;
+        }
+    }
+}
+
+TEST_F(XdynForMETest, batches_can_be_evaluated_sequentially)
+{
+    XdynForME xdyn_for_me(test_data::falling_ball_example());
+    ASSERT_EQ(1, xdyn_for_me.get_nb_of_threads());
+    const std::string batch = "[" + falling_ball_request(0, 1, 2, 3) + "," + falling_ball_request(0, 4, 5, 6) + "]";
+    const std::vector<StateType> dx_dts = xdyn_for_me.calculate_dx_dt(parse_SimServerInputs_batch(batch, xdyn_for_me.get_Tmax()));
+    ASSERT_EQ(2, dx_dts.size());
+    ASSERT_NEAR(1, dx_dts[0][0], EPS);
+    ASSERT_NEAR(6, dx_dts[1][2], EPS);
+    ASSERT_TRUE(xdyn_for_me.calculate_dx_dt(std::vector<SimServerInputs>()).empty());
+}
+
+std::string linear_request(const double z);
+std::string linear_request(const double z)
+{
+    std::stringstream ss;
+    ss << std::setprecision(17)
+       << "{\"states\": [{\"t\": 0, \"x\": 0, \"y\": 0, \"z\": " << z << ", \"u\": 0, \"v\": 0, \"w\": 0"
+       << ", \"p\": 0, \"q\": 0, \"r\": 0, \"qr\": 1, \"qi\": 0, \"qj\": 0, \"qk\": 0}], \"jacobian\": {}}";
+    return ss.str();
+}
+
+TEST_F(XdynForMETest, jacobian_of_linear_damping_and_linear_hydrostatics)
+{
+    //! [XdynForMETest jacobian example]
+    XdynForME xdyn_for_me(test_data::linear_damping_and_linear_hydrostatics());
+    const SimServerInputs server_inputs = parse_SimServerInputs(linear_request(0.1), xdyn_for_me.get_Tmax());
+    ASSERT_TRUE(server_inputs.jacobian);
+    const DxDtJacobian J = xdyn_for_me.calculate_jacobian(server_inputs);
+    //! [XdynForMETest jacobian example]
+    const double eps = 1E-6;
+    ASSERT_EQ(13, J.wrt_states.size());
+    ASSERT_TRUE(J.wrt_commands.empty());
+    // Kinematics: dx/dt = u, dy/dt = v, dz/dt = w & dqi/dt = qr*p/2, dqj/dt = qr*q/2, dqk/dt = qr*r/2
+    ASSERT_NEAR(1, J.wrt_states[0][3], eps);
+    ASSERT_NEAR(1, J.wrt_states[1][4], eps);
+    ASSERT_NEAR(1, J.wrt_states[2][5], eps);
+    ASSERT_NEAR(0.5, J.wrt_states[10][6], eps);
+    ASSERT_NEAR(0.5, J.wrt_states[11][7], eps);
+    ASSERT_NEAR(0.5, J.wrt_states[12][8], eps);
+    // Linear damping: M dV/dt = -D V
+    ASSERT_NEAR(-10./1000, J.wrt_states[3][3], eps);
+    ASSERT_NEAR(-20./1000, J.wrt_states[4][4], eps);
+    ASSERT_NEAR(-30./1000, J.wrt_states[5][5], eps);
+    ASSERT_NEAR(-40./100, J.wrt_states[6][6], eps);
+    ASSERT_NEAR(-50./200, J.wrt_states[7][7], eps);
+    ASSERT_NEAR(-60./300, J.wrt_states[8][8], eps);
+    // Linear hydrostatics: m dw/dt = -K11 z, Ixx dp/dt = -K22 phi & Iyy dq/dt = -K33 theta, with phi = 2 qi & theta = 2 qj near the identity
+    ASSERT_NEAR(-500./1000, J.wrt_states[5][2], eps);
+    ASSERT_NEAR(-2*700./100, J.wrt_states[6][10], eps);
+    ASSERT_NEAR(-2*900./200, J.wrt_states[7][11], eps);
+    // No coupling between surge & the other degrees of freedom
+    for (size_t j = 0 ; j < 13 ; ++j)
+    {
+        if (j != 3) ASSERT_NEAR(0, J.wrt_states[3][j], eps) << "j = " << j;
+    }
+}
+
+TEST_F(XdynForMETest, jacobian_should_match_finite_differences_of_calculate_dx_dt)
+{
+    XdynForME xdyn_for_me(test_data::linear_damping_and_linear_hydrostatics());
+    const DxDtJacobian J = xdyn_for_me.calculate_jacobian(parse_SimServerInputs(linear_request(0.1), xdyn_for_me.get_Tmax()));
+    const double h = 1E-3;
+    const StateType dx_dt_plus = xdyn_for_me.calculate_dx_dt(parse_SimServerInputs(linear_request(0.1+h), xdyn_for_me.get_Tmax()));
+    const StateType dx_dt_minus = xdyn_for_me.calculate_dx_dt(parse_SimServerInputs(linear_request(0.1-h), xdyn_for_me.get_Tmax()));
+    for (size_t i = 0 ; i < 13 ; ++i)
+    {
+        ASSERT_NEAR((dx_dt_plus[i]-dx_dt_minus[i])/(2*h), J.wrt_states[i][2], 1E-6) << "i = " << i;
+    }
+}
+
+TEST_F(XdynForMETest, jacobian_with_respect_to_the_commands)
+{
+    XdynForME xdyn_for_me(test_data::simserver_test_with_commands_and_delay());
+    const std::string input_yaml =
+        "{\"Dt\": 10.0,\n"
+        "\"states\":\n"
+        "[ {\"t\": 0.0, \"x\": 4.0,  \"y\": 8.0, \"z\": 12.0, \"u\": 1.0, \"v\": 0.0, \"w\": 0.0, \"p\": 0.0, \"q\": 0.0,   \"r\": 0.0, \"qr\": 1.0, \"qi\": 0.0, \"qj\": 0.0, \"qk\": 0.0}\n"
+        ", {\"t\": 1.0, \"x\": 5.0,  \"y\": 7.0, \"z\": 13.0, \"u\": 1.1, \"v\": 0.0, \"w\": 0.0, \"p\": 0.0, \"q\": 0.0,   \"r\": 0.0, \"qr\": 1.0, \"qi\": 0.0, \"qj\": 0.0, \"qk\": 0.0}\n"
+        ", {\"t\": 2.0, \"x\": 6.0,  \"y\": 6.0, \"z\": 14.0, \"u\": 1.2, \"v\": 0.0, \"w\": 0.0, \"p\": 0.0, \"q\": 0.0,   \"r\": 0.0, \"qr\": 1.0, \"qi\": 0.0, \"qj\": 0.0, \"qk\": 0.0}\n"
+        ", {\"t\": 3.0, \"x\": 7.0,  \"y\": 5.0, \"z\": 15.0, \"u\": 1.3, \"v\": 0.0, \"w\": 0.0, \"p\": 0.0, \"q\": 0.0,   \"r\": 0.0, \"qr\": 1.0, \"qi\": 0.0, \"qj\": 0.0, \"qk\": 0.0}\n"
+        ", {\"t\": 4.0, \"x\": 8.0,  \"y\": 4.0, \"z\": 16.0, \"u\": 1.4, \"v\": 0.23,\"w\": 0.0, \"p\": 0.0, \"q\": 0.0,   \"r\": 0.0, \"qr\": 1.0, \"qi\": 0.0, \"qj\": 0.0, \"qk\": 0.0}\n"
+        ", {\"t\": 5.0, \"x\": 9.0,  \"y\": 3.0, \"z\": 17.0, \"u\": 1.5, \"v\": 0.0, \"w\": 4.4, \"p\": 0.0, \"q\": 0.0,   \"r\": 0.0, \"qr\": 1.0, \"qi\": 0.0, \"qj\": 0.0, \"qk\": 0.0}\n"
+        ", {\"t\": 6.0, \"x\": 10.0, \"y\": 2.0, \"z\": 18.0, \"u\": 1.6, \"v\": 0.0, \"w\": 0.0, \"p\": 12.0,\"q\": 0.0,   \"r\": 0.0, \"qr\": 1.0, \"qi\": 0.0, \"qj\": 0.0, \"qk\": 0.0}\n"
+        ", {\"t\": 7.0, \"x\": 11.0, \"y\": 1.0, \"z\": 19.0, \"u\": 1.7, \"v\": 0.0, \"w\": 0.0, \"p\": 0.0, \"q\": 0.123, \"r\": 0.0, \"qr\": 1.0, \"qi\": 0.0, \"qj\": 0.0, \"qk\": 0.0}\n"
+        ", {\"t\": 8.0, \"x\": 12.0, \"y\": 0.0, \"z\": 12.1, \"u\": 1.8, \"v\": 0.0, \"w\": 0.0, \"p\": 0.0, \"q\": 0.0,   \"r\": 0.0, \"qr\": 1.0, \"qi\": 0.0, \"qj\": 0.0, \"qk\": 0.0}\n"
+        ", {\"t\": 9.0, \"x\": 13.0, \"y\": 1.0, \"z\": 12.2, \"u\": 1.9, \"v\": 0.0, \"w\": 0.0, \"p\": 0.0, \"q\": 0.0,   \"r\": 0.0, \"qr\": 1.0, \"qi\": 0.0, \"qj\": 0.0, \"qk\": 0.0}\n"
+        ", {\"t\": 10,  \"x\": 14.0, \"y\": 2.0, \"z\": 12.3, \"u\": 0.0, \"v\": 0.0, \"w\": 0.0, \"p\": 0,   \"q\": 0,     \"r\": 0,   \"qr\": 1.1, \"qi\": 2.2, \"qj\": 3.3, \"qk\": 4.4}\n"
+        "],\n"
+        "\"commands\": {\"F1(command1)\": 20, \"F1(a)\": 4.5, \"F1(b)\": 5.7},\n"
+        "\"jacobian\": {\"state_perturbation\": 1e-7, \"command_perturbation\": 1e-7}}";
+    const SimServerInputs server_inputs = parse_SimServerInputs(input_yaml, xdyn_for_me.get_Tmax());
+    const DxDtJacobian J = xdyn_for_me.calculate_jacobian(server_inputs);
+    const double eps = 1E-6;
+    ASSERT_EQ(3, J.wrt_commands.size());
+    // Z = command1*z(t) & M = v(t-6) + command1*w(t-5) + 2*b*p(t-4) + q(t-3)/a, K = b*u(t-6) (all inertias are 1)
+    ASSERT_NEAR(12.3, J.wrt_commands.at("F1(command1)")[5], eps);
+    ASSERT_NEAR(4.4, J.wrt_commands.at("F1(command1)")[7], eps);
+    ASSERT_NEAR(1.4, J.wrt_commands.at("F1(b)")[6], eps);
+    ASSERT_NEAR(2*12, J.wrt_commands.at("F1(b)")[7], eps);
+    ASSERT_NEAR(-0.123/4.5/4.5, J.wrt_commands.at("F1(a)")[7], eps);
+    ASSERT_NEAR(0, J.wrt_commands.at("F1(a)")[5], eps);
+    ASSERT_NEAR(20, J.wrt_states[5][2], eps);
+    // The Jacobian does not change the result of the following requests
+    const StateType dx_dt = xdyn_for_me.calculate_dx_dt(server_inputs);
+    ASSERT_NEAR(20*12.3, dx_dt[5], 1E-8);
+}
+
+TEST_F(XdynForMETest, jacobian_perturbations_should_be_positive)
+{
+    XdynForME xdyn_for_me(test_data::linear_damping_and_linear_hydrostatics());
+    SimServerInputs server_inputs = parse_SimServerInputs(linear_request(0.1), xdyn_for_me.get_Tmax());
+    server_inputs.state_perturbation = 0;
+    ASSERT_THROW(xdyn_for_me.calculate_jacobian(server_inputs), InvalidInputException);
+}
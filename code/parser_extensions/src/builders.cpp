@@ -122,7 +122,9 @@ boost::optional<SurfaceElevationInterfacePtr> SurfaceElevationBuilder<SurfaceEle
         const auto output_mesh = make_wave_mesh(input.output);
         std::vector<WaveModelPtr> models;
         for (const auto& spectrum: input.spectra) models.push_back(parse_wave_model(input.discretization, spectrum));
-        ret.reset(SurfaceElevationInterfacePtr(new SurfaceElevationFromWaves(models,get_wave_mesh_size(input.output),output_mesh)));
+        const SurfaceElevationInterfacePtr waves(new SurfaceElevationFromWaves(models,get_wave_mesh_size(input.output),output_mesh));
+        if (input.lattice.nx) waves->use_lattice(input.lattice);
+        ret.reset(waves);
     }
     return ret;
 }
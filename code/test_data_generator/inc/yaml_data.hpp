@@ -96,6 +96,7 @@ namespace test_data
     std::string tutorial_10_gRPC_force_model();
     std::string tutorial_10_gRPC_force_model_commands();
     std::string gRPC_force_model();
+    std::string linear_damping_and_linear_hydrostatics();
 }
 
 #endif /* YAML_DATA_HPP_ */
@@ -1718,7 +1718,19 @@ std::string test_data::waves_for_parser_validation_only()
        << "       nx: 10\n"
        << "       ymin: {value: -20, unit: m}\n"
        << "       ymax: {value: 3, unit: km}\n"
-       << "       ny: 20\n";
+       << "       ny: 20\n"
+       << "lattice:\n"
+       << "    mesh:\n"
+       << "       xmin: {value: -100, unit: m}\n"
+       << "       xmax: {value: 2, unit: km}\n"
+       << "       nx: 201\n"
+       << "       ymin: {value: -200, unit: m}\n"
+       << "       ymax: {value: 4, unit: km}\n"
+       << "       ny: 301\n"
+       << "       zmin: {value: -5, unit: m}\n"
+       << "       zmax: {value: 30, unit: m}\n"
+       << "       nz: 11\n"
+       << "    tolerance: {value: 2, unit: cm}\n";
     return ss.str();
 }
 
@@ -5066,3 +5078,94 @@ std::string test_data::gRPC_force_model()
        << "c: 1\n";
     return ss.str();
 }
+
+std::string test_data::linear_damping_and_linear_hydrostatics()
+{
+    std::stringstream ss;
+    ss << "rotations convention: [psi, theta', phi'']\n"
+       << "\n"
+       << "environmental constants:\n"
+       << "    g: {value: 9.81, unit: m/s^2}\n"
+       << "    rho: {value: 1000, unit: kg/m^3}\n"
+       << "    nu: {value: 1.18e-6, unit: m^2/s}\n"
+       << "environment models:\n"
+       << "  - model: no waves\n"
+       << "    frame: NED\n"
+       << "    constant sea elevation in NED frame: {value: 0, unit: m}\n"
+       << "\n"
+       << "bodies: # All bodies have NED as parent frame\n"
+       << "  - name: body\n"
+       << "    position of body frame relative to mesh:\n"
+       << "        frame: mesh\n"
+       << "        x: {value: 0, unit: m}\n"
+       << "        y: {value: 0, unit: m}\n"
+       << "        z: {value: 0, unit: m}\n"
+       << "        phi: {value: 0, unit: rad}\n"
+       << "        theta: {value: 0, unit: rad}\n"
+       << "        psi: {value: 0, unit: rad}\n"
+       << "    initial position of body frame relative to NED:\n"
+       << "        frame: NED\n"
+       << "        x: {value: 0, unit: m}\n"
+       << "        y: {value: 0, unit: m}\n"
+       << "        z: {value: 0, unit: m}\n"
+       << "        phi: {value: 0, unit: rad}\n"
+       << "        theta: {value: 0, unit: rad}\n"
+       << "        psi: {value: 0, unit: rad}\n"
+       << "    initial velocity of body frame relative to NED:\n"
+       << "        frame: body\n"
+       << "        u: {value: 0, unit: m/s}\n"
+       << "        v: {value: 0, unit: m/s}\n"
+       << "        w: {value: 0, unit: m/s}\n"
+       << "        p: {value: 0, unit: rad/s}\n"
+       << "        q: {value: 0, unit: rad/s}\n"
+       << "        r: {value: 0, unit: rad/s}\n"
+       << "    dynamics:\n"
+       << "        hydrodynamic forces calculation point in body frame:\n"
+       << "            x: {value: 0, unit: m}\n"
+       << "            y: {value: 0, unit: m}\n"
+       << "            z: {value: 0, unit: m}\n"
+       << "        centre of inertia:\n"
+       << "            frame: body\n"
+       << "            x: {value: 0, unit: m}\n"
+       << "            y: {value: 0, unit: m}\n"
+       << "            z: {value: 0, unit: m}\n"
+       << "        rigid body inertia matrix at the center of gravity and projected in the body frame:\n"
+       << "            row 1: [1000,0,0,0,0,0]\n"
+       << "            row 2: [0,1000,0,0,0,0]\n"
+       << "            row 3: [0,0,1000,0,0,0]\n"
+       << "            row 4: [0,0,0,100,0,0]\n"
+       << "            row 5: [0,0,0,0,200,0]\n"
+       << "            row 6: [0,0,0,0,0,300]\n"
+       << "        added mass matrix at the center of gravity and projected in the body frame:\n"
+       << "            row 1: [0,0,0,0,0,0]\n"
+       << "            row 2: [0,0,0,0,0,0]\n"
+       << "            row 3: [0,0,0,0,0,0]\n"
+       << "            row 4: [0,0,0,0,0,0]\n"
+       << "            row 5: [0,0,0,0,0,0]\n"
+       << "            row 6: [0,0,0,0,0,0]\n"
+       << "    external forces:\n"
+       << "      - model: linear damping\n"
+       << "        damping matrix at the center of gravity projected in the body frame:\n"
+       << "            row 1: [10, 0, 0, 0, 0, 0]\n"
+       << "            row 2: [ 0,20, 0, 0, 0, 0]\n"
+       << "            row 3: [ 0, 0,30, 0, 0, 0]\n"
+       << "            row 4: [ 0, 0, 0,40, 0, 0]\n"
+       << "            row 5: [ 0, 0, 0, 0,50, 0]\n"
+       << "            row 6: [ 0, 0, 0, 0, 0,60]\n"
+       << "      - model: linear hydrostatics\n"
+       << "        z eq: {value: 0, unit: m}\n"
+       << "        theta eq: {value: 0, unit: deg}\n"
+       << "        phi eq: {value: 0, unit: deg}\n"
+       << "        K row 1: [500, 0, 0]\n"
+       << "        K row 2: [0, 700, 0]\n"
+       << "        K row 3: [0, 0, 900]\n"
+       << "        x1: {value: 10, unit: m}\n"
+       << "        y1: {value: -10, unit: m}\n"
+       << "        x2: {value: 10, unit: m}\n"
+       << "        y2: {value: 10, unit: m}\n"
+       << "        x3: {value: -10, unit: m}\n"
+       << "        y3: {value: -10, unit: m}\n"
+       << "        x4: {value: -10, unit: m}\n"
+       << "        y4: {value: 10, unit: m}\n";
+    return ss.str();
+}
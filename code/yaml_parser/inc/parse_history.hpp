@@ -9,5 +9,13 @@
 std::string encode_YamlStates(const std::vector<YamlState>& states);
 YamlSimServerInputs decode_YamlSimServerInputs(const std::string& yaml);
 
+/**  \brief Decodes a JSON array of requests (each with the same format as for decode_YamlSimServerInputs)
+  */
+std::vector<YamlSimServerInputs> decode_YamlSimServerInputs_batch(const std::string& json);
+
+/**  \brief True if the JSON's root is an array (i.e. it should be decoded by decode_YamlSimServerInputs_batch)
+  */
+bool is_a_batch(const std::string& json);
+
 
 #endif /* YAML_PARSER_INC_PARSE_HISTORY_HPP_ */
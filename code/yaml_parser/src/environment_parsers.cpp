@@ -18,6 +18,7 @@ void operator >> (const YAML::Node& node, YamlDiscretization& g);
 void operator >> (const YAML::Node& node, YamlSpectra& g);
 void operator >> (const YAML::Node& node, YamlWaveOutput& g);
 void operator >> (const YAML::Node& node, YamlStretching& g);
+void operator >> (const YAML::Node& node, YamlWaveLattice& g);
 
 void get_yaml(const YAML::Node& node, std::string& out);
 
@@ -80,6 +81,19 @@ YamlWaveModel parse_waves(const std::string& yaml)
             THROW(__PRETTY_FUNCTION__, InvalidInputException, ss.str());
         }
     }
+    if (node.FindValue("lattice"))
+    {
+        try
+        {
+            node["lattice"]        >> ret.lattice;
+        }
+        catch(std::exception& e)
+        {
+            std::stringstream ss;
+            ss << "Error parsing section wave/lattice: " << e.what();
+            THROW(__PRETTY_FUNCTION__, InvalidInputException, ss.str());
+        }
+    }
     return ret;
 }
 
@@ -140,6 +154,23 @@ void operator >> (const YAML::Node& node, YamlWaveOutput& g)
     g.ny = try_to_parse_positive_integer(node["mesh"],"ny");
 }
 
+void operator >> (const YAML::Node& node, YamlWaveLattice& g)
+{
+    ssc::yaml_parser::parse_uv(node["mesh"]["xmin"], g.xmin);
+    ssc::yaml_parser::parse_uv(node["mesh"]["xmax"], g.xmax);
+    g.nx = try_to_parse_positive_integer(node["mesh"],"nx");
+    ssc::yaml_parser::parse_uv(node["mesh"]["ymin"], g.ymin);
+    ssc::yaml_parser::parse_uv(node["mesh"]["ymax"], g.ymax);
+    g.ny = try_to_parse_positive_integer(node["mesh"],"ny");
+    if (node["mesh"].FindValue("nz")) // The z axis is only needed to interpolate the dynamic pressure
+    {
+        ssc::yaml_parser::parse_uv(node["mesh"]["zmin"], g.zmin);
+        ssc::yaml_parser::parse_uv(node["mesh"]["zmax"], g.zmax);
+        g.nz = try_to_parse_positive_integer(node["mesh"],"nz");
+    }
+    ssc::yaml_parser::parse_uv(node["tolerance"], g.tolerance);
+}
+
 
 YamlDiracDirection   parse_wave_dirac_direction(const std::string& yaml)
 {
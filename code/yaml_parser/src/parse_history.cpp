@@ -6,10 +6,9 @@
 #include "YamlState.hpp"
 #include <ssc/json.hpp>
 
-YamlSimServerInputs decode_YamlSimServerInputs(const std::string& json)
+YamlSimServerInputs decode_YamlSimServerInputs(rapidjson::Value& document);
+YamlSimServerInputs decode_YamlSimServerInputs(rapidjson::Value& document)
 {
-    rapidjson::Document document;
-    ssc::json::parse(json, document);
     YamlSimServerInputs infos;
     if (not(document.IsObject()))
     {
@@ -43,6 +42,33 @@ YamlSimServerInputs decode_YamlSimServerInputs(const std::string& json)
         s.qk = ssc::json::find_double("qk", v);
         infos.states.push_back(s);
     }
+    if (document.HasMember("session"))
+    {
+        if (not(document["session"].IsString()))
+        {
+            THROW(__PRETTY_FUNCTION__, ssc::json::Exception, "'session' should be a JSON string: got " << ssc::json::print_type(document["session"]))
+        }
+        infos.session = document["session"].GetString();
+    }
+    if (document.HasMember("close_session"))
+    {
+        if (not(document["close_session"].IsBool()))
+        {
+            THROW(__PRETTY_FUNCTION__, ssc::json::Exception, "'close_session' should be a JSON boolean: got " << ssc::json::print_type(document["close_session"]))
+        }
+        infos.close_session = document["close_session"].GetBool();
+    }
+    if (document.HasMember("jacobian"))
+    {
+        rapidjson::Value& jacobian = document["jacobian"];
+        if (not(jacobian.IsObject()))
+        {
+            THROW(__PRETTY_FUNCTION__, ssc::json::Exception, "'jacobian' should be a JSON object (possibly empty, e.g. {\"state_perturbation\": 1e-6, \"command_perturbation\": 1e-6}): got " << ssc::json::print_type(jacobian))
+        }
+        infos.jacobian = true;
+        infos.state_perturbation = ssc::json::find_optional_double("state_perturbation", jacobian, infos.state_perturbation);
+        infos.command_perturbation = ssc::json::find_optional_double("command_perturbation", jacobian, infos.command_perturbation);
+    }
     if (document.HasMember("commands"))
     {
         const rapidjson::Value& commands = document["commands"];
@@ -65,6 +91,36 @@ YamlSimServerInputs decode_YamlSimServerInputs(const std::string& json)
     return infos;
 }
 
+YamlSimServerInputs decode_YamlSimServerInputs(const std::string& json)
+{
+    rapidjson::Document document;
+    ssc::json::parse(json, document);
+    return decode_YamlSimServerInputs(document);
+}
+
+std::vector<YamlSimServerInputs> decode_YamlSimServerInputs_batch(const std::string& json)
+{
+    rapidjson::Document document;
+    ssc::json::parse(json, document);
+    if (not(document.IsArray()))
+    {
+        THROW(__PRETTY_FUNCTION__, ssc::json::Exception, "A batch should be a JSON array (i.e. within square brackets), but it's not (it's a " << ssc::json::print_type(document) << ").");
+    }
+    std::vector<YamlSimServerInputs> ret;
+    ret.reserve(document.Size());
+    for (rapidjson::Value& v:document.GetArray())
+    {
+        ret.push_back(decode_YamlSimServerInputs(v));
+    }
+    return ret;
+}
+
+bool is_a_batch(const std::string& json)
+{
+    const size_t i = json.find_first_not_of(" \t\r\n");
+    return (i != std::string::npos) and (json[i] == '[');
+}
+
 std::ostream& operator<<(std::ostream& os, const std::map<std::string, double>& m);
 std::ostream& operator<<(std::ostream& os, const std::map<std::string, double>& m)
 {
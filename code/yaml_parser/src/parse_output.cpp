@@ -30,6 +30,14 @@ void operator >> (const YAML::Node& node, YamlOutput& f)
     {
         *pName >> f.port;
     }
+    if(const YAML::Node *pName = node.FindValue("chunk size"))
+    {
+        *pName >> f.chunk_size;
+    }
+    if(const YAML::Node *pName = node.FindValue("compression level"))
+    {
+        *pName >> f.compression_level;
+    }
     node["format"]   >> f.format;
     node["data"]     >> f.data;
 }
@@ -101,6 +101,42 @@ TEST_F(environment_parsersTest, can_parse_wave_outputs)
     ASSERT_EQ(20, yaml.output.ny);
 }
 
+TEST_F(environment_parsersTest, can_parse_wave_lattice)
+{
+    ASSERT_DOUBLE_EQ(-100, yaml.lattice.xmin);
+    ASSERT_DOUBLE_EQ(2000, yaml.lattice.xmax);
+    ASSERT_EQ(201, yaml.lattice.nx);
+    ASSERT_DOUBLE_EQ(-200, yaml.lattice.ymin);
+    ASSERT_DOUBLE_EQ(4000, yaml.lattice.ymax);
+    ASSERT_EQ(301, yaml.lattice.ny);
+    ASSERT_DOUBLE_EQ(-5, yaml.lattice.zmin);
+    ASSERT_DOUBLE_EQ(30, yaml.lattice.zmax);
+    ASSERT_EQ(11, yaml.lattice.nz);
+    ASSERT_DOUBLE_EQ(0.02, yaml.lattice.tolerance);
+}
+
+TEST_F(environment_parsersTest, wave_lattice_and_its_z_axis_are_optional)
+{
+    const std::string waves = test_data::waves_for_parser_validation_only();
+    const std::string waves_without_lattice = waves.substr(0, waves.find("lattice:"));
+    ASSERT_EQ(0, parse_waves(waves_without_lattice).lattice.nx);
+    const std::string lattice_without_z = waves_without_lattice
+                                        + "lattice:\n"
+                                        + "    mesh:\n"
+                                        + "       xmin: {value: -100, unit: m}\n"
+                                        + "       xmax: {value: 100, unit: m}\n"
+                                        + "       nx: 101\n"
+                                        + "       ymin: {value: -50, unit: m}\n"
+                                        + "       ymax: {value: 50, unit: m}\n"
+                                        + "       ny: 51\n"
+                                        + "    tolerance: {value: 1, unit: cm}\n";
+    const YamlWaveLattice lattice = parse_waves(lattice_without_z).lattice;
+    ASSERT_EQ(101, lattice.nx);
+    ASSERT_EQ(51, lattice.ny);
+    ASSERT_EQ(0, lattice.nz);
+    ASSERT_DOUBLE_EQ(0.01, lattice.tolerance);
+}
+
 
 TEST_F(environment_parsersTest, can_parse_jonswap_spectrum)
 {
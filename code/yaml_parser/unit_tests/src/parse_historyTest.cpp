@@ -13,6 +13,7 @@
 #include <vector>
 #include <sstream>
 #include <ssc/macros.hpp>
+#include <ssc/json.hpp>
 
 parse_historyTest::parse_historyTest() : a(ssc::random_data_generator::DataGenerator(42))
 {
@@ -90,3 +91,48 @@ TEST_F(parse_historyTest, Dt_should_not_be_compulsory)
     YamlSimServerInputs yinfos = decode_YamlSimServerInputs(test_data::simserver_message_without_Dt());
     ASSERT_EQ(yinfos.Dt, 0);
 }
+
+TEST_F(parse_historyTest, can_parse_session)
+{
+    const std::string json = "{\"Dt\": 1, \"session\": \"client 1\", \"close_session\": true, \"states\": []}";
+    const YamlSimServerInputs yinfos = decode_YamlSimServerInputs(json);
+    ASSERT_EQ("client 1", yinfos.session);
+    ASSERT_TRUE(yinfos.close_session);
+}
+
+TEST_F(parse_historyTest, session_should_not_be_compulsory)
+{
+    const YamlSimServerInputs yinfos = decode_YamlSimServerInputs(test_data::complete_yaml_message_for_falling_ball());
+    ASSERT_TRUE(yinfos.session.empty());
+    ASSERT_FALSE(yinfos.close_session);
+}
+
+TEST_F(parse_historyTest, can_parse_batch)
+{
+    const std::string json = "[" + test_data::complete_yaml_message_for_falling_ball() + ",\n" + test_data::complete_yaml_message_from_gui() + "]";
+    ASSERT_TRUE(is_a_batch(json));
+    const std::vector<YamlSimServerInputs> batch = decode_YamlSimServerInputs_batch(json);
+    ASSERT_EQ(2, batch.size());
+    ASSERT_EQ(1, batch[0].states.size());
+    ASSERT_DOUBLE_EQ(1.87, batch[0].states[0].t);
+    ASSERT_EQ(batch[1].commands.find("RPM")->second, 1.2);
+}
+
+TEST_F(parse_historyTest, single_requests_are_not_batches)
+{
+    ASSERT_FALSE(is_a_batch(test_data::complete_yaml_message_for_falling_ball()));
+    ASSERT_FALSE(is_a_batch(""));
+    ASSERT_TRUE(is_a_batch(" \n[]"));
+    ASSERT_THROW(decode_YamlSimServerInputs_batch(test_data::complete_yaml_message_for_falling_ball()), ssc::json::Exception);
+}
+
+TEST_F(parse_historyTest, can_parse_jacobian_perturbations)
+{
+    const std::string json = "{\"states\": [], \"jacobian\": {\"state_perturbation\": 1e-5, \"command_perturbation\": 1e-4}}";
+    const YamlSimServerInputs yinfos = decode_YamlSimServerInputs(json);
+    ASSERT_TRUE(yinfos.jacobian);
+    ASSERT_DOUBLE_EQ(1E-5, yinfos.state_perturbation);
+    ASSERT_DOUBLE_EQ(1E-4, yinfos.command_perturbation);
+    ASSERT_TRUE(decode_YamlSimServerInputs("{\"states\": [], \"jacobian\": {}}").jacobian);
+    ASSERT_FALSE(decode_YamlSimServerInputs(test_data::complete_yaml_message_for_falling_ball()).jacobian);
+}
@@ -44,6 +44,27 @@ TEST_F(parse_outputTest, can_parse_outputs)
     ASSERT_EQ("waves", res.at(1).data.at(3));
 }
 
+TEST_F(parse_outputTest, hdf5_chunk_size_and_compression_level_are_optional)
+{
+    const auto res = parse_output(test_data::full_example());
+    ASSERT_EQ(1000, res.at(1).chunk_size);
+    ASSERT_EQ(0, res.at(1).compression_level);
+}
+
+TEST_F(parse_outputTest, can_parse_hdf5_chunk_size_and_compression_level)
+{
+    const std::string yaml = "output:\n"
+                             "   - format: hdf5\n"
+                             "     filename: out.h5\n"
+                             "     chunk size: 500\n"
+                             "     compression level: 6\n"
+                             "     data: [t]\n";
+    const auto res = parse_output(yaml);
+    ASSERT_EQ(1, res.size());
+    ASSERT_EQ(500, res.at(0).chunk_size);
+    ASSERT_EQ(6, res.at(0).compression_level);
+}
+
 TEST_F(parse_outputTest, should_work_even_if_string_is_empty)
 {
     parse_output("");
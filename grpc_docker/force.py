@@ -422,26 +422,32 @@ class ForceServicer(force_pb2_grpc.ForceServicer):
                            ','.join(available_commands) + ']')
         return available_commands[formatted_command]
 
+    def compute_force(self, request):
+        """Call the force model & marshall its outputs to gRPC."""
+        response = force_pb2.ForceResponse()
+        required_commands = self.required_commands[request.instance_name]
+        get_command_value = partial(self.get_command, request.commands,
+                                    request.instance_name)
+        commands = {command: get_command_value(command) for command in
+                    required_commands}
+        out = self.model[request.instance_name].force(request.states,
+                                                      commands,
+                                                      request.wave_information
+                                                      )
+        response.Fx = out['Fx']
+        response.Fy = out['Fy']
+        response.Fz = out['Fz']
+        response.Mx = out['Mx']
+        response.My = out['My']
+        response.Mz = out['Mz']
+        response.extra_observations.update(out['extra_observations'])
+        return response
+
     def force(self, request, context):
         """Marshall force model's arguments from gRPC."""
         response = force_pb2.ForceResponse()
         try:
-            required_commands = self.required_commands[request.instance_name]
-            get_command_value = partial(self.get_command, request.commands,
-                                        request.instance_name)
-            commands = {command: get_command_value(command) for command in
-                        required_commands}
-            out = self.model[request.instance_name].force(request.states,
-                                                          commands,
-                                                          request.wave_information
-                                                          )
-            response.Fx = out['Fx']
-            response.Fy = out['Fy']
-            response.Fz = out['Fz']
-            response.Mx = out['Mx']
-            response.My = out['My']
-            response.Mz = out['Mz']
-            response.extra_observations.update(out['extra_observations'])
+            response = self.compute_force(request)
         except NotImplementedError as exception:
             context.set_details(repr(exception))
             context.set_code(grpc.StatusCode.UNIMPLEMENTED)
@@ -450,6 +456,24 @@ class ForceServicer(force_pb2_grpc.ForceServicer):
             context.set_code(grpc.StatusCode.UNKNOWN)
         return response
 
+    def force_stream(self, request_iterator, context):
+        """Same as 'force', but for all requests sent on a single stream.
+
+        xdyn keeps this stream open for the whole simulation, which avoids
+        the cost of a new RPC at each evaluation of the force model.
+        Each open stream holds one of the server's workers. The first error
+        aborts the stream, with the same status code as 'force': for a
+        NotImplementedError, xdyn falls back to 'force', which reports it.
+        """
+        for request in request_iterator:
+            try:
+                response = self.compute_force(request)
+            except NotImplementedError as exception:
+                context.abort(grpc.StatusCode.UNIMPLEMENTED, repr(exception))
+            except Exception as exception:
+                context.abort(grpc.StatusCode.UNKNOWN, repr(exception))
+            yield response
+
     def required_wave_information(self, request, context):
         response = force_pb2.RequiredWaveInformationResponse()
         if self.wave_information_required:
@@ -504,9 +528,13 @@ class ForceServicer(force_pb2_grpc.ForceServicer):
         return response
 
 
-def serve(model):
-    """Launch the gRPC server."""
-    server = grpc.server(futures.ThreadPoolExecutor(max_workers=10))
+def serve(model, max_workers=10):
+    """Launch the gRPC server.
+
+    Each xdyn force model using this server keeps a stream open, which holds
+    one worker: max_workers should be greater than the number of such models.
+    """
+    server = grpc.server(futures.ThreadPoolExecutor(max_workers=max_workers))
     force_pb2_grpc.add_ForceServicer_to_server(
         ForceServicer(model), server)
     server.add_insecure_port('[::]:9002')
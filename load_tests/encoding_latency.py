@@ -0,0 +1,94 @@
+"""Round-trip latency of xdyn-for-cs with JSON & protobuf requests.
+
+For each history length, the script times the same request encoded in JSON
+(sent as a text websocket message) and in protobuf (sent as a binary
+message, cf. code/grpc/cosimulation.proto), including the encoding of the
+request & the decoding of the response on the client side.
+
+The protobuf modules must be generated first (cf. Readme.md).
+"""
+
+import argparse
+import json
+import time
+
+from websocket import create_connection
+
+import cosimulation_pb2
+from history_latency import get_history
+from load_test import STATE_KEYS, get_request, percentile
+
+
+def json_round_trip(ws, request):
+    """Encode, send, receive & decode one JSON request."""
+    ws.send(json.dumps(request))
+    reply = json.loads(ws.recv())
+    if isinstance(reply, dict) and "error" in reply:
+        raise RuntimeError("Error returned by the server: " + reply["error"])
+    return reply
+
+
+def protobuf_round_trip(ws, request):
+    """Encode, send, receive & decode one protobuf request."""
+    message = cosimulation_pb2.CosimulationRequest()
+    for key in STATE_KEYS:
+        getattr(message.states, key).extend(
+            [state[key] for state in request["states"]])
+    for command, value in request["commands"].items():
+        message.commands[command] = value
+    message.Dt = request["Dt"]
+    ws.send_binary(message.SerializeToString())
+    reply = cosimulation_pb2.CosimulationResponse()
+    reply.ParseFromString(ws.recv())
+    if reply.error:
+        raise RuntimeError("Error returned by the server: " + reply.error)
+    return reply
+
+
+def latencies(round_trip, ws, request, nb_of_requests):
+    """Sorted round-trip times (in seconds) of nb_of_requests requests."""
+    ret = []
+    for _ in range(nb_of_requests):
+        start = time.perf_counter()
+        round_trip(ws, request)
+        ret.append(time.perf_counter() - start)
+    return sorted(ret)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--url", default="ws://127.0.0.1:9002",
+                        help="address of the xdyn-for-cs server")
+    parser.add_argument("--lengths", default="1,10,100,1000,10000",
+                        help="comma-separated history lengths "
+                             "(number of states)")
+    parser.add_argument("--requests", type=int, default=50,
+                        help="number of requests timed for each length "
+                             "& each encoding")
+    parser.add_argument("--dt", type=float, default=0.1,
+                        help="time step of each request & between two "
+                             "states of the history")
+    parser.add_argument("--commands", default="{}",
+                        help="commands sent with each request (JSON)")
+    args = parser.parse_args()
+    args.me = False
+    ws = create_connection(args.url)
+    print("history  -------- JSON --------  ------ protobuf ------")
+    print(" length  p50 (ms)  p99 (ms)      p50 (ms)  p99 (ms)   speed-up")
+    try:
+        for length in [int(n) for n in args.lengths.split(",")]:
+            request = get_request(args, get_history(args, length))
+            json_ = latencies(json_round_trip, ws, request, args.requests)
+            pb = latencies(protobuf_round_trip, ws, request, args.requests)
+            print("{:>7} {:>9.2f} {:>9.2f} {:>13.2f} {:>9.2f} {:>10.2f}"
+                  .format(length, 1000 * percentile(json_, 50),
+                          1000 * percentile(json_, 99),
+                          1000 * percentile(pb, 50),
+                          1000 * percentile(pb, 99),
+                          percentile(json_, 50) / percentile(pb, 50)))
+    finally:
+        ws.close()
+
+
+if __name__ == "__main__":
+    main()
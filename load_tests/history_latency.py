@@ -0,0 +1,102 @@
+"""Per-request latency of xdyn-for-cs as a function of the history length.
+
+For each history length, the script times:
+- requests containing the whole history (without session), as the server
+  has to decode & rebuild it at each request,
+- requests sent in a session: the first request contains the whole history
+  and the next ones only contain the last state.
+"""
+
+import argparse
+import json
+import time
+import uuid
+
+from websocket import create_connection
+
+from load_test import STATE_KEYS, get_initial_state, get_request, percentile
+
+
+def get_history(args, length):
+    """length states, args.dt seconds apart, starting at t = 0."""
+    history = []
+    for i in range(length):
+        state = get_initial_state()
+        state["t"] = i * args.dt
+        history.append(state)
+    return history
+
+
+def time_request(ws, request):
+    """Round-trip time (in seconds) & reply of one request."""
+    start = time.perf_counter()
+    ws.send(request)
+    reply = json.loads(ws.recv())
+    duration = time.perf_counter() - start
+    if isinstance(reply, dict) and "error" in reply:
+        raise RuntimeError("Error returned by the server: " + reply["error"])
+    return duration, reply
+
+
+def without_session(args, ws, history):
+    """Latencies & request size when each request contains the history."""
+    request = json.dumps(get_request(args, history))
+    latencies = [time_request(ws, request)[0] for _ in range(args.requests)]
+    return sorted(latencies), len(request)
+
+
+def with_session(args, ws, history):
+    """Latencies & request size when the server keeps the history."""
+    session = str(uuid.uuid4())
+    request = get_request(args, history)
+    request["session"] = session
+    _, reply = time_request(ws, json.dumps(request))
+    latencies = []
+    size = 0
+    for i in range(args.requests):
+        request = get_request(args, [{k: reply[-1][k] for k in STATE_KEYS}])
+        request["session"] = session
+        request["close_session"] = i + 1 == args.requests
+        request = json.dumps(request)
+        size = len(request)
+        latency, reply = time_request(ws, request)
+        latencies.append(latency)
+    return sorted(latencies), size
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--url", default="ws://127.0.0.1:9002",
+                        help="address of the xdyn-for-cs server")
+    parser.add_argument("--lengths", default="1,10,100,1000,10000",
+                        help="comma-separated history lengths "
+                             "(number of states)")
+    parser.add_argument("--requests", type=int, default=50,
+                        help="number of requests timed for each length")
+    parser.add_argument("--dt", type=float, default=0.1,
+                        help="time step of each request & between two "
+                             "states of the history")
+    parser.add_argument("--commands", default="{}",
+                        help="commands sent with each request (JSON)")
+    args = parser.parse_args()
+    args.me = False
+    ws = create_connection(args.url)
+    print("history  ------ without session -------  ------- with session --------")
+    print(" length   bytes  p50 (ms)  p99 (ms)        bytes  p50 (ms)  p99 (ms)")
+    try:
+        for length in [int(n) for n in args.lengths.split(",")]:
+            history = get_history(args, length)
+            stateless, stateless_size = without_session(args, ws, history)
+            session, session_size = with_session(args, ws, history)
+            print("{:>7} {:>7} {:>9.2f} {:>9.2f} {:>12} {:>9.2f} {:>9.2f}"
+                  .format(length, stateless_size,
+                          1000 * percentile(stateless, 50),
+                          1000 * percentile(stateless, 99), session_size,
+                          1000 * percentile(session, 50),
+                          1000 * percentile(session, 99)))
+    finally:
+        ws.close()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,113 @@
+"""Load test for the xdyn websocket servers (xdyn-for-cs & xdyn-for-me).
+
+Each client opens its own connection and sends its requests one after the
+other (waiting for each reply, as a cosimulation client would). The number
+of clients grows at each stage: for each stage, the script reports the
+number of requests per second handled by the server and the latency
+percentiles seen by the clients.
+"""
+
+import argparse
+import json
+import threading
+import time
+
+from websocket import create_connection
+
+STATE_KEYS = ["t", "x", "y", "z", "u", "v", "w", "p", "q", "r",
+              "qr", "qi", "qj", "qk"]
+
+
+def get_initial_state():
+    """Same initial state as the falling ball tutorial."""
+    return {"t": 0, "x": 4, "y": 8, "z": 12, "u": 1, "v": 0, "w": 0,
+            "p": 0, "q": 1, "r": 0, "qr": 1, "qi": 0, "qj": 0, "qk": 0}
+
+
+def get_request(args, states):
+    """Request for xdyn-for-cs (with a time step) or xdyn-for-me."""
+    request = {"states": states, "commands": json.loads(args.commands)}
+    if not args.me:
+        request["Dt"] = args.dt
+    return request
+
+
+def next_states(args, states, reply):
+    """xdyn-for-cs: the next request starts where the last one ended."""
+    if args.me:
+        return states
+    return [{key: reply[-1][key] for key in STATE_KEYS}]
+
+
+def run_client(args, latencies, errors):
+    """Send args.requests requests on one connection & record latencies."""
+    ws = create_connection(args.url)
+    states = [get_initial_state()]
+    try:
+        for _ in range(args.requests):
+            request = json.dumps(get_request(args, states))
+            start = time.perf_counter()
+            ws.send(request)
+            reply = json.loads(ws.recv())
+            latencies.append(time.perf_counter() - start)
+            if isinstance(reply, dict) and "error" in reply:
+                errors.append(reply["error"])
+                return
+            states = next_states(args, states, reply)
+    finally:
+        ws.close()
+
+
+def percentile(sorted_values, p):
+    """Nearest-rank percentile of an already sorted list."""
+    if not sorted_values:
+        return float("nan")
+    rank = max(0, int(round(p / 100. * len(sorted_values))) - 1)
+    return sorted_values[min(rank, len(sorted_values) - 1)]
+
+
+def run_stage(args, nb_of_clients):
+    """Run nb_of_clients clients simultaneously & print their statistics."""
+    latencies = []
+    errors = []
+    clients = [threading.Thread(target=run_client,
+                                args=(args, latencies, errors))
+               for _ in range(nb_of_clients)]
+    start = time.perf_counter()
+    for client in clients:
+        client.start()
+    for client in clients:
+        client.join()
+    duration = time.perf_counter() - start
+    latencies.sort()
+    print("{:>7} {:>10} {:>10.1f} {:>9.2f} {:>9.2f} {:>9.2f} {:>9.2f}".format(
+        nb_of_clients, len(latencies), len(latencies) / duration,
+        1000 * percentile(latencies, 50), 1000 * percentile(latencies, 95),
+        1000 * percentile(latencies, 99), 1000 * percentile(latencies, 100)))
+    for error in errors[:1]:
+        print("Error returned by the server: " + error)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--url", default="ws://127.0.0.1:9002",
+                        help="address of the websocket server")
+    parser.add_argument("--clients", default="1,2,4,8,16,32",
+                        help="comma-separated numbers of simultaneous "
+                             "clients (one stage per value)")
+    parser.add_argument("--requests", type=int, default=200,
+                        help="number of requests sent by each client")
+    parser.add_argument("--dt", type=float, default=0.1,
+                        help="time step of each request (xdyn-for-cs)")
+    parser.add_argument("--commands", default="{}",
+                        help="commands sent with each request (JSON)")
+    parser.add_argument("--me", action="store_true",
+                        help="the server is xdyn-for-me (no time step)")
+    args = parser.parse_args()
+    print("clients   requests      req/s  p50 (ms)  p95 (ms)  p99 (ms)  max (ms)")
+    for nb_of_clients in [int(n) for n in args.clients.split(",")]:
+        run_stage(args, nb_of_clients)
+
+
+if __name__ == "__main__":
+    main()